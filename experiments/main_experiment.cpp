@@ -1,14 +1,29 @@
 #include <chrono>
+#include <cstdint>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "../src/ALNS.h"
+#include "../src/CotaInferior.h"
+#include "../src/CriterioParada.h"
 #include "../src/GRASP.h"
+#include "../src/GeneradorAleatorio.h"
 #include "../src/HeuristicaClarkeWright.h"
 #include "../src/HeuristicaInsercionCercana.h"
+#include "../src/HybridGeneticSearch.h"
 #include "../src/OperadorRelocate.h"
 #include "../src/OperadorSwap.h"
+#include "../src/Portafolio.h"
+#include "../src/ProveedorDistancias.h"
+#include "../src/IteratedLocalSearch.h"
+#include "../src/ModeloIslas.h"
+#include "../src/SISR.h"
+#include "../src/SimulatedAnnealing.h"
+#include "../src/TabuSearch.h"
 #include "../src/VRPLIBReader.h"
 
 using namespace std;
@@ -31,32 +46,205 @@ void print_result(const std::string &instance, int capacity, int total_demand,
 }
 
 int main(int argc, char *argv[]) {
-  if (argc < 4) {
+  // Options ("--name value") may appear anywhere; the rest are positional.
+  std::vector<std::string> args;
+  bool seed_given = false;
+  uint64_t seed = 0;
+  int threads = 0; // 0: all cores
+  CriterioParada criterio;
+  bool emit_improvements = false;
+  std::vector<int> reactive_k;
+  int reactive_period = 100;
+  int elite_pool = 0;
+  int exact_route_size = -1;
+  bool skip_duplicates = false;
+  long grasp_skipped = 0;
+  int pipeline_builders = -1;
+  double pipeline_filter = -1;
+  std::string cooling = "geometric";
+  double alpha = 0.995;
+  long max_moves = 0;
+  long max_iterations = 0;
+  std::string perturbation = "relocate";
+  int strength = 0;
+  std::string acceptance = "better";
+  double threshold = 0.01;
+  double removal_avg = 10;
+  int population = 25;
+  double migration_period = 0;
+  std::string island_algorithms = "grasp,ils,sa";
+  int max_string = 10;
+  double iterations_per_second = -1;
+  int recombination = 0;
+  // < 0: the bound is computed (300 iterations) only when a gap is reported
+  // (--lower-bound) or used as a stopping criterion (--gap)
+  int lower_bound_iterations = -1;
+  bool report_gap = false;
+  std::string cache_dir;
+  bool on_demand_distances = false;
+  std::string distance_storage = "double";
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--seed" && i + 1 < argc) {
+      seed = std::stoull(argv[++i]);
+      seed_given = true;
+    } else if (arg == "--threads" && i + 1 < argc) {
+      threads = std::stoi(argv[++i]);
+    } else if (arg == "--time-limit" && i + 1 < argc) {
+      criterio.limiteTiempo = std::stod(argv[++i]);
+    } else if (arg == "--target-cost" && i + 1 < argc) {
+      criterio.costoObjetivo = std::stod(argv[++i]);
+    } else if (arg == "--cache" && i + 1 < argc) {
+      cache_dir = argv[++i];
+    } else if (arg == "--gap" && i + 1 < argc) {
+      criterio.brechaObjetivo = std::stod(argv[++i]);
+    } else if (arg == "--lower-bound") {
+      report_gap = true;
+    } else if (arg == "--lower-bound-iterations" && i + 1 < argc) {
+      lower_bound_iterations = std::stoi(argv[++i]);
+    } else if (arg == "--stall-iterations" && i + 1 < argc) {
+      criterio.iteracionesSinMejora = std::stoi(argv[++i]);
+    } else if (arg == "--reactive-k" && i + 1 < argc) {
+      // Comma separated list of candidate RCL sizes, e.g. 2,3,5,8
+      std::string list = argv[++i];
+      size_t start = 0;
+      while (start < list.size()) {
+        size_t end = list.find(',', start);
+        if (end == std::string::npos)
+          end = list.size();
+        reactive_k.push_back(std::stoi(list.substr(start, end - start)));
+        start = end + 1;
+      }
+    } else if (arg == "--reactive-period" && i + 1 < argc) {
+      reactive_period = std::stoi(argv[++i]);
+    } else if (arg == "--pipeline" && i + 1 < argc) {
+      pipeline_builders = std::stoi(argv[++i]);
+    } else if (arg == "--pipeline-filter" && i + 1 < argc) {
+      pipeline_filter = std::stod(argv[++i]);
+    } else if (arg == "--cooling" && i + 1 < argc) {
+      cooling = argv[++i];
+    } else if (arg == "--alpha" && i + 1 < argc) {
+      alpha = std::stod(argv[++i]);
+    } else if (arg == "--max-moves" && i + 1 < argc) {
+      max_moves = std::stol(argv[++i]);
+    } else if (arg == "--max-iterations" && i + 1 < argc) {
+      max_iterations = std::stol(argv[++i]);
+    } else if (arg == "--perturbation" && i + 1 < argc) {
+      perturbation = argv[++i];
+    } else if (arg == "--strength" && i + 1 < argc) {
+      strength = std::stoi(argv[++i]);
+    } else if (arg == "--acceptance" && i + 1 < argc) {
+      acceptance = argv[++i];
+    } else if (arg == "--threshold" && i + 1 < argc) {
+      threshold = std::stod(argv[++i]);
+    } else if (arg == "--removal-avg" && i + 1 < argc) {
+      removal_avg = std::stod(argv[++i]);
+    } else if (arg == "--max-string" && i + 1 < argc) {
+      max_string = std::stoi(argv[++i]);
+    } else if (arg == "--population" && i + 1 < argc) {
+      population = std::stoi(argv[++i]);
+    } else if (arg == "--migration-period" && i + 1 < argc) {
+      migration_period = std::stod(argv[++i]);
+    } else if (arg == "--island-algorithms" && i + 1 < argc) {
+      island_algorithms = argv[++i];
+    } else if (arg == "--exact-route-size" && i + 1 < argc) {
+      exact_route_size = std::stoi(argv[++i]);
+    } else if (arg == "--recombination" && i + 1 < argc) {
+      recombination = std::stoi(argv[++i]);
+    } else if (arg == "--elite-pool" && i + 1 < argc) {
+      elite_pool = std::stoi(argv[++i]);
+    } else if (arg == "--emit-improvements") {
+      emit_improvements = true;
+    } else if (arg == "--skip-duplicates") {
+      skip_duplicates = true;
+    } else if (arg == "--on-demand-distances") {
+      on_demand_distances = true;
+    } else if (arg == "--distance-storage" && i + 1 < argc) {
+      distance_storage = argv[++i];
+    } else {
+      args.push_back(arg);
+    }
+  }
+  if (args.size() < 3) {
     std::cerr << "Usage: " << argv[0]
               << " <instance_path> <heuristic> <local_search> [grasp_iters] "
-                 "[grasp_kRCL]"
+                 "[grasp_kRCL] [--seed N] [--threads N] [--time-limit S] "
+                 "[--target-cost C] [--gap X] [--lower-bound] "
+                 "[--lower-bound-iterations N] "
+                 "[--stall-iterations N] "
+                 "[--emit-improvements] [--reactive-k k1,k2,...] "
+                 "[--reactive-period N] [--elite-pool N] [--skip-duplicates] "
+                 "[--pipeline N] "
+                 "[--pipeline-filter X] [--cooling geometric|adaptive] "
+                 "[--alpha A] [--max-moves N] [--max-iterations N] "
+                 "[--perturbation relocate|bridge] [--strength N] "
+                 "[--acceptance better|threshold|always] [--threshold X] "
+                 "[--removal-avg C] [--max-string L] [--population N] "
+                 "[--migration-period S] [--island-algorithms grasp,ils,sa] "
+                 "[--exact-route-size N] [--recombination N] [--cache DIR] "
+                 "[--on-demand-distances] "
+                 "[--distance-storage double|float|triangular|triangular-float]"
+              << std::endl;
+    std::cerr << "grasp_iters <= 0 means no iteration limit when another "
+                 "stopping criterion is given."
               << std::endl;
     return 2;
   }
-  std::string instance_path = argv[1];
-  std::string heuristic = argv[2]; // "cw", "ni", "grasp"
+  if (!seed_given)
+    seed = GeneradorAleatorio::semillaAleatoria();
+  if (lower_bound_iterations < 0)
+    lower_bound_iterations =
+        report_gap || criterio.brechaObjetivo > 0 ? 300 : 0;
+  std::string instance_path = args[0];
+  std::string heuristic = args[1]; // "cw", "ni", "grasp", "sa", "tabu", "ils", "sisr", "alns",
+                                   // "hgs", "islands", "portfolio"
   std::string local_search =
-      argv[3]; // "none", "swap", "relocate", "both" (ignored for grasp)
+      args[2]; // "none", "swap", "relocate", "both" (ignored for grasp)
   int grasp_iters = 0, grasp_kRCL = 0;
+  if (heuristic == "portfolio" && args.size() >= 5) {
+    grasp_iters = std::stoi(args[3]);
+    grasp_kRCL = std::stoi(args[4]);
+  }
   if (heuristic == "grasp") {
-    if (argc < 6) {
+    if (args.size() < 5) {
       std::cerr
           << "For GRASP, provide [grasp_iters] [grasp_kRCL] as extra arguments."
           << std::endl;
       return 2;
     }
-    grasp_iters = std::stoi(argv[4]);
-    grasp_kRCL = std::stoi(argv[5]);
+    grasp_iters = std::stoi(args[3]);
+    grasp_kRCL = std::stoi(args[4]);
   }
 
   try {
     auto start = std::chrono::high_resolution_clock::now();
-    VRPLIBReader reader(instance_path);
+    // Compact formats are chosen here, at load time; the search code only
+    // sees a ProveedorDistancias
+    ProveedorDistancias::Formato storage = ProveedorDistancias::Formato::Densa;
+    if (distance_storage == "float")
+      storage = ProveedorDistancias::Formato::Simple;
+    else if (distance_storage == "triangular")
+      storage = ProveedorDistancias::Formato::Triangular;
+    else if (distance_storage == "triangular-float")
+      storage = ProveedorDistancias::Formato::TriangularSimple;
+    else if (distance_storage != "double")
+      throw std::runtime_error("unknown --distance-storage: " +
+                               distance_storage);
+    const bool compact_distances =
+        storage != ProveedorDistancias::Formato::Densa;
+    if (on_demand_distances && !cache_dir.empty())
+      throw std::runtime_error("--cache stores the distance matrix; it cannot "
+                               "be combined with --on-demand-distances");
+    if (on_demand_distances && compact_distances)
+      throw std::runtime_error("--on-demand-distances keeps no matrix; it "
+                               "cannot be combined with --distance-storage");
+    // A compact matrix is filled straight from the coordinates when the
+    // instance has them, so the dense one is never built
+    VRPLIBReader reader =
+        on_demand_distances || (compact_distances && cache_dir.empty())
+            ? VRPLIBReader(instance_path, DistanceStorage::OnDemand)
+        : cache_dir.empty() ? VRPLIBReader(instance_path)
+                            : VRPLIBReader(instance_path, cache_dir);
     std::string instance_name = reader.getName();
     int capacity = reader.getCapacity();
     int num_vehicles = reader.getNumVehicles();
@@ -71,36 +259,309 @@ int main(int argc, char *argv[]) {
         total_demand += demands[nodes[i].id];
       }
     }
-    const std::vector<std::vector<double>> &dist_matrix =
-        reader.getDistanceMatrix();
-    Solucion solucion(clientes, dist_matrix, num_vehicles);
+    // The reader's matrix is indexed by node id; heuristics that take an
+    // id2pos map expect it indexed by position (depot 0, clientes[i] i + 1).
+    // Without a matrix, distances are computed from the coordinates, laid
+    // out by position the same way. After a cache hit the matrix is read
+    // from the mapped cache file and never copied.
+    std::shared_ptr<const double> mapped_distances =
+        reader.getMappedDistances();
+    std::vector<std::vector<double>> pos_matrix;
+    std::shared_ptr<const ProveedorDistancias> pos_distances;
+    std::shared_ptr<const ProveedorDistancias> id_distances;
+    std::vector<int> id_at_pos = {depotId};
+    for (const Cliente &c : clientes)
+      id_at_pos.push_back(c.getId());
+    if (mapped_distances && !compact_distances) {
+      id_distances = std::make_shared<const ProveedorDistancias>(
+          mapped_distances, reader.getDimension() + 1);
+      // With consecutive ids this is a view of the same block, not a copy
+      pos_distances = id_distances->reindexar(id_at_pos);
+    } else if (reader.hasDistanceMatrix() && !compact_distances) {
+      const std::vector<std::vector<double>> &dist_matrix =
+          reader.getDistanceMatrix();
+      pos_matrix.assign(clientes.size() + 1,
+                        std::vector<double>(clientes.size() + 1, 0.0));
+      for (size_t i = 0; i <= clientes.size(); ++i) {
+        int id_i = i == 0 ? depotId : clientes[i - 1].getId();
+        for (size_t j = 0; j <= clientes.size(); ++j) {
+          int id_j = j == 0 ? depotId : clientes[j - 1].getId();
+          pos_matrix[i][j] = dist_matrix[id_i][id_j];
+        }
+      }
+      pos_distances = std::make_shared<const ProveedorDistancias>(pos_matrix);
+      id_distances = std::make_shared<const ProveedorDistancias>(dist_matrix);
+    } else if (reader.hasDistanceMatrix()) {
+      // Compact copy of a matrix the reader had to build (explicit weights,
+      // ATT, GEO or a cache); the dense one is freed right away
+      id_distances = std::make_shared<const ProveedorDistancias>(
+          mapped_distances
+              ? ProveedorDistancias(mapped_distances, reader.getDimension() + 1)
+              : ProveedorDistancias(reader.getDistanceMatrix()),
+          storage);
+      reader.releaseDistanceMatrix();
+      pos_distances = id_distances->reindexar(id_at_pos);
+    } else {
+      std::vector<double> xs_by_id(reader.getDimension() + 1, 0.0);
+      std::vector<double> ys_by_id(reader.getDimension() + 1, 0.0);
+      for (const Node &node : nodes) {
+        xs_by_id[node.id] = node.x;
+        ys_by_id[node.id] = node.y;
+      }
+      ProveedorDistancias::Redondeo rounding =
+          reader.getEdgeWeightType() == EdgeWeightType::Ceil2D
+              ? ProveedorDistancias::Redondeo::HaciaArriba
+              : ProveedorDistancias::Redondeo::Ninguno;
+      id_distances = std::make_shared<const ProveedorDistancias>(
+          std::move(xs_by_id), std::move(ys_by_id), rounding);
+      if (compact_distances)
+        id_distances = std::make_shared<const ProveedorDistancias>(
+            *id_distances, storage);
+      pos_distances = id_distances->reindexar(id_at_pos);
+    }
+    std::unordered_map<int, int> id2pos;
+    id2pos[depotId] = 0;
+    for (size_t i = 0; i < clientes.size(); ++i)
+      id2pos[clientes[i].getId()] = i + 1;
+    // One position-indexed instance over pos_distances and id_distances,
+    // shared by the lower bound and the heuristic: no other copy of the
+    // distances is made. Built on first use (cw and ni work by id).
+    std::shared_ptr<const InstanciaCompacta> instance;
+    auto shared_instance = [&]() {
+      if (!instance)
+        instance = std::make_shared<const InstanciaCompacta>(
+            clientes, pos_distances, id_distances, id2pos, capacity, depotId,
+            num_vehicles);
+      return instance;
+    };
+    // Lower bound, computed once and only on request; with --gap it also
+    // stops the search.
+    // Its time is reported apart from the heuristic's.
+    double lower_bound = 0;
+    int min_vehicles = 0;
+    std::chrono::duration<double> lb_elapsed(0);
+    if (lower_bound_iterations > 0) {
+      auto lb_start = std::chrono::high_resolution_clock::now();
+      CotaInferior cota(*shared_instance());
+      cota.setIteraciones(lower_bound_iterations);
+      cota.calcular();
+      lower_bound = cota.getCotaCosto();
+      min_vehicles = cota.getVehiculosMinimos();
+      criterio.cotaInferior = lower_bound;
+      lb_elapsed = std::chrono::high_resolution_clock::now() - lb_start;
+    }
+    Solucion solucion(clientes, id_distances, num_vehicles);
     std::string status = "ok";
     std::string msg = "";
     double cost = -1;
     int num_routes = -1;
     // --- Heuristic selection ---
     if (heuristic == "cw") {
-      HeuristicaClarkeWright heur(clientes, dist_matrix, capacity, depotId,
+      HeuristicaClarkeWright heur(clientes, id_distances, capacity, depotId,
                                   num_vehicles);
       solucion = heur.resolver();
     } else if (heuristic == "ni") {
-      std::unordered_map<int, int> id2pos;
-      id2pos[depotId] = 0;
-      for (size_t i = 0; i < clientes.size(); ++i) {
-        id2pos[clientes[i].getId()] = i + 1;
-      }
-      HeuristicaInsercionCercana heur(clientes, dist_matrix, id2pos, capacity,
+      HeuristicaInsercionCercana heur(clientes, id_distances, capacity,
                                       depotId, num_vehicles);
       solucion = heur.resolver();
     } else if (heuristic == "grasp") {
-      std::unordered_map<int, int> id2pos;
-      id2pos[depotId] = 0;
-      for (size_t i = 0; i < clientes.size(); ++i) {
-        id2pos[clientes[i].getId()] = i + 1;
+      GRASP grasp(shared_instance(), nullptr, grasp_iters, grasp_kRCL, seed);
+      grasp.setNumHilos(threads);
+      grasp.setCriterioParada(criterio);
+      if (!reactive_k.empty())
+        grasp.setReactivo(reactive_k, reactive_period);
+      if (elite_pool > 0)
+        grasp.setPathRelinking(elite_pool);
+      if (exact_route_size >= 0)
+        grasp.setOptimizarRutas(exact_route_size);
+      if (recombination > 0)
+        grasp.setRecombinacion(recombination);
+      if (skip_duplicates)
+        grasp.setDetectarDuplicados(true);
+      if (pipeline_builders >= 0)
+        grasp.setPipeline(pipeline_builders, pipeline_filter);
+      if (emit_improvements) {
+        grasp.setAlMejorar([](const Solucion &mejor, double t) {
+          std::cout << "improvement:" << t << " " << mejor.getCostoTotal()
+                    << std::endl;
+        });
       }
-      GRASP grasp(clientes, dist_matrix, id2pos, capacity, depotId,
-                  num_vehicles, grasp_iters, grasp_kRCL);
       solucion = grasp.resolver();
+      grasp_iters = static_cast<int>(grasp.getIteracionesRealizadas());
+      grasp_skipped = grasp.getIteracionesOmitidas();
+      if (pipeline_builders >= 0)
+        std::cout << "filtered_iterations:"
+                  << grasp.getIteracionesFiltradas() << std::endl;
+      if (elite_pool > 0)
+        std::cout << "relinking_improvements:"
+                  << grasp.getMejorasPorRelinking() << std::endl;
+      if (recombination > 0)
+        std::cout << "recombination_improvements:"
+                  << grasp.getMejorasPorRecombinacion() << std::endl;
+      if (!reactive_k.empty()) {
+        std::cout << "k_probs:";
+        for (size_t i = 0; i < grasp.getValoresK().size(); ++i) {
+          std::cout << (i ? "," : "") << grasp.getValoresK()[i] << "="
+                    << grasp.getProbabilidadesK()[i];
+        }
+        std::cout << std::endl;
+      }
+    } else if (heuristic == "sa") {
+      SimulatedAnnealing sa(shared_instance(), seed);
+      sa.setEnfriamiento(cooling == "adaptive"
+                             ? SimulatedAnnealing::Enfriamiento::Adaptativo
+                             : SimulatedAnnealing::Enfriamiento::Geometrico,
+                         alpha);
+      sa.setMaxMovimientos(max_moves);
+      sa.setCriterioParada(criterio);
+      if (emit_improvements) {
+        sa.setAlMejorar([](const Solucion &mejor, double t) {
+          std::cout << "improvement:" << t << " " << mejor.getCostoTotal()
+                    << std::endl;
+        });
+      }
+      solucion = sa.resolver();
+      std::cout << "moves:" << sa.getMovimientosRealizados() << std::endl;
+      std::cout << "accepted_moves:" << sa.getMovimientosAceptados()
+                << std::endl;
+    } else if (heuristic == "tabu") {
+      TabuSearch tabu(shared_instance(), seed);
+      tabu.setMaxIteraciones(max_iterations);
+      tabu.setCriterioParada(criterio);
+      if (emit_improvements) {
+        tabu.setAlMejorar([](const Solucion &mejor, double t) {
+          std::cout << "improvement:" << t << " " << mejor.getCostoTotal()
+                    << std::endl;
+        });
+      }
+      solucion = tabu.resolver();
+      std::cout << "iterations:" << tabu.getIteracionesRealizadas()
+                << std::endl;
+      iterations_per_second = tabu.getIteracionesPorSegundo();
+    } else if (heuristic == "ils") {
+      IteratedLocalSearch ils(shared_instance(), nullptr, seed);
+      ils.setPerturbacion(perturbation == "bridge"
+                              ? IteratedLocalSearch::Perturbacion::DobleBridge
+                              : IteratedLocalSearch::Perturbacion::MultiRelocate,
+                          strength);
+      ils.setAceptacion(acceptance == "threshold"
+                            ? IteratedLocalSearch::Aceptacion::Umbral
+                        : acceptance == "always"
+                            ? IteratedLocalSearch::Aceptacion::Siempre
+                            : IteratedLocalSearch::Aceptacion::Mejor,
+                        threshold);
+      ils.setMaxIteraciones(max_iterations);
+      ils.setCriterioParada(criterio);
+      if (emit_improvements) {
+        ils.setAlMejorar([](const Solucion &mejor, double t) {
+          std::cout << "improvement:" << t << " " << mejor.getCostoTotal()
+                    << std::endl;
+        });
+      }
+      solucion = ils.resolver();
+      std::cout << "iterations:" << ils.getIteracionesRealizadas()
+                << std::endl;
+    } else if (heuristic == "sisr") {
+      SISR sisr(shared_instance(), seed);
+      sisr.setRuina(removal_avg, max_string);
+      sisr.setMaxIteraciones(max_iterations);
+      sisr.setCriterioParada(criterio);
+      if (emit_improvements) {
+        sisr.setAlMejorar([](const Solucion &mejor, double t) {
+          std::cout << "improvement:" << t << " " << mejor.getCostoTotal()
+                    << std::endl;
+        });
+      }
+      solucion = sisr.resolver();
+      std::cout << "iterations:" << sisr.getIteracionesRealizadas()
+                << std::endl;
+    } else if (heuristic == "alns") {
+      ALNS alns(shared_instance(), seed);
+      alns.setMaxIteraciones(max_iterations);
+      alns.setCriterioParada(criterio);
+      if (emit_improvements) {
+        alns.setAlMejorar([](const Solucion &mejor, double t) {
+          std::cout << "improvement:" << t << " " << mejor.getCostoTotal()
+                    << std::endl;
+        });
+      }
+      solucion = alns.resolver();
+      std::cout << "iterations:" << alns.getIteracionesRealizadas()
+                << std::endl;
+      iterations_per_second = alns.getIteracionesPorSegundo();
+      std::vector<std::string> names = alns.getNombresDestruccion();
+      std::vector<double> weights = alns.getPesosDestruccion();
+      for (size_t i = 0; i < names.size(); ++i)
+        std::cout << "destroy_weight:" << names[i] << " " << weights[i]
+                  << std::endl;
+      names = alns.getNombresReparacion();
+      weights = alns.getPesosReparacion();
+      for (size_t i = 0; i < names.size(); ++i)
+        std::cout << "repair_weight:" << names[i] << " " << weights[i]
+                  << std::endl;
+    } else if (heuristic == "hgs") {
+      HybridGeneticSearch hgs(shared_instance(), seed);
+      hgs.setPoblacion(population);
+      hgs.setMaxIteraciones(max_iterations);
+      hgs.setCriterioParada(criterio);
+      if (emit_improvements) {
+        hgs.setAlMejorar([](const Solucion &mejor, double t) {
+          std::cout << "improvement:" << t << " " << mejor.getCostoTotal()
+                    << std::endl;
+        });
+      }
+      solucion = hgs.resolver();
+      std::cout << "iterations:" << hgs.getIteracionesRealizadas()
+                << std::endl;
+      std::cout << "restarts:" << hgs.getReinicios() << std::endl;
+    } else if (heuristic == "islands") {
+      std::vector<ModeloIslas::Algoritmo> algorithms;
+      size_t from = 0;
+      while (from < island_algorithms.size()) {
+        size_t comma = island_algorithms.find(',', from);
+        if (comma == std::string::npos)
+          comma = island_algorithms.size();
+        std::string name = island_algorithms.substr(from, comma - from);
+        if (name == "grasp")
+          algorithms.push_back(ModeloIslas::Algoritmo::GRASP);
+        else if (name == "ils")
+          algorithms.push_back(ModeloIslas::Algoritmo::ILS);
+        else if (name == "sa")
+          algorithms.push_back(ModeloIslas::Algoritmo::SA);
+        from = comma + 1;
+      }
+      ModeloIslas islands(shared_instance(), seed);
+      islands.setIslas(threads);
+      islands.setAlgoritmos(algorithms);
+      islands.setPeriodoMigracion(migration_period);
+      islands.setCriterioParada(criterio);
+      if (emit_improvements) {
+        islands.setAlMejorar([](const Solucion &mejor, double t) {
+          std::cout << "improvement:" << t << " " << mejor.getCostoTotal()
+                    << std::endl;
+        });
+      }
+      solucion = islands.resolver();
+      std::cout << "islands:" << islands.getCantidadIslas() << std::endl;
+      std::cout << "periods:" << islands.getPeriodos() << std::endl;
+      std::cout << "migrations:" << islands.getMigraciones() << std::endl;
+    } else if (heuristic == "portfolio") {
+      Portafolio portfolio(shared_instance(), seed);
+      portfolio.setNumHilos(threads);
+      portfolio.setGRASP(grasp_iters, grasp_kRCL);
+      portfolio.setCriterioParada(criterio);
+      if (emit_improvements) {
+        portfolio.setAlMejorar([](const Solucion &mejor, double t) {
+          std::cout << "improvement:" << t << " " << mejor.getCostoTotal()
+                    << std::endl;
+        });
+      }
+      solucion = portfolio.resolver();
+      for (const Portafolio::Resultado &r : portfolio.getResultados())
+        std::cout << "member:" << r.nombre << " " << r.costo << " "
+                  << r.segundos << (r.cancelado ? " cancelled" : " done")
+                  << std::endl;
+      std::cout << "winner:" << portfolio.getGanador() << std::endl;
     } else {
       print_result(instance_path, capacity, total_demand, heuristic,
                    local_search, -1, -1, 0, "error", "Unknown heuristic");
@@ -140,7 +601,7 @@ int main(int argc, char *argv[]) {
       }
     }
     auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> elapsed = end - start;
+    std::chrono::duration<double> elapsed = end - start - lb_elapsed;
     // --- Check solution ---
     if (!solucion.esFactible() || !solucion.vistoTodos()) {
       status = "infeasible";
@@ -150,10 +611,32 @@ int main(int argc, char *argv[]) {
     num_routes = solucion.getRutas().size();
     print_result(instance_path, capacity, total_demand, heuristic, local_search,
                  cost, num_routes, elapsed.count(), status, msg);
+    if (heuristic == "grasp" || heuristic == "sa" || heuristic == "tabu" ||
+        heuristic == "ils" || heuristic == "sisr" || heuristic == "alns" ||
+        heuristic == "hgs" || heuristic == "islands" ||
+        heuristic == "portfolio")
+      std::cout << "seed:" << seed << std::endl;
+    if (lower_bound_iterations > 0) {
+      std::cout << "lower_bound:" << lower_bound << std::endl;
+      std::cout << "min_vehicles:" << min_vehicles << std::endl;
+      std::cout << "lower_bound_time:" << lb_elapsed.count() << std::endl;
+      if (status == "ok" && lower_bound > 0)
+        std::cout << "lower_bound_gap:"
+                  << 100 * (cost - lower_bound) / lower_bound << std::endl;
+    }
+    if (heuristic == "grasp") {
+      std::cout << "iterations:" << grasp_iters << std::endl;
+      std::cout << "skipped_iterations:" << grasp_skipped << std::endl;
+      if (elapsed.count() > 0)
+        iterations_per_second = grasp_iters / elapsed.count();
+    }
+    if (iterations_per_second >= 0)
+      std::cout << "iterations_per_second:" << iterations_per_second
+                << std::endl;
     return (status == "ok") ? 0 : 1;
   } catch (const std::exception &e) {
-    print_result(argv[1], -1, -1, argc > 2 ? argv[2] : "",
-                 argc > 3 ? argv[3] : "", -1, -1, 0, "error", e.what());
+    print_result(args[0], -1, -1, args[1], args[2], -1, -1, 0, "error",
+                 e.what());
     return 2;
   }
 }
@@ -11,16 +11,21 @@ LOCAL_SEARCH = ["none", "swap", "relocate", "both"]
 
 CSV_FILE = "experiments/results/output.csv"
 
+SEED = 12345  # Semilla fija para que las corridas sean reproducibles
+THREADS = os.cpu_count() or 1  # GRASP reparte las iteraciones entre hilos
+CACHE_DIR = "experiments/cache"  # instancias ya leídas (.cvrpbin), compartidas entre corridas
+
 def parse_output(output):
     result = {}
     for line in output.splitlines():
         if ':' in line:
             key, value = line.split(':', 1)
             result[key.strip()] = value.strip()
-    for k in ["capacity", "total_demand", "cost", "num_routes", "time"]:
+    for k in ["capacity", "total_demand", "cost", "num_routes", "time",
+              "lower_bound", "min_vehicles", "lower_bound_gap"]:
         if k in result:
             try:
-                if k in ["capacity", "total_demand", "num_routes"]:
+                if k in ["capacity", "total_demand", "num_routes", "min_vehicles"]:
                     result[k] = int(float(result[k]))
                 else:
                     result[k] = float(result[k])
@@ -90,13 +95,15 @@ def get_num_clientes(instance_file):
     return num_clientes
 
 def run_experiment(instance_file, heuristic, local_search):
-    args = ["build/bin/main_experiment", os.path.join(INSTANCE_DIR, instance_file), heuristic]
+    args = ["build/bin/main_experiment", os.path.join(INSTANCE_DIR, instance_file), heuristic,
+            "--cache", CACHE_DIR, "--lower-bound"]
     if heuristic != "grasp":
         args.append(local_search)
     else:
         args.append("none")
         args.append("1000")  # Iteraciones
         args.append("5")   # rcl_size
+        args += ["--seed", str(SEED), "--threads", str(THREADS)]
     proc = subprocess.run(
         args,
         stdout=subprocess.PIPE,
@@ -133,7 +140,8 @@ def main():
     with open(CSV_FILE, "w", newline="") as f:
         writer = csv.DictWriter(f, fieldnames=[
             "instance", "capacity", "total_demand", "num_clientes", "heuristic", "local_search",
-            "cost", "num_routes", "time", "gap", "best_known", "status", "msg"
+            "cost", "num_routes", "time", "gap", "best_known", "lower_bound",
+            "lower_bound_gap", "min_vehicles", "seed", "status", "msg"
         ])
         writer.writeheader()
         for row in results:
@@ -0,0 +1,642 @@
+#include "ALNS.h"
+#include "InsercionCercana.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+
+// Largo de las listas de vecinos de la destrucción relacionada, y cuántos
+// de ellos definen las rutas candidatas al reinsertar
+static const int VECINOS_RELACIONADOS = 50;
+static const int VECINOS_INSERCION = 20;
+
+// Iteraciones por cliente cuando no hay otro límite
+static const int ITERACIONES_POR_CLIENTE = 100;
+
+// Aleatorización de las destrucciones por peor costo y relacionada: se
+// elige el candidato floor(y^p * cantidad) con y uniforme en [0, 1)
+static const double EXPONENTE_PEOR_COSTO = 3;
+static const double EXPONENTE_RELACIONADA = 6;
+
+// Temperatura final relativa a la inicial
+static const double COCIENTE_TEMPERATURA_FINAL = 0.01;
+
+// Penalización por ruta de más, relativa a la mayor distancia al depósito
+static const double PENALIZACION_RUTA_RELATIVA = 10.0;
+
+// Ningún operador deja de sortearse del todo
+static const double PESO_MINIMO = 0.1;
+
+static const double INFINITO = numeric_limits<double>::max();
+
+// Arrepentimiento por cada una de las k mejores rutas que falta
+static const double REGRET_SIN_OPCION = 1e15;
+
+ALNS::ALNS(
+    const vector<Cliente>& clientes,
+    const vector<vector<double>>& distMatrix,
+    const unordered_map<int, int>& id2pos,
+    int capacidadVehiculo,
+    int depotId,
+    int numVehiculos,
+    uint64_t semilla)
+    : ALNS(clientes, make_shared<const ProveedorDistancias>(distMatrix), id2pos,
+           capacidadVehiculo, depotId, numVehiculos, semilla)
+{}
+
+ALNS::ALNS(
+    const vector<Cliente>& clientes,
+    shared_ptr<const ProveedorDistancias> distancias,
+    const unordered_map<int, int>& id2pos,
+    int capacidadVehiculo,
+    int depotId,
+    int numVehiculos,
+    uint64_t semilla)
+    : ALNS(make_shared<const InstanciaCompacta>(clientes, move(distancias), id2pos,
+                                                capacidadVehiculo, depotId, numVehiculos),
+           semilla)
+{}
+
+ALNS::ALNS(shared_ptr<const InstanciaCompacta> compartida, uint64_t semilla)
+    : clientes(compartida->getClientes()),
+      semilla(semilla),
+      instancia(move(compartida)),
+      inst(*instancia),
+      vecinos(inst.getDistancias(), VECINOS_RELACIONADOS),
+      minQuitados(0),
+      maxQuitados(0),
+      largoSegmento(100),
+      reaccion(0.1),
+      puntajeMejor(33),
+      puntajeMejora(9),
+      puntajeAceptada(13),
+      peorAceptadoInicial(0.05),
+      maxIteraciones(0),
+      mejorCosto(INFINITO),
+      iteracionesRealizadas(0),
+      iteracionesPorSegundo(0),
+      penalizacionRuta(0)
+{
+    double maxDeposito = 0;
+    for (int pos : inst.getPosClientes()) {
+        maxDeposito = max(maxDeposito, inst.dist(inst.getPosDeposito(), pos));
+    }
+    penalizacionRuta = PENALIZACION_RUTA_RELATIVA * maxDeposito;
+    registrarOperadores();
+}
+
+void ALNS::registrarOperadores() {
+    agregarDestruccion("aleatoria", [this](EdicionSolucion& ed, int q, GeneradorAleatorio& rng) {
+        destruirAleatoria(ed, q, rng);
+    });
+    agregarDestruccion("peor-costo", [this](EdicionSolucion& ed, int q, GeneradorAleatorio& rng) {
+        destruirPeorCosto(ed, q, rng);
+    });
+    agregarDestruccion("relacionada", [this](EdicionSolucion& ed, int q, GeneradorAleatorio& rng) {
+        destruirRelacionada(ed, q, rng);
+    });
+    agregarDestruccion("ruta", [this](EdicionSolucion& ed, int q, GeneradorAleatorio& rng) {
+        destruirRuta(ed, q, rng);
+    });
+    agregarReparacion("greedy", [this](EdicionSolucion& ed, GeneradorAleatorio&) {
+        repararRegret(ed, 1);
+    });
+    agregarReparacion("regret-2", [this](EdicionSolucion& ed, GeneradorAleatorio&) {
+        repararRegret(ed, 2);
+    });
+    agregarReparacion("regret-3", [this](EdicionSolucion& ed, GeneradorAleatorio&) {
+        repararRegret(ed, 3);
+    });
+    agregarReparacion("cercana", [this](EdicionSolucion& ed, GeneradorAleatorio&) {
+        repararCercana(ed);
+    });
+}
+
+double ALNS::costoPenalizado(const SolucionCompacta& sol) const {
+    int exceso = sol.getCantRutasNoVacias() - inst.getNumVehiculos();
+    if (exceso <= 0)
+        return sol.getCosto();
+    return sol.getCosto() + exceso * penalizacionRuta;
+}
+
+int ALNS::elegir(const vector<Operador>& operadores, GeneradorAleatorio& rng) const {
+    double total = 0;
+    for (const Operador& op : operadores) total += op.peso;
+    double u = rng.real01() * total;
+    for (size_t i = 0; i < operadores.size(); ++i) {
+        u -= operadores[i].peso;
+        if (u < 0)
+            return static_cast<int>(i);
+    }
+    return static_cast<int>(operadores.size()) - 1;
+}
+
+void ALNS::actualizarPesos(vector<Operador>& operadores) const {
+    for (Operador& op : operadores) {
+        if (op.usos > 0) {
+            op.peso = max(PESO_MINIMO, (1 - reaccion) * op.peso + reaccion * op.puntaje / op.usos);
+        }
+        op.puntaje = 0;
+        op.usos = 0;
+    }
+}
+
+void ALNS::ubicarPendientes(EdicionSolucion& edicion) const {
+    while (!edicion.getQuitados().empty()) {
+        int c = edicion.getQuitados().back();
+        int indice = 0;
+        int r = mejorRutaGlobal(edicion.getSolucion(), c, indice);
+        if (r < 0) {
+            r = edicion.abrirRuta();
+            indice = 0;
+        }
+        edicion.insertar(r, indice, c);
+    }
+}
+
+// --- Destrucción ---
+
+void ALNS::destruirAleatoria(EdicionSolucion& edicion, int cantidad, GeneradorAleatorio& rng) {
+    const vector<int>& posClientes = inst.getPosClientes();
+    int n = static_cast<int>(posClientes.size());
+    cantidad = min(cantidad, n);
+    while (static_cast<int>(edicion.getQuitados().size()) < cantidad) {
+        int c = posClientes[rng.enteroEn(n)];
+        if (edicion.getSolucion().getRutaDe(c) >= 0)
+            edicion.quitar(c);
+    }
+}
+
+void ALNS::destruirPeorCosto(EdicionSolucion& edicion, int cantidad, GeneradorAleatorio& rng) {
+    // Los clientes cuya remoción más ahorra, con un sorteo sesgado hacia
+    // los primeros para no quitar siempre los mismos
+    const SolucionCompacta& sol = edicion.getSolucion();
+    candidatos.clear();
+    for (int c : inst.getPosClientes()) {
+        int r = sol.getRutaDe(c);
+        if (r >= 0)
+            candidatos.emplace_back(sol.deltaRemover(r, sol.getIndiceEn(c)), c);
+    }
+    sort(candidatos.begin(), candidatos.end());
+    for (int k = 0; k < cantidad && !candidatos.empty(); ++k) {
+        int i = static_cast<int>(pow(rng.real01(), EXPONENTE_PEOR_COSTO) * candidatos.size());
+        edicion.quitar(candidatos[i].second);
+        candidatos.erase(candidatos.begin() + i);
+    }
+}
+
+void ALNS::destruirRelacionada(EdicionSolucion& edicion, int cantidad, GeneradorAleatorio& rng) {
+    // Shaw: cada cliente quitado se elige entre los vecinos más cercanos de
+    // uno ya quitado, sesgado hacia los más cercanos
+    const SolucionCompacta& sol = edicion.getSolucion();
+    const vector<int>& posClientes = inst.getPosClientes();
+    int n = static_cast<int>(posClientes.size());
+    cantidad = min(cantidad, n);
+    while (static_cast<int>(edicion.getQuitados().size()) < cantidad) {
+        const vector<int>& quitados = edicion.getQuitados();
+        pendientes.clear();
+        if (!quitados.empty()) {
+            int referencia = quitados[rng.enteroEn(static_cast<int>(quitados.size()))];
+            const int* lista = vecinos.getVecinos(referencia);
+            for (int k = 0; k < vecinos.getCantidadVecinos(); ++k) {
+                if (inst.esCliente(lista[k]) && sol.getRutaDe(lista[k]) >= 0)
+                    pendientes.push_back(lista[k]);
+            }
+        }
+        if (pendientes.empty()) {
+            int c = posClientes[rng.enteroEn(n)];
+            if (sol.getRutaDe(c) >= 0)
+                edicion.quitar(c);
+            continue;
+        }
+        int i = static_cast<int>(pow(rng.real01(), EXPONENTE_RELACIONADA) * pendientes.size());
+        edicion.quitar(pendientes[i]);
+    }
+}
+
+void ALNS::destruirRuta(EdicionSolucion& edicion, int cantidad, GeneradorAleatorio& rng) {
+    // Rutas enteras al azar hasta juntar al menos `cantidad` clientes
+    const SolucionCompacta& sol = edicion.getSolucion();
+    pendientes.clear();
+    for (int r = 0; r < sol.getCantRutas(); ++r) {
+        if (!sol.getRuta(r).empty())
+            pendientes.push_back(r);
+    }
+    shuffle(pendientes.begin(), pendientes.end(), rng);
+    for (int r : pendientes) {
+        while (!sol.getRuta(r).empty())
+            edicion.quitar(sol.getRuta(r).back());
+        if (static_cast<int>(edicion.getQuitados().size()) >= cantidad)
+            break;
+    }
+}
+
+// --- Reparación ---
+
+int ALNS::primeraRutaVacia(const SolucionCompacta& sol) const {
+    for (int r = 0; r < sol.getCantRutas(); ++r) {
+        if (sol.getRuta(r).empty())
+            return r;
+    }
+    return -1;
+}
+
+void ALNS::prepararCandidatas(const SolucionCompacta& sol, int p, int rutaVacia) {
+    // Rutas de los vecinos más cercanos, más una ruta vacía
+    int c = pendientes[p];
+    vector<int>& rutas = rutasPorPendiente[p];
+    rutas.clear();
+    const int* lista = vecinos.getVecinos(c);
+    int largo = min(VECINOS_INSERCION, vecinos.getCantidadVecinos());
+    for (int k = 0; k < largo; ++k) {
+        int r = inst.esCliente(lista[k]) ? sol.getRutaDe(lista[k]) : -1;
+        if (r >= 0 && find(rutas.begin(), rutas.end(), r) == rutas.end())
+            rutas.push_back(r);
+    }
+    if (rutaVacia >= 0)
+        rutas.push_back(rutaVacia);
+    deltaPorRuta[p].resize(rutas.size());
+    indicePorRuta[p].resize(rutas.size());
+    for (size_t j = 0; j < rutas.size(); ++j) calcularInsercion(sol, p, static_cast<int>(j));
+}
+
+void ALNS::calcularInsercion(const SolucionCompacta& sol, int p, int j) {
+    int c = pendientes[p];
+    int r = rutasPorPendiente[p][j];
+    if (sol.getCarga(r) + inst.getDemanda(c) > inst.getCapacidad()) {
+        deltaPorRuta[p][j] = INFINITO;
+        return;
+    }
+    double delta;
+    indicePorRuta[p][j] = sol.mejorInsercion(r, c, delta);
+    deltaPorRuta[p][j] = delta;
+}
+
+int ALNS::mejorRutaGlobal(const SolucionCompacta& sol, int c, int& indice) const {
+    int mejorRuta = -1;
+    double mejorDelta = INFINITO;
+    for (int r = 0; r < sol.getCantRutas(); ++r) {
+        if (sol.getCarga(r) + inst.getDemanda(c) > inst.getCapacidad())
+            continue;
+        double delta;
+        int i = sol.mejorInsercion(r, c, delta);
+        if (delta < mejorDelta) {
+            mejorDelta = delta;
+            mejorRuta = r;
+            indice = i;
+        }
+    }
+    return mejorRuta;
+}
+
+void ALNS::repararRegret(EdicionSolucion& edicion, int k) {
+    // k = 1 es la inserción greedy: siempre el cliente más barato de ubicar.
+    // Con k > 1 primero el de mayor arrepentimiento, la suma de lo que se
+    // pierde si no va a su mejor ruta sino a la 2da, ..., k-ésima. Sólo se
+    // evalúan las rutas de los vecinos cercanos de cada cliente (y una
+    // vacía), y tras cada inserción sólo se recalcula la ruta que cambió.
+    const SolucionCompacta& sol = edicion.getSolucion();
+    pendientes.assign(edicion.getQuitados().begin(), edicion.getQuitados().end());
+    int cantidad = static_cast<int>(pendientes.size());
+    if (static_cast<int>(rutasPorPendiente.size()) < cantidad) {
+        rutasPorPendiente.resize(cantidad);
+        deltaPorRuta.resize(cantidad);
+        indicePorRuta.resize(cantidad);
+    }
+    int rutaVacia = primeraRutaVacia(sol);
+    for (int p = 0; p < cantidad; ++p) prepararCandidatas(sol, p, rutaVacia);
+
+    mejores.resize(k);
+    while (cantidad > 0) {
+        int elegido = -1, rutaElegida = -1, indice = 0;
+        double mejorClave = 0, mejorDeltaElegido = INFINITO;
+        for (int p = 0; p < cantidad; ++p) {
+            int encontradas = 0, jMejor = -1;
+            fill(mejores.begin(), mejores.end(), INFINITO);
+            for (size_t j = 0; j < rutasPorPendiente[p].size(); ++j) {
+                double delta = deltaPorRuta[p][j];
+                if (delta == INFINITO)
+                    continue;
+                encontradas++;
+                for (int h = 0; h < k; ++h) {
+                    if (delta < mejores[h]) {
+                        for (int m = k - 1; m > h; --m) mejores[m] = mejores[m - 1];
+                        mejores[h] = delta;
+                        if (h == 0) jMejor = static_cast<int>(j);
+                        break;
+                    }
+                }
+            }
+            if (encontradas == 0) {
+                // Ninguna ruta cercana lo admite: va primero, a donde entre
+                elegido = p;
+                rutaElegida = mejorRutaGlobal(sol, pendientes[p], indice);
+                break;
+            }
+            double clave = -mejores[0];
+            if (k > 1) {
+                clave = 0;
+                for (int h = 1; h < k; ++h)
+                    clave += (mejores[h] == INFINITO) ? REGRET_SIN_OPCION : mejores[h] - mejores[0];
+            }
+            if (elegido < 0 || clave > mejorClave ||
+                (clave == mejorClave && mejores[0] < mejorDeltaElegido)) {
+                elegido = p;
+                rutaElegida = rutasPorPendiente[p][jMejor];
+                indice = indicePorRuta[p][jMejor];
+                mejorClave = clave;
+                mejorDeltaElegido = mejores[0];
+            }
+        }
+
+        int c = pendientes[elegido];
+        if (rutaElegida < 0) {
+            rutaElegida = edicion.abrirRuta();
+            indice = 0;
+        }
+        edicion.insertar(rutaElegida, indice, c);
+
+        cantidad--;
+        swap(pendientes[elegido], pendientes[cantidad]);
+        swap(rutasPorPendiente[elegido], rutasPorPendiente[cantidad]);
+        swap(deltaPorRuta[elegido], deltaPorRuta[cantidad]);
+        swap(indicePorRuta[elegido], indicePorRuta[cantidad]);
+        pendientes.pop_back();
+
+        // Si se llenó la ruta vacía, los demás pasan a tener la siguiente
+        bool llenoVacia = (rutaElegida == rutaVacia);
+        if (llenoVacia)
+            rutaVacia = primeraRutaVacia(sol);
+        for (int p = 0; p < cantidad; ++p) {
+            vector<int>& rutas = rutasPorPendiente[p];
+            auto it = find(rutas.begin(), rutas.end(), rutaElegida);
+            if (it == rutas.end()) {
+                // La ruta pasa a ser candidata si c es vecino cercano de p
+                const int* lista = vecinos.getVecinos(pendientes[p]);
+                int largo = min(VECINOS_INSERCION, vecinos.getCantidadVecinos());
+                if (largo == 0 || inst.dist(pendientes[p], c) > inst.dist(pendientes[p], lista[largo - 1]))
+                    continue;
+                rutas.push_back(rutaElegida);
+                deltaPorRuta[p].push_back(INFINITO);
+                indicePorRuta[p].push_back(0);
+                it = rutas.end() - 1;
+            }
+            calcularInsercion(sol, p, static_cast<int>(it - rutas.begin()));
+            if (llenoVacia && rutaVacia >= 0) {
+                rutas.push_back(rutaVacia);
+                deltaPorRuta[p].push_back(INFINITO);
+                indicePorRuta[p].push_back(0);
+                calcularInsercion(sol, p, static_cast<int>(rutas.size()) - 1);
+            }
+        }
+    }
+}
+
+void ALNS::repararCercana(EdicionSolucion& edicion) {
+    // Criterio de Inserción Más Cercana: primero el quitado más cercano a
+    // algún nodo ya ruteado (o al depósito), en su mejor posición entre las
+    // rutas de sus vecinos cercanos
+    const SolucionCompacta& sol = edicion.getSolucion();
+    int deposito = inst.getPosDeposito();
+    if (rutasPorPendiente.empty()) {
+        rutasPorPendiente.resize(1);
+        deltaPorRuta.resize(1);
+        indicePorRuta.resize(1);
+    }
+    pendientes.resize(1);
+    while (!edicion.getQuitados().empty()) {
+        const vector<int>& quitados = edicion.getQuitados();
+        int elegido = -1;
+        double menorDistancia = INFINITO;
+        for (int c : quitados) {
+            double d = distanciaCercana(
+                inst.dist(deposito, c), vecinos.getVecinos(c), vecinos.getCantidadVecinos(), true,
+                [&](int v) { return inst.dist(c, v); },
+                [&](int v) { return inst.esCliente(v) && sol.getRutaDe(v) >= 0; });
+            if (d < menorDistancia) {
+                menorDistancia = d;
+                elegido = c;
+            }
+        }
+
+        pendientes[0] = elegido;
+        prepararCandidatas(sol, 0, primeraRutaVacia(sol));
+        int mejorRuta = -1, mejorIndice = 0;
+        double mejorDelta = INFINITO;
+        for (size_t j = 0; j < rutasPorPendiente[0].size(); ++j) {
+            if (deltaPorRuta[0][j] < mejorDelta) {
+                mejorDelta = deltaPorRuta[0][j];
+                mejorRuta = rutasPorPendiente[0][j];
+                mejorIndice = indicePorRuta[0][j];
+            }
+        }
+        if (mejorRuta < 0)
+            mejorRuta = mejorRutaGlobal(sol, elegido, mejorIndice);
+        if (mejorRuta < 0) {
+            mejorRuta = edicion.abrirRuta();
+            mejorIndice = 0;
+        }
+        edicion.insertar(mejorRuta, mejorIndice, elegido);
+    }
+}
+
+// --- Búsqueda ---
+
+Solucion ALNS::resolver() {
+    if (destrucciones.empty() || reparaciones.empty())
+        throw logic_error("ALNS sin operadores de destrucción o de reparación");
+
+    control.reiniciar();
+    iteracionesRealizadas = 0;
+    iteracionesPorSegundo = 0;
+    for (Operador& op : destrucciones) op = {op.nombre, 1.0, 0.0, 0};
+    for (Operador& op : reparaciones) op = {op.nombre, 1.0, 0.0, 0};
+
+    GeneradorAleatorio rng(semilla);
+    SolucionCompacta actual(inst);
+    if (solucionInicial) {
+        actual = SolucionCompacta(inst, inst.rutasDesde(*solucionInicial));
+        actual.eliminarRutasVacias();
+    }
+    actual.completar();
+
+    int n = inst.getCantClientes();
+    int minimo = minQuitados > 0 ? min(minQuitados, n) : min(4, n);
+    int maximo = maxQuitados > 0 ? min(maxQuitados, n)
+                                 : min(100, static_cast<int>(0.4 * n));
+    maximo = max(minimo, maximo);
+
+    double actualPenalizado = costoPenalizado(actual);
+    SolucionCompacta mejor = actual;
+    bool factible = actual.getCantRutasNoVacias() <= inst.getNumVehiculos();
+    mejorCosto = factible ? actual.getCosto() : INFINITO;
+    if (factible && control.objetivoAlcanzado(mejorCosto))
+        control.detener();
+
+    // Una solución peorAceptadoInicial peor que la inicial pasa con prob. 1/2
+    double t0 = max(1e-9, peorAceptadoInicial * actual.getCosto() / log(2.0));
+    double tf = t0 * COCIENTE_TEMPERATURA_FINAL;
+
+    double limiteTiempo = control.getCriterio().limiteTiempo;
+    long iteracionesTotales = maxIteraciones;
+    if (iteracionesTotales <= 0 && limiteTiempo <= 0)
+        iteracionesTotales = static_cast<long>(ITERACIONES_POR_CLIENTE) * max(1, n);
+
+    EdicionSolucion edicion(actual);
+    long sinMejora = 0;
+    while (n > 0 && !control.debeDetenerse()) {
+        if (iteracionesTotales > 0 && iteracionesRealizadas >= iteracionesTotales)
+            break;
+        double progreso = limiteTiempo > 0
+            ? min(1.0, control.segundos() / limiteTiempo)
+            : static_cast<double>(iteracionesRealizadas) / iteracionesTotales;
+        if (iteracionesTotales > 0 && limiteTiempo > 0)
+            progreso = max(progreso, static_cast<double>(iteracionesRealizadas) / iteracionesTotales);
+        double temperatura = t0 * pow(tf / t0, progreso);
+
+        int d = elegir(destrucciones, rng);
+        int rep = elegir(reparaciones, rng);
+        int cantidad = minimo + rng.enteroEn(maximo - minimo + 1);
+
+        edicion.comenzar();
+        funcionesDestruccion[d](edicion, cantidad, rng);
+        funcionesReparacion[rep](edicion, rng);
+        ubicarPendientes(edicion);
+        iteracionesRealizadas++;
+
+        double candidato = costoPenalizado(actual);
+        double puntaje = 0;
+        bool mejoraGlobal = false;
+        // Aceptación de recocido: c' < c - T ln U
+        double u = max(rng.real01(), 1e-300);
+        if (candidato < actualPenalizado - temperatura * log(u)) {
+            factible = actual.getCantRutasNoVacias() <= inst.getNumVehiculos();
+            if (factible && actual.getCosto() < mejorCosto - 1e-9) {
+                mejoraGlobal = true;
+                puntaje = puntajeMejor;
+            } else {
+                puntaje = candidato < actualPenalizado - 1e-9 ? puntajeMejora : puntajeAceptada;
+            }
+            actualPenalizado = candidato;
+        } else {
+            edicion.deshacer();
+        }
+
+        destrucciones[d].puntaje += puntaje;
+        destrucciones[d].usos++;
+        reparaciones[rep].puntaje += puntaje;
+        reparaciones[rep].usos++;
+        if (iteracionesRealizadas % largoSegmento == 0) {
+            actualizarPesos(destrucciones);
+            actualizarPesos(reparaciones);
+        }
+
+        if (mejoraGlobal) {
+            actual.recalcular();
+            actualPenalizado = costoPenalizado(actual);
+            mejor = actual;
+            mejorCosto = actual.getCosto();
+            sinMejora = 0;
+            if (alMejorar)
+                alMejorar(mejor.aSolucion(), control.segundos());
+            if (control.objetivoAlcanzado(mejorCosto))
+                control.detener();
+        } else {
+            sinMejora++;
+            if (control.sinMejoraAgotado(sinMejora))
+                control.detener();
+        }
+    }
+
+    double segundos = control.segundos();
+    if (segundos > 0)
+        iteracionesPorSegundo = iteracionesRealizadas / segundos;
+    return mejor.aSolucion();
+}
+
+void ALNS::setSolucionInicial(const Solucion& sol) {
+    solucionInicial.reset(new Solucion(sol));
+}
+
+int ALNS::agregarDestruccion(const string& nombre, Destruccion operador) {
+    destrucciones.push_back({nombre, 1.0, 0.0, 0});
+    funcionesDestruccion.push_back(move(operador));
+    return static_cast<int>(destrucciones.size()) - 1;
+}
+
+int ALNS::agregarReparacion(const string& nombre, Reparacion operador) {
+    reparaciones.push_back({nombre, 1.0, 0.0, 0});
+    funcionesReparacion.push_back(move(operador));
+    return static_cast<int>(reparaciones.size()) - 1;
+}
+
+void ALNS::quitarOperadores() {
+    destrucciones.clear();
+    funcionesDestruccion.clear();
+    reparaciones.clear();
+    funcionesReparacion.clear();
+}
+
+void ALNS::setCantidadQuitada(int minimo, int maximo) {
+    minQuitados = minimo;
+    maxQuitados = maximo;
+}
+
+void ALNS::setSegmento(int iteraciones, double factorReaccion) {
+    largoSegmento = iteraciones > 0 ? iteraciones : 100;
+    reaccion = factorReaccion;
+}
+
+void ALNS::setPuntajes(double mejor, double mejora, double aceptada) {
+    puntajeMejor = mejor;
+    puntajeMejora = mejora;
+    puntajeAceptada = aceptada;
+}
+
+void ALNS::setTemperaturaInicial(double peorRelativo) { peorAceptadoInicial = peorRelativo; }
+
+void ALNS::setMaxIteraciones(long iteraciones) { maxIteraciones = iteraciones; }
+
+void ALNS::setCriterioParada(const CriterioParada& criterio) {
+    control.setCriterio(criterio);
+}
+
+void ALNS::setAlMejorar(function<void(const Solucion&, double)> callback) {
+    alMejorar = move(callback);
+}
+
+void ALNS::detener() { control.detener(); }
+
+vector<string> ALNS::getNombresDestruccion() const {
+    vector<string> nombres;
+    for (const Operador& op : destrucciones) nombres.push_back(op.nombre);
+    return nombres;
+}
+
+vector<double> ALNS::getPesosDestruccion() const {
+    vector<double> pesos;
+    for (const Operador& op : destrucciones) pesos.push_back(op.peso);
+    return pesos;
+}
+
+vector<string> ALNS::getNombresReparacion() const {
+    vector<string> nombres;
+    for (const Operador& op : reparaciones) nombres.push_back(op.nombre);
+    return nombres;
+}
+
+vector<double> ALNS::getPesosReparacion() const {
+    vector<double> pesos;
+    for (const Operador& op : reparaciones) pesos.push_back(op.peso);
+    return pesos;
+}
+
+double ALNS::getMejorCosto() const { return mejorCosto; }
+
+long ALNS::getIteracionesRealizadas() const { return iteracionesRealizadas; }
+
+double ALNS::getIteracionesPorSegundo() const { return iteracionesPorSegundo; }
+
+uint64_t ALNS::getSemilla() const { return semilla; }
@@ -0,0 +1,161 @@
+#ifndef ALNS_H
+#define ALNS_H
+
+#include "Cliente.h"
+#include "Solucion.h"
+#include "InstanciaCompacta.h"
+#include "SolucionCompacta.h"
+#include "EdicionSolucion.h"
+#include "ListaVecinos.h"
+#include "GeneradorAleatorio.h"
+#include "CriterioParada.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// Búsqueda adaptativa de vecindarios grandes (ALNS). Cada iteración sortea
+// un operador de destrucción y uno de reparación con probabilidad
+// proporcional a su peso, los aplica en el lugar sobre la solución actual
+// (a través de EdicionSolucion) y acepta con un criterio de recocido; si se
+// rechaza, se deshace sólo lo que tocaron los operadores. Los pesos se
+// ajustan al final de cada segmento según el puntaje que juntó cada
+// operador (nueva mejor, mejora a la actual, aceptada).
+class ALNS {
+public:
+    // Quita `cantidad` clientes (con edicion.quitar)
+    using Destruccion = function<void(EdicionSolucion& edicion, int cantidad, GeneradorAleatorio& rng)>;
+    // Reinserta los quitados; los que queden sin ubicar van a la mejor
+    // posición factible o a una ruta nueva
+    using Reparacion = function<void(EdicionSolucion& edicion, GeneradorAleatorio& rng)>;
+
+private:
+    struct Operador {
+        string nombre;
+        double peso;
+        double puntaje;
+        long usos;
+    };
+
+    const vector<Cliente>& clientes;
+    uint64_t semilla;
+
+    // Propia o compartida con otros solvers (sólo se lee)
+    shared_ptr<const InstanciaCompacta> instancia;
+    const InstanciaCompacta& inst;
+    ListaVecinos vecinos;
+    unique_ptr<Solucion> solucionInicial;
+
+    vector<Operador> destrucciones;
+    vector<Destruccion> funcionesDestruccion;
+    vector<Operador> reparaciones;
+    vector<Reparacion> funcionesReparacion;
+
+    int minQuitados;
+    int maxQuitados;
+    int largoSegmento;
+    double reaccion;
+    double puntajeMejor;
+    double puntajeMejora;
+    double puntajeAceptada;
+    double peorAceptadoInicial;  // relativo al costo inicial
+    long maxIteraciones;
+
+    ControlParada control;
+    function<void(const Solucion&, double)> alMejorar;
+
+    double mejorCosto;
+    long iteracionesRealizadas;
+    double iteracionesPorSegundo;
+    double penalizacionRuta;
+
+    // Memoria de trabajo de los operadores, reutilizada entre iteraciones
+    vector<pair<double, int>> candidatos;
+    vector<int> pendientes;
+    vector<vector<int>> rutasPorPendiente;  // rutas candidatas de cada pendiente
+    vector<vector<double>> deltaPorRuta;    // alineados con rutasPorPendiente
+    vector<vector<int>> indicePorRuta;
+    vector<double> mejores;                 // k mejores deltas en regret-k
+
+    void registrarOperadores();
+    int elegir(const vector<Operador>& operadores, GeneradorAleatorio& rng) const;
+    void actualizarPesos(vector<Operador>& operadores) const;
+    double costoPenalizado(const SolucionCompacta& sol) const;
+    void ubicarPendientes(EdicionSolucion& edicion) const;
+    int primeraRutaVacia(const SolucionCompacta& sol) const;
+    int mejorRutaGlobal(const SolucionCompacta& sol, int c, int& indice) const;
+
+    void destruirAleatoria(EdicionSolucion& edicion, int cantidad, GeneradorAleatorio& rng);
+    void destruirPeorCosto(EdicionSolucion& edicion, int cantidad, GeneradorAleatorio& rng);
+    void destruirRelacionada(EdicionSolucion& edicion, int cantidad, GeneradorAleatorio& rng);
+    void destruirRuta(EdicionSolucion& edicion, int cantidad, GeneradorAleatorio& rng);
+    void repararRegret(EdicionSolucion& edicion, int k);
+    void repararCercana(EdicionSolucion& edicion);
+    void prepararCandidatas(const SolucionCompacta& sol, int p, int rutaVacia);
+    void calcularInsercion(const SolucionCompacta& sol, int p, int j);
+
+public:
+    ALNS(const vector<Cliente>& clientes,
+         const vector<vector<double>>& distMatrix,
+         const unordered_map<int, int>& id2pos,
+         int capacidadVehiculo,
+         int depotId,
+         int numVehiculos,
+         uint64_t semilla = 0);
+    // Igual, con distancias por posición de cualquier proveedor (con uno por
+    // coordenadas no se arma ninguna matriz de n^2)
+    ALNS(const vector<Cliente>& clientes,
+         shared_ptr<const ProveedorDistancias> distancias,
+         const unordered_map<int, int>& id2pos,
+         int capacidadVehiculo,
+         int depotId,
+         int numVehiculos,
+         uint64_t semilla = 0);
+    // Sobre una instancia ya armada, que puede compartirse entre varios
+    // solvers
+    ALNS(shared_ptr<const InstanciaCompacta> instancia, uint64_t semilla = 0);
+
+    // La temperatura baja a lo largo de la corrida (por tiempo si hay límite
+    // de tiempo, si no por iteraciones). Sin límite de tiempo ni de
+    // iteraciones se hacen 100 por cliente.
+    Solucion resolver();
+
+    // Por defecto se parte de insertar a todos en su mejor posición
+    void setSolucionInicial(const Solucion& sol);
+
+    // Vienen registrados: destrucción "aleatoria", "peor-costo",
+    // "relacionada" y "ruta"; reparación "greedy", "regret-2", "regret-3" y
+    // "cercana" (el criterio de Inserción Más Cercana). Devuelven el índice.
+    int agregarDestruccion(const string& nombre, Destruccion operador);
+    int agregarReparacion(const string& nombre, Reparacion operador);
+    void quitarOperadores();
+
+    // Clientes quitados por iteración, sorteados en [minimo, maximo]
+    void setCantidadQuitada(int minimo, int maximo);
+    // Cada `iteraciones` los pesos pasan a (1 - reaccion) * peso +
+    // reaccion * puntaje / usos
+    void setSegmento(int iteraciones, double reaccion = 0.1);
+    void setPuntajes(double mejor, double mejora, double aceptada);
+    // Al comienzo, una solución `peorRelativo` peor se acepta con prob. 1/2
+    void setTemperaturaInicial(double peorRelativo);
+    void setMaxIteraciones(long iteraciones);
+    void setCriterioParada(const CriterioParada& criterio);
+    void setAlMejorar(function<void(const Solucion&, double)> callback);
+    void detener();
+
+    vector<string> getNombresDestruccion() const;
+    vector<double> getPesosDestruccion() const;
+    vector<string> getNombresReparacion() const;
+    vector<double> getPesosReparacion() const;
+
+    double getMejorCosto() const;
+    long getIteracionesRealizadas() const;
+    double getIteracionesPorSegundo() const;
+    uint64_t getSemilla() const;
+};
+
+#endif
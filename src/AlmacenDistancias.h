@@ -0,0 +1,98 @@
+#ifndef ALMACEN_DISTANCIAS_H
+#define ALMACEN_DISTANCIAS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// Formatos compactos de la matriz de distancias, para corridas limitadas
+// por memoria. T es double o float (con float la matriz ocupa la mitad; las
+// distancias enteras, como las de CEIL_2D, ATT o GEO, se guardan exactas
+// hasta 2^24). Los costos se siguen acumulando en double.
+
+// Matriz completa en un solo bloque, fila por fila
+template <typename T>
+class AlmacenCompleto {
+private:
+    vector<T> datos;
+    size_t cantidad;
+
+public:
+    explicit AlmacenCompleto(int cantidad)
+        : datos(static_cast<size_t>(cantidad) * cantidad, T(0)),
+          cantidad(static_cast<size_t>(cantidad))
+    {}
+
+    double operator()(int a, int b) const { return datos[a * cantidad + b]; }
+    void fijar(int a, int b, double valor) { datos[a * cantidad + b] = static_cast<T>(valor); }
+
+    int getCantidad() const { return static_cast<int>(cantidad); }
+    size_t getBytes() const { return datos.size() * sizeof(T); }
+};
+
+// Matriz completa de double en un bloque ajeno (por ejemplo, la caché
+// mapeada del lector), fila por fila, sin copiarla. Ve el tramo de índices
+// que empieza en `primero`: (a, b) es el elemento (primero + a, primero + b)
+// del bloque de `ancho` x `ancho`. `bloque` lo mantiene vivo.
+class VistaCompleta {
+private:
+    shared_ptr<const double> bloque;
+    const double* inicio;
+    size_t ancho;
+    int primero;
+    int cantidad;
+
+public:
+    VistaCompleta(shared_ptr<const double> bloque, int ancho, int primero, int cantidad)
+        : bloque(move(bloque)),
+          inicio(this->bloque.get() + static_cast<size_t>(primero) * ancho + primero),
+          ancho(static_cast<size_t>(ancho)),
+          primero(primero),
+          cantidad(cantidad)
+    {}
+
+    double operator()(int a, int b) const { return inicio[a * ancho + b]; }
+
+    const shared_ptr<const double>& getBloque() const { return bloque; }
+    int getAncho() const { return static_cast<int>(ancho); }
+    int getPrimero() const { return primero; }
+    int getCantidad() const { return cantidad; }
+    size_t getBytes() const { return static_cast<size_t>(cantidad) * cantidad * sizeof(double); }
+};
+
+// Triángulo superior con la diagonal: n(n+1)/2 valores. Sólo sirve para
+// distancias simétricas; (a, b) y (b, a) son el mismo valor.
+template <typename T>
+class AlmacenTriangular {
+private:
+    vector<T> datos;
+    vector<size_t> inicioFila;  // (a, b) con a <= b está en inicioFila[a] + b
+
+public:
+    explicit AlmacenTriangular(int cantidad)
+        : datos(static_cast<size_t>(cantidad) * (cantidad + 1) / 2, T(0)),
+          inicioFila(cantidad)
+    {
+        size_t inicio = 0;
+        for (int a = 0; a < cantidad; ++a) {
+            inicioFila[a] = inicio - a;
+            inicio += cantidad - a;
+        }
+    }
+
+    double operator()(int a, int b) const {
+        return datos[inicioFila[min(a, b)] + max(a, b)];
+    }
+    void fijar(int a, int b, double valor) {
+        datos[inicioFila[min(a, b)] + max(a, b)] = static_cast<T>(valor);
+    }
+
+    int getCantidad() const { return static_cast<int>(inicioFila.size()); }
+    size_t getBytes() const { return datos.size() * sizeof(T) + inicioFila.size() * sizeof(size_t); }
+};
+
+#endif
@@ -0,0 +1,160 @@
+#include "BusquedaLocalCompacta.h"
+#include <limits>
+
+using namespace std;
+
+// Mejora mínima para aplicar un movimiento (evita ciclos por redondeo)
+static const double EPSILON_MEJORA = 1e-9;
+
+BusquedaLocalCompacta::BusquedaLocalCompacta(const InstanciaCompacta& inst, const ListaVecinos& vecinos)
+    : inst(inst),
+      vecinos(vecinos),
+      movimientosAplicados(0),
+      control(nullptr)
+{}
+
+void BusquedaLocalCompacta::encolar(int r) {
+    if (r >= static_cast<int>(enCola.size()))
+        enCola.resize(r + 1, 0);
+    if (!enCola[r]) {
+        enCola[r] = 1;
+        cola.push_back(r);
+    }
+}
+
+void BusquedaLocalCompacta::mejorar(SolucionCompacta& sol) {
+    vector<int> todas(sol.getCantRutas());
+    for (int r = 0; r < sol.getCantRutas(); ++r) {
+        todas[r] = r;
+    }
+    mejorar(sol, todas);
+}
+
+void BusquedaLocalCompacta::mejorar(SolucionCompacta& sol, const vector<int>& rutasTocadas) {
+    cola.clear();
+    enCola.assign(sol.getCantRutas(), 0);
+    for (int r : rutasTocadas) {
+        encolar(r);
+    }
+
+    for (size_t cabeza = 0; cabeza < cola.size(); ++cabeza) {
+        if (control && control->debeDetenerse())
+            break;
+        int r = cola[cabeza];
+        enCola[r] = 0;
+        bool cambio = true;
+        while (cambio) {
+            cambio = mejorar2opt(sol, r);
+            // Copia: los clientes pueden irse de la ruta mientras se recorre
+            clientesRuta = sol.getRuta(r);
+            for (int c : clientesRuta) {
+                int rA, rB;
+                if (!mejorarCliente(sol, c, rA, rB))
+                    continue;
+                cambio = true;
+                if (rA != r) encolar(rA);
+                if (rB != r) encolar(rB);
+            }
+        }
+    }
+}
+
+bool BusquedaLocalCompacta::mejorarCliente(SolucionCompacta& sol, int c, int& rA, int& rB) {
+    int capacidad = inst.getCapacidad();
+    int r1 = sol.getRutaDe(c);
+    int i1 = sol.getIndiceEn(c);
+
+    // 0: mover (r1,i1) a (r2,i2); 1: intercambiar (r1,i1) con (r2,i2)
+    int tipo = -1, mr1 = 0, mi1 = 0, mr2 = 0, mi2 = 0;
+    double mejor = -EPSILON_MEJORA;
+    auto probarMover = [&](int ra, int ia, int rb, int j, int pos) {
+        if (ra != rb && sol.getCarga(rb) + inst.getDemanda(pos) > capacidad)
+            return;
+        double delta = sol.deltaMover(ra, ia, rb, j);
+        if (delta < mejor) {
+            mejor = delta;
+            tipo = 0; mr1 = ra; mi1 = ia; mr2 = rb; mi2 = j;
+        }
+    };
+
+    const int* lista = vecinos.getVecinos(c);
+    int largo = vecinos.getCantidadVecinos();
+    for (int k = 0; k < largo; ++k) {
+        int v = lista[k];
+        if (!inst.esCliente(v))
+            continue;
+        int r2 = sol.getRutaDe(v);
+        int i2 = sol.getIndiceEn(v);
+
+        // c antes o después de v; en la misma ruta el índice es el de la
+        // ruta ya sin c
+        int antesDeV = (r1 == r2 && i2 > i1) ? i2 - 1 : i2;
+        if (!(r1 == r2 && antesDeV == i1)) probarMover(r1, i1, r2, antesDeV, c);
+        if (!(r1 == r2 && antesDeV + 1 == i1)) probarMover(r1, i1, r2, antesDeV + 1, c);
+
+        // v antes o después de c
+        int antesDeC = (r1 == r2 && i1 > i2) ? i1 - 1 : i1;
+        if (!(r1 == r2 && antesDeC == i2)) probarMover(r2, i2, r1, antesDeC, v);
+        if (!(r1 == r2 && antesDeC + 1 == i2)) probarMover(r2, i2, r1, antesDeC + 1, v);
+
+        if (r1 != r2) {
+            int diferencia = inst.getDemanda(v) - inst.getDemanda(c);
+            if (sol.getCarga(r1) + diferencia > capacidad || sol.getCarga(r2) - diferencia > capacidad)
+                continue;
+        }
+        double delta = sol.deltaIntercambiar(r1, i1, r2, i2);
+        if (delta < mejor) {
+            mejor = delta;
+            tipo = 1; mr1 = r1; mi1 = i1; mr2 = r2; mi2 = i2;
+        }
+    }
+
+    // Abrir una ruta con c sola
+    if (sol.getRuta(r1).size() > 1) {
+        for (int r = 0; r < sol.getCantRutas(); ++r) {
+            if (sol.getRuta(r).empty()) {
+                probarMover(r1, i1, r, 0, c);
+                break;
+            }
+        }
+    }
+
+    if (tipo < 0)
+        return false;
+    if (tipo == 0)
+        sol.mover(mr1, mi1, mr2, mi2);
+    else
+        sol.intercambiar(mr1, mi1, mr2, mi2);
+    rA = mr1;
+    rB = mr2;
+    movimientosAplicados++;
+    return true;
+}
+
+bool BusquedaLocalCompacta::mejorar2opt(SolucionCompacta& sol, int r) {
+    bool algunCambio = false;
+    while (true) {
+        int largo = static_cast<int>(sol.getRuta(r).size());
+        double mejor = -EPSILON_MEJORA;
+        int mi = -1, mj = -1;
+        for (int i = 0; i + 1 < largo; ++i) {
+            for (int j = i + 1; j < largo; ++j) {
+                double delta = sol.deltaInvertir(r, i, j);
+                if (delta < mejor) {
+                    mejor = delta;
+                    mi = i;
+                    mj = j;
+                }
+            }
+        }
+        if (mi < 0)
+            return algunCambio;
+        sol.invertir(r, mi, mj);
+        movimientosAplicados++;
+        algunCambio = true;
+    }
+}
+
+void BusquedaLocalCompacta::setControlParada(const ControlParada* nuevo) { control = nuevo; }
+
+long BusquedaLocalCompacta::getMovimientosAplicados() const { return movimientosAplicados; }
@@ -0,0 +1,49 @@
+#ifndef BUSQUEDA_LOCAL_COMPACTA_H
+#define BUSQUEDA_LOCAL_COMPACTA_H
+
+#include "InstanciaCompacta.h"
+#include "SolucionCompacta.h"
+#include "ListaVecinos.h"
+#include "CriterioParada.h"
+#include <vector>
+
+using namespace std;
+
+// Búsqueda local en el lugar sobre SolucionCompacta: relocate y swap entre
+// un cliente y sus vecinos granulares (en cualquier ruta) y 2-opt dentro de
+// cada ruta, aplicando la mejor mejora de cada cliente. Trabaja con una cola
+// de rutas a revisar, así que después de una perturbación alcanza con
+// revisar las rutas tocadas: las demás se revisan sólo si un movimiento las
+// cambia.
+class BusquedaLocalCompacta {
+private:
+    const InstanciaCompacta& inst;
+    const ListaVecinos& vecinos;
+    vector<int> cola;
+    vector<char> enCola;
+    vector<int> clientesRuta;
+    long movimientosAplicados;
+    const ControlParada* control;
+
+    void encolar(int r);
+    // Aplica la mejor mejora que involucra a c; devuelve las rutas cambiadas
+    bool mejorarCliente(SolucionCompacta& sol, int c, int& rA, int& rB);
+    bool mejorar2opt(SolucionCompacta& sol, int r);
+
+public:
+    // La lista de vecinos debe ser la de la misma matriz de distancias
+    BusquedaLocalCompacta(const InstanciaCompacta& inst, const ListaVecinos& vecinos);
+
+    // Hasta óptimo local revisando todas las rutas
+    void mejorar(SolucionCompacta& sol);
+    // Hasta óptimo local partiendo sólo de las rutas indicadas
+    void mejorar(SolucionCompacta& sol, const vector<int>& rutasTocadas);
+
+    // Si se indica, se revisa entre rutas y corta antes del óptimo local
+    // cuando pide detenerse (la solución queda válida)
+    void setControlParada(const ControlParada* control);
+
+    long getMovimientosAplicados() const;
+};
+
+#endif
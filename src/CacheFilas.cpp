@@ -0,0 +1,50 @@
+#include "CacheFilas.h"
+#include <algorithm>
+
+using namespace std;
+
+CacheFilas::CacheFilas(const ProveedorDistancias& distancias, int capacidad)
+    : distancias(distancias),
+      capacidad(max(1, capacidad)),
+      aciertos(0),
+      fallos(0)
+{
+    if (distancias.esDensa())
+        return;
+    ranuraDe.assign(distancias.getCantidad(), -1);
+}
+
+const double* CacheFilas::fila(int a) {
+    if (distancias.esDensa())
+        return distancias.getMatriz()[a].data();
+
+    int ranura = ranuraDe[a];
+    if (ranura >= 0) {
+        aciertos++;
+        usoReciente.splice(usoReciente.begin(), usoReciente, posicionUso[ranura]);
+        return datos[ranura].data();
+    }
+
+    fallos++;
+    if (static_cast<int>(filaEn.size()) < capacidad) {
+        // Las ranuras se reservan de a una: una caché grande que casi no se
+        // usa no ocupa memoria
+        ranura = static_cast<int>(filaEn.size());
+        filaEn.push_back(a);
+        datos.emplace_back(distancias.getCantidad());
+        usoReciente.push_front(ranura);
+        posicionUso.push_back(usoReciente.begin());
+    } else {
+        ranura = usoReciente.back();
+        ranuraDe[filaEn[ranura]] = -1;
+        filaEn[ranura] = a;
+        usoReciente.splice(usoReciente.begin(), usoReciente, posicionUso[ranura]);
+    }
+    ranuraDe[a] = ranura;
+    distancias.fila(a, datos[ranura].data());
+    return datos[ranura].data();
+}
+
+long CacheFilas::getAciertos() const { return aciertos; }
+
+long CacheFilas::getFallos() const { return fallos; }
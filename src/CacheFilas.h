@@ -0,0 +1,36 @@
+#ifndef CACHE_FILAS_H
+#define CACHE_FILAS_H
+
+#include "ProveedorDistancias.h"
+#include <list>
+#include <vector>
+
+using namespace std;
+
+// Caché LRU de filas de distancias para quien recorre filas enteras (por
+// ejemplo, buscar los k más cercanos fuera de la lista de vecinos) sin
+// matriz densa. No es segura entre hilos: cada hilo usa la suya. Con un
+// proveedor denso devuelve la fila de la matriz sin copiar.
+class CacheFilas {
+private:
+    const ProveedorDistancias& distancias;
+    int capacidad;
+    vector<vector<double>> datos;  // una fila por ranura
+    vector<int> ranuraDe;          // fila -> ranura, -1 si no está
+    vector<int> filaEn;            // ranura -> fila
+    list<int> usoReciente;         // ranuras, la más reciente primero
+    vector<list<int>::iterator> posicionUso;
+    long aciertos;
+    long fallos;
+
+public:
+    CacheFilas(const ProveedorDistancias& distancias, int capacidad);
+
+    // Fila a completa; válida hasta la próxima llamada que la desaloje
+    const double* fila(int a);
+
+    long getAciertos() const;
+    long getFallos() const;
+};
+
+#endif
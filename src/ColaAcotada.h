@@ -0,0 +1,95 @@
+#ifndef COLA_ACOTADA_H
+#define COLA_ACOTADA_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// Cola acotada sin locks para varios productores y varios consumidores
+// (esquema de Vyukov: cada celda lleva un número de secuencia que indica si
+// está libre para escribir o lista para leer). No bloquea: si la cola está
+// llena o vacía la operación devuelve false y el llamador decide si reintenta.
+template <typename T>
+class ColaAcotada {
+private:
+    struct Celda {
+        atomic<size_t> secuencia;
+        T valor;
+    };
+
+    vector<Celda> celdas;
+    size_t mascara;
+    // Separados en líneas de caché distintas para no pelearse entre
+    // productores y consumidores
+    alignas(64) atomic<size_t> posEncolar;
+    alignas(64) atomic<size_t> posDesencolar;
+
+    static size_t potenciaDeDos(size_t n) {
+        size_t p = 2;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+public:
+    // La capacidad se redondea a la siguiente potencia de dos
+    explicit ColaAcotada(size_t capacidad)
+        : celdas(potenciaDeDos(capacidad)),
+          mascara(potenciaDeDos(capacidad) - 1),
+          posEncolar(0),
+          posDesencolar(0)
+    {
+        for (size_t i = 0; i < celdas.size(); ++i) {
+            celdas[i].secuencia.store(i, memory_order_relaxed);
+        }
+    }
+
+    ColaAcotada(const ColaAcotada&) = delete;
+    ColaAcotada& operator=(const ColaAcotada&) = delete;
+
+    bool intentarEncolar(T&& valor) {
+        size_t pos = posEncolar.load(memory_order_relaxed);
+        while (true) {
+            Celda& celda = celdas[pos & mascara];
+            size_t sec = celda.secuencia.load(memory_order_acquire);
+            long diferencia = static_cast<long>(sec) - static_cast<long>(pos);
+            if (diferencia == 0) {
+                if (posEncolar.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                    celda.valor = move(valor);
+                    celda.secuencia.store(pos + 1, memory_order_release);
+                    return true;
+                }
+            } else if (diferencia < 0) {
+                return false;  // llena
+            } else {
+                pos = posEncolar.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    bool intentarDesencolar(T& valor) {
+        size_t pos = posDesencolar.load(memory_order_relaxed);
+        while (true) {
+            Celda& celda = celdas[pos & mascara];
+            size_t sec = celda.secuencia.load(memory_order_acquire);
+            long diferencia = static_cast<long>(sec) - static_cast<long>(pos + 1);
+            if (diferencia == 0) {
+                if (posDesencolar.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                    valor = move(celda.valor);
+                    celda.secuencia.store(pos + mascara + 1, memory_order_release);
+                    return true;
+                }
+            } else if (diferencia < 0) {
+                return false;  // vacía
+            } else {
+                pos = posDesencolar.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    size_t getCapacidad() const { return celdas.size(); }
+};
+
+#endif
@@ -0,0 +1,253 @@
+#include "CotaInferior.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+
+using namespace std;
+
+// Subgradiente: paso inicial (relativo) y cuántas iteraciones sin mejorar
+// la cota se esperan antes de achicarlo a la mitad
+static const double PASO_INICIAL = 2.0;
+static const int ITERACIONES_POR_PASO = 20;
+static const double PASO_MINIMO = 1e-5;
+
+CotaInferior::CotaInferior(const InstanciaCompacta& inst)
+    : inst(inst),
+      iteraciones(300),
+      vehiculosMinimos(0),
+      cotaCosto(0),
+      cantNodos(0),
+      simetrica(true)
+{}
+
+int CotaInferior::calcularVehiculos() const {
+    const long capacidad = inst.getCapacidad();
+    vector<long> demandas;
+    long total = 0;
+    for (int pos : inst.getPosClientes()) {
+        demandas.push_back(inst.getDemanda(pos));
+        total += inst.getDemanda(pos);
+    }
+    if (capacidad <= 0 || demandas.empty())
+        return demandas.empty() ? 0 : 1;
+    long mejor = (total + capacidad - 1) / capacidad;
+
+    // L2: para cada umbral u <= Q/2, los ítems de más de Q - u y los de
+    // más de Q/2 van solos; los de [u, Q/2] sólo aprovechan lo que sobra
+    // en los bins de estos últimos
+    vector<long> umbrales = {0};
+    for (long d : demandas) {
+        if (2 * d <= capacidad)
+            umbrales.push_back(d);
+    }
+    sort(umbrales.begin(), umbrales.end());
+    umbrales.erase(unique(umbrales.begin(), umbrales.end()), umbrales.end());
+    for (long u : umbrales) {
+        long grandes = 0, medianos = 0, sumaMedianos = 0, sumaChicos = 0;
+        for (long d : demandas) {
+            if (d > capacidad - u)
+                grandes++;
+            else if (2 * d > capacidad) {
+                medianos++;
+                sumaMedianos += d;
+            } else if (d >= u)
+                sumaChicos += d;
+        }
+        long sobrante = medianos * capacidad - sumaMedianos;
+        long extra = max(0L, (sumaChicos - sobrante + capacidad - 1) / capacidad);
+        mejor = max(mejor, grandes + medianos + extra);
+    }
+    return static_cast<int>(mejor);
+}
+
+double CotaInferior::costoVecinoMasCercano() const {
+    // Cada ruta va al cliente más cercano que todavía entra en el vehículo
+    const int n = cantNodos;
+    vector<char> visitado(n, 0);
+    int restantes = n - 1;
+    double costo = 0;
+    while (restantes > 0) {
+        int actual = 0;
+        long carga = 0;
+        while (true) {
+            int siguiente = -1;
+            for (int j = 1; j < n; ++j) {
+                if (visitado[j] || carga + inst.getDemanda(inst.getPosClientes()[j - 1]) > inst.getCapacidad())
+                    continue;
+                if (siguiente < 0 || costoEntre(actual, j) < costoEntre(actual, siguiente))
+                    siguiente = j;
+            }
+            if (siguiente < 0)
+                break;
+            visitado[siguiente] = 1;
+            restantes--;
+            carga += inst.getDemanda(inst.getPosClientes()[siguiente - 1]);
+            costo += costoEntre(actual, siguiente);
+            actual = siguiente;
+        }
+        // Un cliente que no entra ni solo se cuenta como ruta propia
+        if (actual == 0) {
+            for (int j = 1; j < n; ++j) {
+                if (!visitado[j]) {
+                    visitado[j] = 1;
+                    restantes--;
+                    costo += 2 * costoEntre(0, j);
+                    break;
+                }
+            }
+        } else {
+            costo += costoEntre(actual, 0);
+        }
+    }
+    return costo;
+}
+
+double CotaInferior::kArbol(int k, bool exacto) {
+    const int n = cantNodos;
+    auto peso = [&](int i, int j) { return costoEntre(i, j) + pi[i] + pi[j]; };
+    grado.assign(n, 0);
+    double total = 0;
+
+    // Árbol generador mínimo (Prim, O(n^2))
+    vector<double> mejor(n, numeric_limits<double>::max());
+    vector<int> padre(n, -1);
+    vector<char> enArbol(n, 0);
+    mejor[0] = 0;
+    for (int paso = 0; paso < n; ++paso) {
+        int v = -1;
+        for (int j = 0; j < n; ++j) {
+            if (!enArbol[j] && (v < 0 || mejor[j] < mejor[v]))
+                v = j;
+        }
+        enArbol[v] = 1;
+        if (padre[v] >= 0) {
+            total += mejor[v];
+            grado[v]++;
+            grado[padre[v]]++;
+        }
+        for (int j = 0; j < n; ++j) {
+            if (enArbol[j])
+                continue;
+            double w = peso(v, j);
+            if (w < mejor[j]) {
+                mejor[j] = w;
+                padre[j] = v;
+            }
+        }
+    }
+
+    // Las k aristas más baratas fuera del árbol; si la flota permite más
+    // de k rutas, también todas las negativas que queden afuera
+    priority_queue<pair<double, int>> masBaratas;
+    auto agregar = [&](double w, int arista) {
+        total += w;
+        grado[arista / n]++;
+        grado[arista % n]++;
+    };
+    auto descartar = [&](double w, int arista) {
+        if (!exacto && w < 0)
+            agregar(w, arista);
+    };
+    auto considerar = [&](int i, int j) {
+        double w = peso(i, j);
+        if (static_cast<int>(masBaratas.size()) < k) {
+            masBaratas.push({w, i * n + j});
+        } else if (w < masBaratas.top().first) {
+            descartar(masBaratas.top().first, masBaratas.top().second);
+            masBaratas.pop();
+            masBaratas.push({w, i * n + j});
+        } else {
+            descartar(w, i * n + j);
+        }
+    };
+    for (int i = 0; i < n; ++i) {
+        for (int j = i + 1; j < n; ++j) {
+            if (padre[j] != i && padre[i] != j)
+                considerar(i, j);
+        }
+    }
+    for (int j = 1; j < n; ++j)
+        considerar(0, j);
+
+    for (; !masBaratas.empty(); masBaratas.pop())
+        agregar(masBaratas.top().first, masBaratas.top().second);
+
+    total -= 2 * k * pi[0];
+    for (int i = 1; i < n; ++i)
+        total -= 2 * pi[i];
+    return total;
+}
+
+void CotaInferior::calcular(double cotaSuperior) {
+    vehiculosMinimos = calcularVehiculos();
+    cotaCosto = 0;
+
+    nodos = {inst.getPosDeposito()};
+    for (int pos : inst.getPosClientes())
+        nodos.push_back(pos);
+    const int n = cantNodos = static_cast<int>(nodos.size());
+    if (n < 2)
+        return;
+    // Sin matriz densa (coordenadas o formatos compactos) no se arma la tabla
+    costos.clear();
+    simetrica = inst.esSimetrica();
+    if (inst.getDistancias().esDensa()) {
+        costos.resize(static_cast<size_t>(n) * n);
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < n; ++j)
+                costos[static_cast<size_t>(i) * n + j] = min(inst.dist(nodos[i], nodos[j]), inst.dist(nodos[j], nodos[i]));
+        }
+    }
+    pi.assign(n, 0);
+    if (cotaSuperior <= 0)
+        cotaSuperior = costoVecinoMasCercano();
+
+    const int k = max(1, vehiculosMinimos);
+    // Con la flota justa toda solución tiene exactamente k rutas
+    const bool exacto = inst.getNumVehiculos() == k;
+    double mejorCota = -numeric_limits<double>::max();
+    double paso = PASO_INICIAL;
+    int sinMejora = 0;
+    for (int iter = 0; iter < max(1, iteraciones) && paso > PASO_MINIMO; ++iter) {
+        double cota = kArbol(k, exacto);
+        if (cota > mejorCota) {
+            mejorCota = cota;
+            sinMejora = 0;
+        } else if (++sinMejora >= ITERACIONES_POR_PASO) {
+            paso /= 2;
+            sinMejora = 0;
+        }
+
+        // Si la flota permite más de K rutas el grado del depósito sólo se
+        // acota por abajo (2K' >= 2K) y su multiplicador no puede ser positivo
+        double gradoDeposito = grado[0] - 2 * k;
+        if (!exacto && pi[0] == 0 && gradoDeposito > 0)
+            gradoDeposito = 0;
+        double norma = gradoDeposito * gradoDeposito;
+        for (int i = 1; i < n; ++i)
+            norma += (grado[i] - 2) * (grado[i] - 2);
+        // Todos los grados cumplidos: el K-árbol ya es un conjunto de rutas
+        if (norma == 0)
+            break;
+        double t = paso * max(cotaSuperior - cota, 1e-6 * fabs(cotaSuperior)) / norma;
+        pi[0] += t * gradoDeposito;
+        if (!exacto)
+            pi[0] = min(0.0, pi[0]);
+        for (int i = 1; i < n; ++i)
+            pi[i] += t * (grado[i] - 2);
+    }
+    cotaCosto = max(0.0, mejorCota);
+}
+
+void CotaInferior::setIteraciones(int nuevo) { iteraciones = nuevo > 0 ? nuevo : 300; }
+
+int CotaInferior::getVehiculosMinimos() const { return vehiculosMinimos; }
+
+double CotaInferior::getCotaCosto() const { return cotaCosto; }
+
+double CotaInferior::brecha(double costo) const {
+    if (cotaCosto <= 0)
+        return -1;
+    return 100 * (costo - cotaCosto) / cotaCosto;
+}
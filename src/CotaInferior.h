@@ -0,0 +1,67 @@
+#ifndef COTA_INFERIOR_H
+#define COTA_INFERIOR_H
+
+#include "InstanciaCompacta.h"
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+
+// Cotas inferiores de una instancia, para medir la brecha de una solución
+// sin conocer el óptimo:
+// - vehículos: cota L2 de Martello y Toth para bin packing sobre las
+//   demandas (nunca menor que ceil(demanda total / capacidad));
+// - costo: cota lagrangiana de K-árbol (Fisher). Toda solución con K' >= K
+//   rutas es un grafo conexo de n + K' aristas, así que contiene un árbol
+//   generador más K' aristas; se relaja el grado 2 de cada cliente con
+//   multiplicadores ajustados por subgradiente, y el grado del depósito
+//   (al menos 2K, o exactamente 2K si la flota es justa) con otro. Las
+//   rutas de un solo cliente usan dos veces la arista al depósito, por eso
+//   cada arista del depósito puede elegirse dos veces.
+// Se calcula una vez por instancia; cada iteración es O(n^2 log K).
+class CotaInferior {
+private:
+    const InstanciaCompacta& inst;
+    int iteraciones;
+    int vehiculosMinimos;
+    double cotaCosto;
+
+    // Costos simétricos (el mínimo de los dos sentidos) entre los nodos:
+    // el depósito en el índice 0 y los clientes a continuación. Sólo se
+    // guardan con matriz densa; con otros proveedores se calculan al vuelo.
+    int cantNodos;
+    vector<int> nodos;
+    vector<double> costos;
+    bool simetrica;
+
+    double costoEntre(int i, int j) const {
+        if (!costos.empty())
+            return costos[static_cast<size_t>(i) * cantNodos + j];
+        double d = inst.dist(nodos[i], nodos[j]);
+        return simetrica ? d : min(d, inst.dist(nodos[j], nodos[i]));
+    }
+    vector<double> pi;
+    vector<int> grado;
+
+    int calcularVehiculos() const;
+    double costoVecinoMasCercano() const;
+    double kArbol(int k, bool exacto);
+
+public:
+    explicit CotaInferior(const InstanciaCompacta& inst);
+
+    // Calcula ambas cotas. `cotaSuperior` (el costo de una solución
+    // conocida, si la hay) sólo guía el paso del subgradiente.
+    void calcular(double cotaSuperior = -1);
+
+    // Iteraciones de subgradiente (300 por defecto)
+    void setIteraciones(int iteraciones);
+
+    int getVehiculosMinimos() const;
+    double getCotaCosto() const;
+
+    // Brecha porcentual de `costo` respecto de la cota de costo
+    double brecha(double costo) const;
+};
+
+#endif
@@ -0,0 +1,52 @@
+#include "CriterioParada.h"
+
+using namespace std;
+
+ControlParada::ControlParada(const CriterioParada& criterio)
+    : criterio(criterio),
+      inicio(chrono::steady_clock::now()),
+      pedidoDetener(false),
+      externo(nullptr)
+{}
+
+void ControlParada::reiniciar() {
+    inicio = chrono::steady_clock::now();
+    pedidoDetener.store(false);
+}
+
+void ControlParada::setExterno(const ControlParada* externo) { this->externo = externo; }
+
+void ControlParada::setCriterio(const CriterioParada& nuevo) { criterio = nuevo; }
+
+const CriterioParada& ControlParada::getCriterio() const { return criterio; }
+
+double ControlParada::segundos() const {
+    return chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+}
+
+bool ControlParada::tiempoAgotado() const {
+    return criterio.limiteTiempo > 0 && segundos() >= criterio.limiteTiempo;
+}
+
+bool ControlParada::objetivoAlcanzado(double costo) const {
+    if (criterio.costoObjetivo >= 0 && costo <= criterio.costoObjetivo)
+        return true;
+    return criterio.brechaObjetivo >= 0 && criterio.cotaInferior > 0 &&
+           costo <= criterio.cotaInferior * (1 + criterio.brechaObjetivo / 100);
+}
+
+bool ControlParada::sinMejoraAgotado(long iteracionesSinMejora) const {
+    return criterio.iteracionesSinMejora > 0 &&
+           iteracionesSinMejora >= criterio.iteracionesSinMejora;
+}
+
+void ControlParada::detener() { pedidoDetener.store(true, memory_order_relaxed); }
+
+bool ControlParada::detenido() const {
+    return pedidoDetener.load(memory_order_relaxed) || (externo && externo->detenido());
+}
+
+bool ControlParada::debeDetenerse() const {
+    if (detenido()) return true;
+    return tiempoAgotado();
+}
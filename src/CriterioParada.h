@@ -0,0 +1,62 @@
+#ifndef CRITERIO_PARADA_H
+#define CRITERIO_PARADA_H
+
+#include <atomic>
+#include <chrono>
+
+using namespace std;
+
+// Criterios de corte para las metaheurísticas. Un valor <= 0 (o < 0 para el
+// costo objetivo) desactiva el criterio correspondiente.
+struct CriterioParada {
+    double limiteTiempo = 0;       // segundos de reloj
+    double costoObjetivo = -1;     // se corta al llegar a un costo <= objetivo
+    int iteracionesSinMejora = 0;  // iteraciones seguidas sin mejorar la mejor
+    // Se corta al quedar a menos de brechaObjetivo % de cotaInferior (una
+    // cota inferior del costo, por ejemplo de CotaInferior)
+    double brechaObjetivo = -1;
+    double cotaInferior = 0;
+
+    bool tieneLimite() const {
+        return limiteTiempo > 0 || costoObjetivo >= 0 || iteracionesSinMejora > 0 ||
+               (brechaObjetivo >= 0 && cotaInferior > 0);
+    }
+};
+
+// Estado de una corrida frente a un CriterioParada. Es seguro consultarlo
+// desde varios hilos; detener() permite cortar la corrida desde afuera, y
+// un control externo (el de un portafolio o un modelo de islas que contiene
+// a la corrida) también la corta.
+class ControlParada {
+public:
+    explicit ControlParada(const CriterioParada& criterio = CriterioParada());
+
+    // Vuelve a arrancar el reloj y limpia el pedido de detención propio; el
+    // del control externo queda como está
+    void reiniciar();
+
+    // Su pedido de detención corta también esta corrida (nullptr: ninguno).
+    // Debe sobrevivir a este control.
+    void setExterno(const ControlParada* externo);
+
+    void setCriterio(const CriterioParada& nuevo);
+    const CriterioParada& getCriterio() const;
+    double segundos() const;
+    bool tiempoAgotado() const;
+    bool objetivoAlcanzado(double costo) const;
+    bool sinMejoraAgotado(long iteracionesSinMejora) const;
+
+    void detener();
+    bool detenido() const;
+
+    // Pensado para consultarse seguido dentro de los bucles internos
+    bool debeDetenerse() const;
+
+private:
+    CriterioParada criterio;
+    chrono::steady_clock::time_point inicio;
+    atomic<bool> pedidoDetener;
+    const ControlParada* externo;
+};
+
+#endif
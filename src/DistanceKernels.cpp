@@ -0,0 +1,71 @@
+#include "DistanceKernels.h"
+#include <cmath>
+
+#ifdef DISTANCE_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+void euclideanRowScalar(double x, double y, const double* xs, const double* ys,
+                        double* out, std::size_t n) {
+    for (std::size_t j = 0; j < n; ++j) {
+        double dx = x - xs[j];
+        double dy = y - ys[j];
+        out[j] = std::sqrt(dx * dx + dy * dy);
+    }
+}
+
+#ifdef DISTANCE_KERNELS_X86
+
+// SSE2 is part of x86-64, but the attribute keeps 32-bit builds honest
+__attribute__((target("sse2")))
+void euclideanRowSSE2(double x, double y, const double* xs, const double* ys,
+                      double* out, std::size_t n) {
+    const __m128d vx = _mm_set1_pd(x);
+    const __m128d vy = _mm_set1_pd(y);
+    std::size_t j = 0;
+    for (; j + 2 <= n; j += 2) {
+        __m128d dx = _mm_sub_pd(vx, _mm_loadu_pd(xs + j));
+        __m128d dy = _mm_sub_pd(vy, _mm_loadu_pd(ys + j));
+        __m128d sum = _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy));
+        _mm_storeu_pd(out + j, _mm_sqrt_pd(sum));
+    }
+    euclideanRowScalar(x, y, xs + j, ys + j, out + j, n - j);
+}
+
+__attribute__((target("avx2")))
+void euclideanRowAVX2(double x, double y, const double* xs, const double* ys,
+                      double* out, std::size_t n) {
+    const __m256d vx = _mm256_set1_pd(x);
+    const __m256d vy = _mm256_set1_pd(y);
+    std::size_t j = 0;
+    for (; j + 4 <= n; j += 4) {
+        __m256d dx = _mm256_sub_pd(vx, _mm256_loadu_pd(xs + j));
+        __m256d dy = _mm256_sub_pd(vy, _mm256_loadu_pd(ys + j));
+        __m256d sum = _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+        _mm256_storeu_pd(out + j, _mm256_sqrt_pd(sum));
+    }
+    euclideanRowScalar(x, y, xs + j, ys + j, out + j, n - j);
+}
+
+#endif
+
+EuclideanRowKernel selectEuclideanRowKernel() {
+#ifdef DISTANCE_KERNELS_X86
+    static const EuclideanRowKernel best =
+        __builtin_cpu_supports("avx2") ? euclideanRowAVX2
+        : __builtin_cpu_supports("sse2") ? euclideanRowSSE2
+        : euclideanRowScalar;
+    return best;
+#else
+    return euclideanRowScalar;
+#endif
+}
+
+const char* euclideanRowKernelName() {
+    EuclideanRowKernel kernel = selectEuclideanRowKernel();
+#ifdef DISTANCE_KERNELS_X86
+    if (kernel == euclideanRowAVX2) return "avx2";
+    if (kernel == euclideanRowSSE2) return "sse2";
+#endif
+    return kernel == euclideanRowScalar ? "scalar" : "unknown";
+}
@@ -0,0 +1,30 @@
+#ifndef DISTANCE_KERNELS_H
+#define DISTANCE_KERNELS_H
+
+#include <cstddef>
+
+// Row kernels for the Euclidean distance matrix over a structure-of-arrays
+// coordinate layout: out[j] = sqrt((x - xs[j])^2 + (y - ys[j])^2) for
+// j in [0, n). Every kernel is exact to the last bit of the scalar formula
+// (no fused multiply-add, correctly rounded sqrt), so the dispatch never
+// changes results.
+using EuclideanRowKernel = void (*)(double x, double y, const double* xs, const double* ys,
+                                    double* out, std::size_t n);
+
+void euclideanRowScalar(double x, double y, const double* xs, const double* ys,
+                        double* out, std::size_t n);
+
+#if defined(__x86_64__) || defined(__i386__)
+#define DISTANCE_KERNELS_X86 1
+void euclideanRowSSE2(double x, double y, const double* xs, const double* ys,
+                      double* out, std::size_t n);
+void euclideanRowAVX2(double x, double y, const double* xs, const double* ys,
+                      double* out, std::size_t n);
+#endif
+
+// Best kernel for the running CPU (AVX2, then SSE2, then scalar), chosen
+// once at runtime
+EuclideanRowKernel selectEuclideanRowKernel();
+const char* euclideanRowKernelName();
+
+#endif // DISTANCE_KERNELS_H
@@ -0,0 +1,66 @@
+#include "EdicionSolucion.h"
+#include <algorithm>
+
+using namespace std;
+
+EdicionSolucion::EdicionSolucion(SolucionCompacta& sol)
+    : sol(&sol),
+      rutasAlComenzar(sol.getCantRutas())
+{}
+
+void EdicionSolucion::comenzar() {
+    for (int r : rutasTocadas) tocada[r] = 0;
+    rutasTocadas.clear();
+    quitados.clear();
+    rutasAlComenzar = sol->getCantRutas();
+    if (static_cast<int>(tocada.size()) < rutasAlComenzar)
+        tocada.resize(rutasAlComenzar, 0);
+}
+
+void EdicionSolucion::respaldar(int r) {
+    // Las rutas abiertas durante la edición no se respaldan: se borran
+    if (r >= rutasAlComenzar || tocada[r])
+        return;
+    tocada[r] = 1;
+    size_t k = rutasTocadas.size();
+    rutasTocadas.push_back(r);
+    if (respaldos.size() <= k)
+        respaldos.emplace_back();
+    respaldos[k].assign(sol->getRuta(r).begin(), sol->getRuta(r).end());
+}
+
+void EdicionSolucion::deshacer() {
+    for (int r = sol->getCantRutas() - 1; r >= rutasAlComenzar; --r) {
+        sol->reemplazarRuta(r, vector<int>());
+        sol->eliminarUltimaRuta();
+    }
+    for (size_t k = 0; k < rutasTocadas.size(); ++k) {
+        sol->reemplazarRuta(rutasTocadas[k], respaldos[k]);
+    }
+    comenzar();
+}
+
+const SolucionCompacta& EdicionSolucion::getSolucion() const { return *sol; }
+
+const vector<int>& EdicionSolucion::getQuitados() const { return quitados; }
+
+void EdicionSolucion::quitar(int pos) {
+    int r = sol->getRutaDe(pos);
+    respaldar(r);
+    sol->remover(r, sol->getIndiceEn(pos));
+    quitados.push_back(pos);
+}
+
+void EdicionSolucion::insertar(int r, int i, int pos) {
+    respaldar(r);
+    sol->insertar(r, i, pos);
+    auto it = find(quitados.begin(), quitados.end(), pos);
+    if (it != quitados.end()) {
+        *it = quitados.back();
+        quitados.pop_back();
+    }
+}
+
+int EdicionSolucion::abrirRuta() {
+    return sol->agregarRutaVacia();
+}
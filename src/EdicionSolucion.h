@@ -0,0 +1,41 @@
+#ifndef EDICION_SOLUCION_H
+#define EDICION_SOLUCION_H
+
+#include "SolucionCompacta.h"
+#include <vector>
+
+using namespace std;
+
+// Edición deshacible de una SolucionCompacta: quitar e insertar clientes
+// pasa por acá, que guarda una copia de cada ruta la primera vez que se la
+// toca. Deshacer restaura sólo esas rutas (y borra las abiertas), así que
+// descartar un movimiento grande cuesta lo que tocó y no la solución entera.
+class EdicionSolucion {
+private:
+    SolucionCompacta* sol;
+    int rutasAlComenzar;
+    vector<char> tocada;
+    vector<int> rutasTocadas;
+    vector<vector<int>> respaldos;  // alineado con rutasTocadas; se reutiliza
+    vector<int> quitados;
+
+    void respaldar(int r);
+
+public:
+    explicit EdicionSolucion(SolucionCompacta& sol);
+
+    // Empieza una edición nueva sobre el estado actual
+    void comenzar();
+    // Restaura la solución al estado de comenzar()
+    void deshacer();
+
+    const SolucionCompacta& getSolucion() const;
+    // Clientes quitados y todavía no reinsertados
+    const vector<int>& getQuitados() const;
+
+    void quitar(int pos);
+    void insertar(int r, int i, int pos);
+    int abrirRuta();
+};
+
+#endif
@@ -1,12 +1,40 @@
 #include "GRASP.h"
+#include "ParticionConjuntos.h"
 #include "OperadorSwap.h"
 #include "OperadorRelocate.h"
+#include "ColaAcotada.h"
 #include <algorithm>
-#include <random>
+#include <cmath>
 #include <limits>
 
 using namespace std;
 
+// Iteraciones por hilo en cada lote que se reparte al pool. Entre lotes se
+// revisan los criterios de corte cuando no hay límite de iteraciones.
+static const int ITERACIONES_POR_LOTE_Y_HILO = 16;
+
+// Con pool elite el lote es fijo: el pool se actualiza entre lotes y sus
+// límites no deben depender de la cantidad de hilos
+static const int ITERACIONES_POR_LOTE_ELITE = 64;
+
+// Piso de probabilidad de cada k en GRASP reactivo, para no descartar del
+// todo un valor que anduvo mal al principio
+static const double PROBABILIDAD_MINIMA_K = 0.01;
+
+// Cantidad máxima de vecinos guardados por cliente. Si la lista truncada se
+// agota se recurre a un nth_element sobre los no visitados.
+static const int VECINOS_POR_CLIENTE = 64;
+
+// Filas de distancias cacheadas por hilo para cuando la lista truncada se
+// agota (la del depósito es la que más se repite)
+static const int FILAS_EN_CACHE = 64;
+
+// Construcciones en espera entre las dos etapas del modo pipeline
+static const int CAPACIDAD_COLA_PIPELINE = 64;
+
+// Rutas de hasta tantos clientes se reordenan en forma exacta
+static const int MAX_CLIENTES_EXACTO = 12;
+
 GRASP::GRASP(
     const vector<Cliente>& clientes,
     const vector<vector<double>>& distMatrix,
@@ -15,168 +43,672 @@ GRASP::GRASP(
     int depotId,
     int numVehiculos,
     int numIter,
-    int kRCL)
-    : clientes(clientes),
-      distMatrix(distMatrix),
-      id2pos(id2pos),
-      capacidadVehiculo(capacidadVehiculo),
-      depotId(depotId),
-      numVehiculos(numVehiculos),
+    int kRCL,
+    uint64_t semilla)
+    : GRASP(clientes, make_shared<const ProveedorDistancias>(distMatrix), id2pos,
+            capacidadVehiculo, depotId, numVehiculos, numIter, kRCL, semilla)
+{}
+
+GRASP::GRASP(
+    const vector<Cliente>& clientes,
+    shared_ptr<const ProveedorDistancias> distancias,
+    const unordered_map<int, int>& id2pos,
+    int capacidadVehiculo,
+    int depotId,
+    int numVehiculos,
+    int numIter,
+    int kRCL,
+    uint64_t semilla)
+    : GRASP(make_shared<const InstanciaCompacta>(clientes, move(distancias), id2pos,
+                                                 capacidadVehiculo, depotId, numVehiculos),
+            nullptr, numIter, kRCL, semilla)
+{}
+
+GRASP::GRASP(
+    shared_ptr<const InstanciaCompacta> compartida,
+    shared_ptr<const ListaVecinos> vecinosCompartidos,
+    int numIter,
+    int kRCL,
+    uint64_t semilla)
+    : clientes(compartida->getClientes()),
+      capacidadVehiculo(compartida->getCapacidad()),
+      depotId(compartida->getDepotId()),
+      numVehiculos(compartida->getNumVehiculos()),
       numIter(numIter),
-      kRCL(kRCL)
+      kRCL(kRCL),
+      semilla(semilla),
+      instancia(move(compartida)),
+      listaVecinos(vecinosCompartidos ? move(vecinosCompartidos) : crearVecinos(*instancia, kRCL)),
+      inst(*instancia),
+      vecinos(*listaVecinos),
+      numHilos(1),
+      maxClientesExacto(MAX_CLIENTES_EXACTO),
+      mejorCosto(numeric_limits<double>::max()),
+      mejorIter(-1),
+      iteracionesRealizadas(0),
+      realizadasAlMejorar(0),
+      periodoReactivo(100),
+      deltaReactivo(10.0),
+      tamPoolElite(0),
+      diferenciaMinimaElite(-1),
+      mejorasPorRelinking(0),
+      periodoRecombinacion(0),
+      capacidadPoolRutas(0),
+      mejorasPorRecombinacion(0),
+      detectarDuplicados(false),
+      hashZobrist(inst.getCantPos(), semilla),
+      iteracionesOmitidas(0),
+      pipeline(false),
+      hilosConstructores(0),
+      filtroConstruccion(-1),
+      iteracionesFiltradas(0)
 {}
 
+shared_ptr<const ListaVecinos> GRASP::crearVecinos(const InstanciaCompacta& inst, int kRCL) {
+    return make_shared<const ListaVecinos>(inst.getDistancias(), max(kRCL, VECINOS_POR_CLIENTE));
+}
+
 Solucion GRASP::resolver() {
-    Solucion mejorSol = Solucion(clientes, distMatrix, numVehiculos);
-    double mejorCosto = numeric_limits<double>::max();
-    bool primerIter = true;
+    {
+        lock_guard<mutex> lk(mtxMejor);
+        mejorCosto.store(numeric_limits<double>::max());
+        mejorSol.reset();
+        mejorIter = -1;
+        if (solucionInicial && solucionInicial->esFactible() && solucionInicial->vistoTodos()) {
+            mejorSol.reset(new Solucion(*solucionInicial));
+            mejorCosto.store(mejorSol->getCostoTotal());
+        }
+    }
+    iteracionesRealizadas.store(0);
+    realizadasAlMejorar.store(0);
+    control.reiniciar();
+
+    probabilidadesK.assign(valoresK.size(), valoresK.empty() ? 0.0 : 1.0 / valoresK.size());
+    sumaCostosK.assign(valoresK.size(), 0.0);
+    usosK.assign(valoresK.size(), 0);
+    intentosK.assign(valoresK.size(), 0);
+    int proximaActualizacion = periodoReactivo;
+
+    mejorasPorRelinking.store(0);
+    poolElite.reset();
+    if (tamPoolElite > 0) {
+        int diferenciaMinima = diferenciaMinimaElite >= 0
+            ? diferenciaMinimaElite
+            : max(2, inst.getCantClientes() / 10);
+        poolElite.reset(new PoolElite(tamPoolElite, diferenciaMinima));
+        if (mejorSol)
+            poolElite->intentarAgregar(SolucionCompacta(inst, inst.rutasDesde(*mejorSol)));
+    }
 
-    for (int iter = 0; iter < numIter; ++iter) {
-        Solucion sol = construirConRCL(kRCL);
+    mejorasPorRecombinacion = 0;
+    poolRutas.reset();
+    int proximaRecombinacion = periodoRecombinacion;
+    if (periodoRecombinacion > 0) {
+        poolRutas.reset(new PoolRutas(inst, capacidadPoolRutas));
+        if (mejorSol)
+            poolRutas->agregarRutas(inst.rutasDesde(*mejorSol));
+    }
 
-        OperadorSwap swapOp(sol);
-        sol = swapOp.aplicar();
+    costoPorHash.clear();
+    iteracionesOmitidas.store(0);
+    iteracionesFiltradas.store(0);
 
-        OperadorRelocate relocateOp(sol);
-        sol = relocateOp.aplicar();
+    bool sinLimiteIter = numIter <= 0 && control.getCriterio().tieneLimite();
+    PoolHilos pool(numHilos);
+    vector<EspacioTrabajo> espacios(pool.getCantidadHilos());
+    int tamLote = poolElite ? ITERACIONES_POR_LOTE_ELITE
+                            : pool.getCantidadHilos() * ITERACIONES_POR_LOTE_Y_HILO;
+    vector<ResultadoIteracion> resultados(tamLote);
 
-        // ✅ Check robusto antes de comparar costo
-        if (!sol.esFactible() || !sol.vistoTodos())
+    if (pipeline && pool.getCantidadHilos() > 1) {
+        resolverPipeline(pool, espacios, sinLimiteIter);
+        return getMejorSolucion();
+    }
+
+    int cantidad = 0;
+    for (int inicio = 0; sinLimiteIter || inicio < numIter; inicio += cantidad) {
+        if (control.debeDetenerse())
+            break;
+        cantidad = sinLimiteIter ? tamLote : min(tamLote, numIter - inicio);
+        if (!valoresK.empty())
+            cantidad = min(cantidad, proximaActualizacion - inicio);
+        if (poolRutas)
+            cantidad = min(cantidad, proximaRecombinacion - inicio);
+        for (int i = 0; i < cantidad; ++i) {
+            resultados[i] = ResultadoIteracion();
+        }
+
+        // Construcción en paralelo, descarte de repetidas en orden de
+        // iteración y búsqueda local en paralelo sólo sobre las nuevas
+        pool.paraCada(cantidad, [&](int i, int hilo) {
+            construirIteracion(inicio + i, espacios[hilo], resultados[i]);
+        });
+        marcarDuplicados(resultados, cantidad);
+        pool.paraCada(cantidad, [&](int i, int hilo) {
+            if (!resultados[i].duplicada)
+                mejorarIteracion(inicio + i, espacios[hilo], resultados[i]);
+        });
+
+        for (int i = 0; i < cantidad; ++i) {
+            ResultadoIteracion& res = resultados[i];
+            if (!res.duplicada) {
+                if (res.nueva)
+                    costoPorHash[res.hash] = res.costo;
+                continue;
+            }
+            // El original es de un lote anterior o anterior en este lote,
+            // así que su costo ya está guardado
+            res.costo = costoPorHash[res.hash];
+            contarIteracion();
+        }
+
+        // El pool elite y las estadísticas se actualizan en orden de
+        // iteración para que todo sea determinístico sin importar los hilos
+        if (poolElite) {
+            for (int i = 0; i < cantidad; ++i) {
+                if (resultados[i].costo >= 0 && !resultados[i].duplicada)
+                    poolElite->intentarAgregar(SolucionCompacta(inst, resultados[i].rutas));
+            }
+        }
+        if (poolRutas) {
+            for (int i = 0; i < cantidad; ++i) {
+                if (resultados[i].costo >= 0 && !resultados[i].duplicada)
+                    poolRutas->agregarRutas(resultados[i].rutas);
+            }
+            if (inicio + cantidad >= proximaRecombinacion) {
+                recombinar(inicio + cantidad - 1);
+                proximaRecombinacion += periodoRecombinacion;
+            }
+        }
+        if (valoresK.empty())
+            continue;
+        for (int i = 0; i < cantidad; ++i) {
+            const ResultadoIteracion& res = resultados[i];
+            if (res.indiceK < 0)
+                continue;
+            intentosK[res.indiceK]++;
+            if (res.costo >= 0) {
+                sumaCostosK[res.indiceK] += res.costo;
+                usosK[res.indiceK]++;
+            }
+        }
+        if (inicio + cantidad >= proximaActualizacion) {
+            actualizarProbabilidadesK();
+            proximaActualizacion += periodoReactivo;
+        }
+    }
+
+    return getMejorSolucion();
+}
+
+void GRASP::construirIteracion(int iter, EspacioTrabajo& et, ResultadoIteracion& res) {
+    if (control.debeDetenerse())
+        return;
+
+    et.rng.sembrar(GeneradorAleatorio::derivarSemilla(semilla, iter));
+    int k = kRCL;
+    if (!valoresK.empty()) {
+        res.indiceK = elegirIndiceK(et.rng);
+        k = valoresK[res.indiceK];
+    }
+    Solucion sol = construirConRCL(k, et, res.hash);
+    if (control.debeDetenerse())
+        return;
+    res.construida.reset(new Solucion(move(sol)));
+}
+
+void GRASP::marcarDuplicados(vector<ResultadoIteracion>& resultados, int cantidad) {
+    if (!detectarDuplicados)
+        return;
+    for (int i = 0; i < cantidad; ++i) {
+        ResultadoIteracion& res = resultados[i];
+        if (!res.construida)
             continue;
+        // Se reserva la entrada; el costo se completa después de la búsqueda local
+        res.nueva = costoPorHash.emplace(res.hash, -1.0).second;
+        if (!res.nueva) {
+            res.duplicada = true;
+            res.construida.reset();
+            iteracionesOmitidas++;
+        }
+    }
+}
+
+void GRASP::resolverPipeline(PoolHilos& pool, vector<EspacioTrabajo>& espacios, bool sinLimiteIter) {
+    struct Candidata {
+        int iter = -1;
+        ResultadoIteracion res;
+    };
+
+    int hilos = pool.getCantidadHilos();
+    int constructores = hilosConstructores > 0 ? min(hilosConstructores, hilos - 1)
+                                               : max(1, hilos / 4);
+    ColaAcotada<Candidata> cola(CAPACIDAD_COLA_PIPELINE);
+    atomic<int> siguienteIter(0);
+    atomic<int> constructoresActivos(constructores);
+    atomic<double> mejorConstruccion(numeric_limits<double>::max());
+    mutex mtxHashes;
+
+    auto construir = [&](EspacioTrabajo& et) {
+        while (!control.debeDetenerse()) {
+            int iter = siguienteIter++;
+            if (!sinLimiteIter && iter >= numIter)
+                break;
+
+            Candidata c;
+            c.iter = iter;
+            et.rng.sembrar(GeneradorAleatorio::derivarSemilla(semilla, iter));
+            Solucion sol = construirConRCL(kRCL, et, c.res.hash);
+            if (control.debeDetenerse())
+                break;
 
-        if (primerIter || sol.getCostoTotal() < mejorCosto) {
-            mejorSol = sol;
-            mejorCosto = sol.getCostoTotal();
-            primerIter = false;
+            if (detectarDuplicados) {
+                lock_guard<mutex> lk(mtxHashes);
+                if (!costoPorHash.emplace(c.res.hash, -1.0).second) {
+                    iteracionesOmitidas++;
+                    contarIteracion();
+                    continue;
+                }
+            }
+
+            // Las construcciones infactibles (clientes sin ruta) no fijan
+            // la referencia del filtro
+            double costo = sol.getCostoTotal();
+            double referencia = mejorConstruccion.load(memory_order_relaxed);
+            if (sol.vistoTodos()) {
+                while (costo < referencia &&
+                       !mejorConstruccion.compare_exchange_weak(referencia, costo)) {}
+            }
+            if (filtroConstruccion >= 0 && referencia != numeric_limits<double>::max() &&
+                costo > referencia * (1 + filtroConstruccion / 100)) {
+                iteracionesFiltradas++;
+                contarIteracion();
+                continue;
+            }
+
+            c.res.construida.reset(new Solucion(move(sol)));
+            while (!cola.intentarEncolar(move(c))) {
+                if (control.debeDetenerse())
+                    return;
+                this_thread::yield();
+            }
+        }
+    };
+
+    auto mejorar = [&](EspacioTrabajo& et) {
+        Candidata c;
+        while (!control.debeDetenerse()) {
+            if (cola.intentarDesencolar(c)) {
+                mejorarIteracion(c.iter, et, c.res);
+            } else if (constructoresActivos.load() == 0) {
+                // Un constructor pudo encolar justo antes de terminar
+                if (!cola.intentarDesencolar(c))
+                    break;
+                mejorarIteracion(c.iter, et, c.res);
+            } else {
+                this_thread::yield();
+            }
         }
+    };
+
+    // Un rol por hilo: hay tantos roles como hilos y a lo sumo hilos-1
+    // constructores, así que siempre queda algún hilo vaciando la cola
+    pool.paraCada(hilos, [&](int rol, int hilo) {
+        try {
+            if (rol < constructores) {
+                construir(espacios[hilo]);
+                constructoresActivos--;
+            } else {
+                mejorar(espacios[hilo]);
+            }
+        } catch (...) {
+            if (rol < constructores)
+                constructoresActivos--;
+            control.detener();
+            throw;
+        }
+    });
+}
+
+void GRASP::mejorarIteracion(int iter, EspacioTrabajo& et, ResultadoIteracion& res) {
+    if (!res.construida || control.debeDetenerse())
+        return;
+    Solucion sol = move(*res.construida);
+    res.construida.reset();
+
+    OperadorSwap swapOp(sol);
+    swapOp.setControlParada(&control);
+    sol = swapOp.aplicar();
+    if (control.debeDetenerse())
+        return;
+
+    OperadorRelocate relocateOp(sol);
+    relocateOp.setControlParada(&control);
+    sol = relocateOp.aplicar();
+
+    bool factible = sol.esFactible() && sol.vistoTodos();
+    if (factible && maxClientesExacto > 0 && !control.debeDetenerse()) {
+        if (!et.optimizador)
+            et.optimizador.reset(new OptimizadorRuta(inst, maxClientesExacto));
+        SolucionCompacta compacta(inst, inst.rutasDesde(sol));
+        if (et.optimizador->optimizar(compacta) > 0)
+            sol = compacta.aSolucion();
+    }
+    if (factible && poolElite && poolElite->getTamano() > 0 && !control.debeDetenerse())
+        sol = relinkear(sol);
+
+    // ✅ Check robusto antes de comparar costo
+    if (factible) {
+        res.costo = sol.getCostoTotal();
+        if (poolElite || periodoRecombinacion > 0)
+            res.rutas = inst.rutasDesde(sol);
+        publicarMejora(sol, iter);
     }
+    contarIteracion();
+}
 
-    return mejorSol;
+void GRASP::contarIteracion() {
+    long realizadas = ++iteracionesRealizadas;
+    if (control.sinMejoraAgotado(realizadas - realizadasAlMejorar.load()))
+        control.detener();
 }
 
+Solucion GRASP::relinkear(const Solucion& optimoLocal) {
+    SolucionCompacta origen(inst, inst.rutasDesde(optimoLocal));
+    PathRelinking relinking(inst);
 
+    SolucionCompacta mejor = origen;
+    for (int i = 0; i < poolElite->getTamano(); ++i) {
+        SolucionCompacta candidata = relinking.aplicar(origen, poolElite->getMiembro(i));
+        if (candidata.getCosto() < mejor.getCosto() - 1e-9)
+            mejor = candidata;
+    }
+    if (mejor.getCosto() >= origen.getCosto() - 1e-9)
+        return optimoLocal;
+
+    // El mejor intermedio se pule con la misma búsqueda local
+    Solucion sol = mejor.aSolucion();
+    OperadorSwap swapOp(sol);
+    swapOp.setControlParada(&control);
+    sol = swapOp.aplicar();
+    OperadorRelocate relocateOp(sol);
+    relocateOp.setControlParada(&control);
+    sol = relocateOp.aplicar();
+    if (!sol.esFactible() || !sol.vistoTodos() ||
+        sol.getCostoTotal() >= optimoLocal.getCostoTotal())
+        return optimoLocal;
+
+    mejorasPorRelinking++;
+    return sol;
+}
 
-Solucion GRASP::construirConRCL(int k) {
-    vector<Ruta> rutas;
+void GRASP::recombinar(int iter) {
+    if (control.debeDetenerse())
+        return;
+    ParticionConjuntos particion(inst);
+    particion.setControlParada(&control);
+    vector<vector<int>> rutas;
+    if (!particion.resolver(*poolRutas, mejorCosto.load(), rutas))
+        return;
+    Solucion sol = inst.aSolucion(rutas);
+    if (!sol.esFactible() || !sol.vistoTodos())
+        return;
+    mejorasPorRecombinacion++;
+    publicarMejora(sol, iter);
+}
 
-    // Crear matriz de distancias por ID
-    int maxId = depotId;
-    for (const auto& pair : id2pos) {
-        maxId = max(maxId, pair.first);
+int GRASP::elegirIndiceK(GeneradorAleatorio& rng) const {
+    double r = rng.real01();
+    double acumulada = 0;
+    for (size_t i = 0; i + 1 < probabilidadesK.size(); ++i) {
+        acumulada += probabilidadesK[i];
+        if (r < acumulada)
+            return static_cast<int>(i);
     }
-    vector<vector<double>> idDistMatrix(maxId + 1, vector<double>(maxId + 1, 0.0));
+    return static_cast<int>(probabilidadesK.size()) - 1;
+}
 
-    for (const auto& pair1 : id2pos) {
-        for (const auto& pair2 : id2pos) {
-            idDistMatrix[pair1.first][pair2.first] = distMatrix[pair1.second][pair2.second];
+void GRASP::actualizarProbabilidadesK() {
+    double mejor = mejorCosto.load();
+    if (mejor == numeric_limits<double>::max())
+        return;
+
+    // q_i = (mejor / promedio_i)^delta, ponderado por la fracción de
+    // iteraciones factibles. Los k todavía sin probar reciben el q promedio
+    // de los demás para no descartarlos a ciegas.
+    vector<double> q(valoresK.size(), -1.0);
+    double sumaQ = 0;
+    int conDatos = 0;
+    for (size_t i = 0; i < valoresK.size(); ++i) {
+        if (intentosK[i] == 0)
+            continue;
+        q[i] = 0;
+        if (usosK[i] > 0) {
+            double promedio = sumaCostosK[i] / usosK[i];
+            double factibles = static_cast<double>(usosK[i]) / intentosK[i];
+            q[i] = (promedio > 0 ? pow(mejor / promedio, deltaReactivo) : 1.0) * factibles;
+        }
+        sumaQ += q[i];
+        conDatos++;
+    }
+    if (conDatos == 0 || sumaQ <= 0)
+        return;
+    double qSinDatos = sumaQ / conDatos;
+    for (double& qi : q) {
+        if (qi < 0) {
+            qi = qSinDatos;
+            sumaQ += qi;
         }
     }
 
-    Solucion sol(clientes, idDistMatrix, numVehiculos);
-
-    // Vector de visitados
-    int maxPos = 0;
-    for (const auto& pair : id2pos) {
-        maxPos = max(maxPos, pair.second);
+    double suma = 0;
+    for (size_t i = 0; i < valoresK.size(); ++i) {
+        probabilidadesK[i] = max(q[i] / sumaQ, PROBABILIDAD_MINIMA_K);
+        suma += probabilidadesK[i];
+    }
+    for (double& p : probabilidadesK) {
+        p /= suma;
     }
-    vector<bool> visitado(maxPos + 1, false);
-    visitado.at(id2pos.at(depotId)) = true;
+}
 
-    while (true) {
-        // Verificar si quedan clientes sin visitar
-        bool quedanClientes = false;
-        for (const Cliente& c : clientes) {
-            if (!visitado.at(id2pos.at(c.getId()))) {
-                quedanClientes = true;
-                break;
-            }
+void GRASP::publicarMejora(Solucion& sol, int iter) {
+    double costo = sol.getCostoTotal();
+    // Camino rápido sin lock: la gran mayoría de las iteraciones no mejora
+    if (costo > mejorCosto.load(memory_order_relaxed))
+        return;
+
+    lock_guard<mutex> lk(mtxMejor);
+    double actual = mejorCosto.load(memory_order_relaxed);
+    if (costo < actual || (costo == actual && iter < mejorIter)) {
+        mejorSol.reset(new Solucion(move(sol)));
+        mejorIter = iter;
+        mejorCosto.store(costo, memory_order_relaxed);
+        if (costo < actual) {
+            realizadasAlMejorar.store(iteracionesRealizadas.load());
+            if (alMejorar)
+                alMejorar(*mejorSol, control.segundos());
         }
-        if (!quedanClientes)
-            break;
+        if (control.objetivoAlcanzado(costo))
+            control.detener();
+    }
+}
+
+
+
+Solucion GRASP::construirConRCL(int k, EspacioTrabajo& et, uint64_t& hash) {
+    Solucion sol(clientes, inst.getIdDistancias(), numVehiculos);
 
-        Ruta ruta(capacidadVehiculo, depotId, idDistMatrix, clientes);
-        int actual = depotId;
+    // Vector de visitados (por posición); el depósito y las posiciones sin
+    // cliente arrancan marcadas
+    int cantPos = inst.getCantPos();
+    vector<bool>& visitado = et.visitado;
+    visitado.assign(cantPos, false);
+    for (int pos = 0; pos < cantPos; ++pos) {
+        visitado[pos] = !inst.esCliente(pos);
+    }
+
+    // cursor[p]: primer índice de la lista de vecinos de p que puede no estar
+    // visitado. Como los visitados sólo crecen, el prefijo se saltea una vez.
+    vector<int>& cursor = et.cursor;
+    cursor.assign(cantPos, 0);
+    vector<int>& rcl = et.rcl;
+    vector<int>& secuencia = et.secuencia;
+    int restantes = inst.getCantClientes();
+    hash = 0;
+
+    while (restantes > 0) {
+        if (control.debeDetenerse())
+            break;
+        secuencia.clear();
+        int actual = inst.getPosDeposito();
         int carga = 0;
-        bool added = false;
 
         while (true) {
-            vector<Cliente> KMasCercanos = buscarKcercanos(actual, visitado, k);
-            Cliente masCercano = elegirClienteRandom(KMasCercanos);
-
-            int i = 0;
-            while (masCercano.getId() == depotId && i < kRCL) {
-                masCercano = elegirClienteRandom(KMasCercanos);
-                i++;
-            }
-            if (masCercano.getId() == depotId)
+            buscarKcercanos(actual, k, et);
+            if (rcl.empty())
                 break;
+            int elegido = elegirClienteRandom(rcl, et.rng);
 
-            int demanda = masCercano.getDemand();
-            if (carga + demanda <= capacidadVehiculo) {
-                ruta.agregarCliente(masCercano.getId());
-                visitado.at(id2pos.at(masCercano.getId())) = true;
-                carga += demanda;
-                actual = masCercano.getId();
-                added = true;
-            } else {
+            int demanda = inst.getDemanda(elegido);
+            if (carga + demanda > capacidadVehiculo)
                 break;
-            }
+
+            secuencia.push_back(inst.getId(elegido));
+            hash += hashZobrist.clave(actual, elegido);
+            visitado[elegido] = true;
+            carga += demanda;
+            actual = elegido;
+            restantes--;
         }
 
-        if (added)
-            rutas.push_back(ruta);
-        else
+        if (secuencia.empty())
             break;
+        hash += hashZobrist.clave(actual, inst.getPosDeposito());
+        sol.agregarRuta(Ruta(capacidadVehiculo, depotId, inst.getIdDistancias(), clientes, secuencia));
     }
 
-    for (const auto& ruta : rutas) {
-        sol.agregarRuta(ruta);
+    return sol;
+}
+
+void GRASP::buscarKcercanos(int desde, int k, EspacioTrabajo& et) const {
+    const vector<bool>& visitado = et.visitado;
+    vector<int>& cursor = et.cursor;
+    vector<int>& rcl = et.rcl;
+    rcl.clear();
+    if (k <= 0)
+        return;
+
+    // Recorrer la lista ordenada desde el primer vecino posiblemente libre
+    const int* lista = vecinos.getVecinos(desde);
+    int largo = vecinos.getCantidadVecinos();
+    int i = cursor[desde];
+    while (i < largo && visitado[lista[i]])
+        i++;
+    cursor[desde] = i;
+    for (; i < largo && static_cast<int>(rcl.size()) < k; ++i) {
+        if (!visitado[lista[i]])
+            rcl.push_back(lista[i]);
     }
 
-    return sol;
+    if (static_cast<int>(rcl.size()) == k || vecinos.esCompleta())
+        return;
+
+    // Lista truncada agotada: elegir los k más cercanos entre todos los no visitados
+    if (!et.filas)
+        et.filas.reset(new CacheFilas(inst.getDistancias(), FILAS_EN_CACHE));
+    const double* fila = et.filas->fila(desde);
+    rcl.clear();
+    for (int pos = 0; pos < inst.getCantPos(); ++pos) {
+        if (!visitado[pos] && pos != desde)
+            rcl.push_back(pos);
+    }
+    auto menor = [fila](int a, int b) {
+        return fila[a] < fila[b] || (fila[a] == fila[b] && a < b);
+    };
+    if (static_cast<int>(rcl.size()) > k) {
+        nth_element(rcl.begin(), rcl.begin() + k, rcl.end(), menor);
+        rcl.resize(k);
+    }
 }
 
-vector<Cliente> GRASP::buscarKcercanos(int desde, const vector<bool>& visitado, int k) {
-    vector<pair<double, Cliente>> candidatos;
+int GRASP::elegirClienteRandom(const vector<int>& lista, GeneradorAleatorio& rng) const {
+    if (lista.empty())
+        return inst.getPosDeposito(); // Devuelve depósito si lista vacía
 
-    // Recorrer todos los clientes
-    for (const Cliente& c : clientes) {
-        int pos = id2pos.at(c.getId());
+    return lista[rng.enteroEn(static_cast<int>(lista.size()))];
+}
 
-        // Solo incluir si NO está visitado y no es el depósito
-        if (!visitado[pos] && c.getId() != depotId) {
-            double dist = distMatrix.at(id2pos.at(desde)).at(pos);
-            candidatos.emplace_back(dist, c);
-        }
-    }
+void GRASP::setNumHilos(int hilos) { numHilos = hilos; }
 
-    // Si no hay candidatos, devolver lista vacía
-    if (candidatos.empty())
-        return {};
+void GRASP::setCriterioParada(const CriterioParada& criterio) {
+    control.setCriterio(criterio);
+}
 
-    // Ordenar por distancia (de menor a mayor)
-    sort(candidatos.begin(), candidatos.end(),
-        [](const pair<double, Cliente>& a, const pair<double, Cliente>& b) {
-            return a.first < b.first;
-        });
+void GRASP::setAlMejorar(function<void(const Solucion&, double)> callback) {
+    alMejorar = move(callback);
+}
 
-    // Tomar los primeros k
-    size_t limite = min(static_cast<size_t>(k), candidatos.size());
-    vector<Cliente> rcl;
-    for (size_t i = 0; i < limite; ++i) {
-        rcl.push_back(candidatos[i].second);
+void GRASP::setReactivo(const vector<int>& valores, int periodo, double delta) {
+    valoresK.clear();
+    for (int k : valores) {
+        if (k > 0) valoresK.push_back(k);
     }
+    periodoReactivo = max(1, periodo);
+    deltaReactivo = delta;
+    probabilidadesK.assign(valoresK.size(), valoresK.empty() ? 0.0 : 1.0 / valoresK.size());
+}
+
+const vector<int>& GRASP::getValoresK() const { return valoresK; }
 
-    return rcl;
+const vector<double>& GRASP::getProbabilidadesK() const { return probabilidadesK; }
+
+void GRASP::setSolucionInicial(const Solucion& sol) {
+    solucionInicial.reset(new Solucion(sol));
 }
 
-Cliente GRASP::elegirClienteRandom(const vector<Cliente>& lista) {
-    if (lista.empty())
-        return Cliente(depotId, 0); // Devuelve depósito si lista vacía (puedes cambiar si querés otro comportamiento)
+void GRASP::setSemilla(uint64_t nuevaSemilla) { semilla = nuevaSemilla; }
+
+void GRASP::setOptimizarRutas(int maxClientes) { maxClientesExacto = max(0, maxClientes); }
+
+void GRASP::setPathRelinking(int tamPool, int diferenciaMinima) {
+    tamPoolElite = max(0, tamPool);
+    diferenciaMinimaElite = diferenciaMinima;
+}
+
+long GRASP::getMejorasPorRelinking() const { return mejorasPorRelinking.load(); }
+
+void GRASP::setRecombinacion(int periodo, int capacidadPool) {
+    periodoRecombinacion = max(0, periodo);
+    capacidadPoolRutas = capacidadPool;
+}
+
+long GRASP::getMejorasPorRecombinacion() const { return mejorasPorRecombinacion; }
+
+void GRASP::setPipeline(int constructores, double filtroPorcentaje) {
+    pipeline = true;
+    hilosConstructores = constructores;
+    filtroConstruccion = filtroPorcentaje;
+}
+
+long GRASP::getIteracionesFiltradas() const { return iteracionesFiltradas.load(); }
+
+void GRASP::setDetectarDuplicados(bool activar) { detectarDuplicados = activar; }
+
+long GRASP::getIteracionesOmitidas() const { return iteracionesOmitidas.load(); }
+
+void GRASP::detener() { control.detener(); }
+
+void GRASP::setControlExterno(const ControlParada* externo) { control.setExterno(externo); }
+
+Solucion GRASP::getMejorSolucion() {
+    lock_guard<mutex> lk(mtxMejor);
+    if (!mejorSol)
+        return Solucion(clientes, inst.getIdDistancias(), numVehiculos);
+    return *mejorSol;
+}
+
+double GRASP::getMejorCosto() const { return mejorCosto.load(); }
 
-    random_device rd;
-    mt19937 gen(rd());
-    uniform_int_distribution<> dis(0, lista.size() - 1);
+long GRASP::getIteracionesRealizadas() const { return iteracionesRealizadas.load(); }
 
-    return lista[dis(gen)];
-}
\ No newline at end of file
+uint64_t GRASP::getSemilla() const { return semilla; }
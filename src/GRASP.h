@@ -1,8 +1,28 @@
+#ifndef GRASP_H
+#define GRASP_H
+
 #include "Cliente.h"
 #include "Ruta.h"
 #include "Solucion.h"
 #include "OperadorSwap.h"
 #include "OperadorRelocate.h"
+#include "ListaVecinos.h"
+#include "InstanciaCompacta.h"
+#include "SolucionCompacta.h"
+#include "PoolElite.h"
+#include "PathRelinking.h"
+#include "OptimizadorRuta.h"
+#include "CacheFilas.h"
+#include "PoolRutas.h"
+#include "HashZobrist.h"
+#include "GeneradorAleatorio.h"
+#include "PoolHilos.h"
+#include "CriterioParada.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include <iostream>
@@ -13,17 +33,116 @@ using namespace std;
 class GRASP {
 private:
     const vector<Cliente>& clientes;
-    const vector<vector<double>>& distMatrix;
-    const unordered_map<int, int>& id2pos;
     int capacidadVehiculo;
     int depotId;
     int numVehiculos;
     int numIter;
     int kRCL;
+    uint64_t semilla;
+
+    // Datos por instancia, armados una sola vez en el constructor o
+    // recibidos ya armados (y compartidos con otros solvers: sólo se leen)
+    shared_ptr<const InstanciaCompacta> instancia;
+    shared_ptr<const ListaVecinos> listaVecinos;
+    const InstanciaCompacta& inst;
+    const ListaVecinos& vecinos;
+    int numHilos;
+    unique_ptr<Solucion> solucionInicial;
+    int maxClientesExacto;  // 0: no se reordenan las rutas
+
+    // Memoria de trabajo de cada hilo, reutilizada entre iteraciones
+    struct EspacioTrabajo {
+        GeneradorAleatorio rng;
+        vector<bool> visitado;
+        vector<int> cursor;
+        vector<int> rcl;
+        vector<int> secuencia;
+        unique_ptr<OptimizadorRuta> optimizador;  // se crea al primer uso
+        unique_ptr<CacheFilas> filas;             // ídem
+    };
+
+    // Mejor solución compartida entre hilos: el costo se consulta sin lock
+    // y la solución sólo se reemplaza bajo el mutex cuando hay mejora.
+    atomic<double> mejorCosto;
+    mutex mtxMejor;
+    unique_ptr<Solucion> mejorSol;
+    int mejorIter;
+
+    // Criterios de corte; se consultan entre y dentro de las iteraciones
+    ControlParada control;
+    atomic<long> iteracionesRealizadas;
+    atomic<long> realizadasAlMejorar;
+    function<void(const Solucion&, double)> alMejorar;
+
+    // GRASP reactivo: valores candidatos de k con probabilidades que se
+    // recalculan cada `periodoReactivo` iteraciones según el costo promedio
+    // obtenido con cada uno. Vacío = k fijo (kRCL).
+    vector<int> valoresK;
+    vector<double> probabilidadesK;
+    vector<double> sumaCostosK;
+    vector<long> usosK;     // iteraciones factibles con cada k
+    vector<long> intentosK; // todas las iteraciones con cada k
+    int periodoReactivo;
+    double deltaReactivo;
+
+    // Pool de soluciones elite y path relinking desde cada óptimo local
+    // hacia sus miembros. El pool sólo cambia entre lotes, así que durante
+    // un lote los hilos lo leen sin sincronización.
+    int tamPoolElite;
+    int diferenciaMinimaElite;
+    unique_ptr<PoolElite> poolElite;
+    atomic<long> mejorasPorRelinking;
+
+    // Pool de rutas distintas de todas las iteraciones; cada
+    // `periodoRecombinacion` iteraciones se busca entre ellas, por
+    // partición de conjuntos, una solución mejor que la mejor conocida
+    int periodoRecombinacion;
+    int capacidadPoolRutas;
+    unique_ptr<PoolRutas> poolRutas;
+    long mejorasPorRecombinacion;
+
+    // Detección de construcciones repetidas: el hash de aristas de cada
+    // solución construida se busca entre los ya optimizados y, si aparece,
+    // la búsqueda local se saltea y la iteración hereda el costo guardado.
+    bool detectarDuplicados;
+    HashZobrist hashZobrist;
+    unordered_map<uint64_t, double> costoPorHash;
+    atomic<long> iteracionesOmitidas;
 
-    Cliente elegirClienteRandom(const vector<Cliente>& lista);
-    vector<Cliente> buscarKcercanos(int desde, const vector<bool>& visitado, int k);
-    Solucion construirConRCL(int k);
+    // Modo pipeline: hilos constructores y de búsqueda local conectados por
+    // una cola acotada. Opcionalmente sólo se mejoran las construcciones a
+    // menos de `filtroConstruccion` % de la mejor construcción vista.
+    bool pipeline;
+    int hilosConstructores;
+    double filtroConstruccion;
+    atomic<long> iteracionesFiltradas;
+
+    // Lo que cada iteración le informa al hilo que reparte los lotes
+    struct ResultadoIteracion {
+        int indiceK = -1;
+        double costo = -1;  // < 0: iteración abortada o infactible
+        vector<vector<int>> rutas;  // solución final, por posiciones
+        unique_ptr<Solucion> construida;  // null: construcción abortada
+        uint64_t hash = 0;
+        bool nueva = false;      // primera aparición de su hash
+        bool duplicada = false;
+    };
+
+    Solucion relinkear(const Solucion& optimoLocal);
+    void recombinar(int iter);
+
+    int elegirIndiceK(GeneradorAleatorio& rng) const;
+    void actualizarProbabilidadesK();
+
+    int elegirClienteRandom(const vector<int>& lista, GeneradorAleatorio& rng) const;
+    void buscarKcercanos(int desde, int k, EspacioTrabajo& et) const;
+    Solucion construirConRCL(int k, EspacioTrabajo& et, uint64_t& hash);
+    void construirIteracion(int iter, EspacioTrabajo& et, ResultadoIteracion& res);
+    void mejorarIteracion(int iter, EspacioTrabajo& et, ResultadoIteracion& res);
+    void marcarDuplicados(vector<ResultadoIteracion>& resultados, int cantidad);
+    void resolverPipeline(PoolHilos& pool, vector<EspacioTrabajo>& espacios, bool sinLimiteIter);
+    void contarIteracion();
+    void publicarMejora(Solucion& sol, int iter);
 
 public:
     GRASP(const vector<Cliente>& clientes,
@@ -33,8 +152,107 @@ public:
           int depotId,
           int numVehiculos,
           int numIter,
-          int kRCL);
+          int kRCL,
+          uint64_t semilla = 0);
+    // Igual, con distancias por posición de cualquier proveedor (con uno por
+    // coordenadas no se arma ninguna matriz de n^2)
+    GRASP(const vector<Cliente>& clientes,
+          shared_ptr<const ProveedorDistancias> distancias,
+          const unordered_map<int, int>& id2pos,
+          int capacidadVehiculo,
+          int depotId,
+          int numVehiculos,
+          int numIter,
+          int kRCL,
+          uint64_t semilla = 0);
+    // Sobre una instancia ya armada, que puede compartirse entre varios
+    // solvers; vecinos == nullptr arma las listas de crearVecinos
+    GRASP(shared_ptr<const InstanciaCompacta> instancia,
+          shared_ptr<const ListaVecinos> vecinos,
+          int numIter,
+          int kRCL,
+          uint64_t semilla = 0);
+    // Las listas de vecinos que usa GRASP con RCL de tamaño kRCL
+    static shared_ptr<const ListaVecinos> crearVecinos(const InstanciaCompacta& inst, int kRCL);
 
-    // Construcción randomizada con RCL
+    // Construcción randomizada con RCL. La iteración i usa un generador
+    // sembrado con derivarSemilla(semilla, i) y, entre soluciones de igual
+    // costo, gana la de menor iteración: misma semilla, misma solución, sin
+    // importar la cantidad de hilos.
     Solucion resolver();
+
+    // Cantidad de hilos para repartir las iteraciones (<= 0: todos los núcleos)
+    void setNumHilos(int hilos);
+
+    // Arranca con esta solución como la mejor (y en el pool elite, si está
+    // activo), así las iteraciones sólo la reemplazan si la mejoran
+    void setSolucionInicial(const Solucion& sol);
+    // Cambia la semilla de las próximas corridas
+    void setSemilla(uint64_t nuevaSemilla);
+
+    // Tras la búsqueda local cada ruta se reordena con OptimizadorRuta:
+    // exacto hasta `maxClientes` clientes (12 por defecto), 2-opt y Or-opt
+    // en las más largas. 0 lo desactiva.
+    void setOptimizarRutas(int maxClientes);
+
+    // Corte por tiempo, costo objetivo o iteraciones sin mejora. Con algún
+    // criterio activo, numIter <= 0 significa sin límite de iteraciones.
+    // Con más de un hilo, el corte por iteraciones sin mejora (y, claro, el
+    // de tiempo) depende del orden en que terminan las iteraciones.
+    void setCriterioParada(const CriterioParada& criterio);
+
+    // Se invoca (serializado) cada vez que mejora la mejor solución, con los
+    // segundos transcurridos desde el inicio de resolver()
+    void setAlMejorar(function<void(const Solucion&, double)> callback);
+
+    // Activa el modo reactivo: cada iteración sortea su k entre `valores`.
+    // Cada `periodo` iteraciones la probabilidad de cada k pasa a ser
+    // proporcional a (mejor costo / costo promedio con ese k)^delta. Las
+    // actualizaciones caen siempre en las mismas iteraciones, así que el
+    // resultado sigue sin depender de la cantidad de hilos.
+    void setReactivo(const vector<int>& valores, int periodo = 100, double delta = 10.0);
+    const vector<int>& getValoresK() const;
+    const vector<double>& getProbabilidadesK() const;
+
+    // Activa el pool elite (tamaño > 0) con path relinking. La diversidad
+    // mínima se mide en aristas distintas; < 0 usa un 10% de los clientes.
+    void setPathRelinking(int tamPool, int diferenciaMinima = -1);
+    long getMejorasPorRelinking() const;
+
+    // Activa la recombinación (periodo > 0): las rutas de cada óptimo
+    // local van a un pool de hasta `capacidadPool` rutas y cada `periodo`
+    // iteraciones se resuelve la partición de conjuntos sobre el pool. No
+    // se usa en modo pipeline.
+    void setRecombinacion(int periodo, int capacidadPool = 20000);
+    long getMejorasPorRecombinacion() const;
+
+    // Saltea la búsqueda local de soluciones construidas ya vistas.
+    // Desactivado por defecto: guardar un hash por iteración sólo conviene
+    // cuando la RCL es chica y las construcciones se repiten.
+    void setDetectarDuplicados(bool activar);
+    long getIteracionesOmitidas() const;
+
+    // Activa el modo pipeline: `constructores` hilos (<= 0: un cuarto del
+    // total) construyen soluciones y el resto les aplica búsqueda local.
+    // Con filtroPorcentaje >= 0 se descartan las construcciones que superan
+    // en más de ese porcentaje a la mejor construcción. En este modo no se
+    // usan GRASP reactivo ni path relinking, y el resultado depende del
+    // orden en que terminan los hilos; con un solo hilo no tiene efecto.
+    void setPipeline(int constructores = 0, double filtroPorcentaje = -1);
+    long getIteracionesFiltradas() const;
+
+    // Pide cortar la corrida en curso; puede llamarse desde otro hilo
+    void detener();
+    // Control de quien contiene a esta corrida: su detención la corta aunque
+    // llegue antes de resolver(), que no la limpia
+    void setControlExterno(const ControlParada* externo);
+
+    // Mejor solución encontrada hasta el momento (vacía si no hay ninguna)
+    Solucion getMejorSolucion();
+    double getMejorCosto() const;
+    long getIteracionesRealizadas() const;
+
+    uint64_t getSemilla() const;
 };
+
+#endif
@@ -0,0 +1,35 @@
+#include "GeneradorAleatorio.h"
+#include <random>
+
+using namespace std;
+
+static uint64_t splitmix64(uint64_t& x) {
+    uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+GeneradorAleatorio::GeneradorAleatorio(uint64_t semilla) {
+    sembrar(semilla);
+}
+
+void GeneradorAleatorio::sembrar(uint64_t semilla) {
+    // splitmix64 garantiza un estado no nulo aun con semilla 0
+    uint64_t x = semilla;
+    for (uint64_t& palabra : s) {
+        palabra = splitmix64(x);
+    }
+}
+
+uint64_t GeneradorAleatorio::derivarSemilla(uint64_t semillaMaestra, uint64_t flujo) {
+    uint64_t x = semillaMaestra;
+    uint64_t y = splitmix64(x) ^ flujo;
+    splitmix64(y);
+    return splitmix64(y);
+}
+
+uint64_t GeneradorAleatorio::semillaAleatoria() {
+    random_device rd;
+    return (static_cast<uint64_t>(rd()) << 32) ^ rd();
+}
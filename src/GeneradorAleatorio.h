@@ -0,0 +1,55 @@
+#ifndef GENERADOR_ALEATORIO_H
+#define GENERADOR_ALEATORIO_H
+
+#include <cstdint>
+
+// Generador xoshiro256** para uso en los algoritmos. Es barato de copiar y de
+// resembrar, así que cada hilo de trabajo tiene el suyo y lo resiembra con una
+// semilla derivada de la semilla maestra: la misma semilla da la misma corrida.
+// Cumple con UniformRandomBitGenerator (sirve para std::shuffle y <random>).
+class GeneradorAleatorio {
+public:
+    using result_type = uint64_t;
+
+    explicit GeneradorAleatorio(uint64_t semilla = 0);
+
+    void sembrar(uint64_t semilla);
+
+    // Semilla independiente para el flujo `flujo` (hilo, iteración, isla, ...)
+    static uint64_t derivarSemilla(uint64_t semillaMaestra, uint64_t flujo);
+
+    // Semilla no determinística, para cuando el usuario no especifica una
+    static uint64_t semillaAleatoria();
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT64_MAX; }
+
+    result_type operator()() {
+        const uint64_t resultado = rotl(s[1] * 5, 7) * 9;
+        const uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        return resultado;
+    }
+
+    // Entero uniforme en [0, n), n > 0
+    int enteroEn(int n) {
+        return static_cast<int>((((*this)() >> 32) * static_cast<uint64_t>(n)) >> 32);
+    }
+
+    // Real uniforme en [0, 1)
+    double real01() {
+        return static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+    }
+
+private:
+    uint64_t s[4];
+
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+};
+
+#endif
@@ -0,0 +1,26 @@
+#include "HashZobrist.h"
+
+HashZobrist::HashZobrist(int cantPos, uint64_t semilla)
+    : cantPos(cantPos),
+      semilla(semilla)
+{}
+
+uint64_t HashZobrist::hashRuta(const vector<int>& ruta, int deposito) const {
+    if (ruta.empty())
+        return 0;
+    uint64_t h = 0;
+    int anterior = deposito;
+    for (int pos : ruta) {
+        h += clave(anterior, pos);
+        anterior = pos;
+    }
+    return h + clave(anterior, deposito);
+}
+
+uint64_t HashZobrist::hashRutas(const vector<vector<int>>& rutas, int deposito) const {
+    uint64_t h = 0;
+    for (const vector<int>& ruta : rutas) {
+        h += hashRuta(ruta, deposito);
+    }
+    return h;
+}
@@ -0,0 +1,37 @@
+#ifndef HASH_ZOBRIST_H
+#define HASH_ZOBRIST_H
+
+#include "GeneradorAleatorio.h"
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+// Hash estilo Zobrist del conjunto de aristas de una solución: cada arista no
+// dirigida (a, b) tiene una clave pseudoaleatoria y el hash es la suma de las
+// claves. Se suma en vez de hacer XOR para que la arista depósito-cliente
+// repetida de una ruta de un solo cliente no se cancele. No depende del
+// sentido ni del orden de las rutas y se actualiza en O(1) al agregar o
+// quitar una arista.
+class HashZobrist {
+private:
+    int cantPos;
+    uint64_t semilla;
+
+public:
+    explicit HashZobrist(int cantPos, uint64_t semilla = 0);
+
+    uint64_t clave(int a, int b) const {
+        if (a > b) { int t = a; a = b; b = t; }
+        return GeneradorAleatorio::derivarSemilla(
+            semilla, static_cast<uint64_t>(a) * cantPos + b);
+    }
+
+    // Hash de una ruta (posiciones, sin depósitos) cerrada en `deposito`
+    uint64_t hashRuta(const vector<int>& ruta, int deposito) const;
+
+    // Hash de una solución completa, suma de los de sus rutas
+    uint64_t hashRutas(const vector<vector<int>>& rutas, int deposito) const;
+};
+
+#endif
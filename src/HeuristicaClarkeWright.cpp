@@ -14,44 +14,68 @@ HeuristicaClarkeWright::HeuristicaClarkeWright(
     int depotId,
     int numVehiculos)
     : clientes(clientes),
-      distMatrix(distMatrix),
+      distMatrix(&distMatrix),
       capacidadVehiculo(capacidadVehiculo),
       depotId(depotId),
-      numVehiculos(numVehiculos)
+      numVehiculos(numVehiculos),
+      control(nullptr)
 {}
 
-Solucion HeuristicaClarkeWright::resolver() {
-    // Build idDistMatrix
-    int maxId = depotId;
-    for (const auto& c : clientes)
-        maxId = std::max(maxId, c.getId());
-
-    vector<vector<double>> idDistMatrix(maxId + 1, vector<double>(maxId + 1, 0.0));
+HeuristicaClarkeWright::HeuristicaClarkeWright(
+    const vector<Cliente>& clientes,
+    shared_ptr<const ProveedorDistancias> distancias,
+    int capacidadVehiculo,
+    int depotId,
+    int numVehiculos)
+    : clientes(clientes),
+      distMatrix(nullptr),
+      distancias(move(distancias)),
+      capacidadVehiculo(capacidadVehiculo),
+      depotId(depotId),
+      numVehiculos(numVehiculos),
+      control(nullptr)
+{}
 
-    // Copy distances
-    for (const auto& c1 : clientes) {
-        for (const auto& c2 : clientes) {
-            idDistMatrix[c1.getId()][c2.getId()] = distMatrix[c1.getId()][c2.getId()];
+Solucion HeuristicaClarkeWright::resolver() {
+    shared_ptr<const ProveedorDistancias> idDist = distancias;
+    if (!idDist) {
+        // Build idDistMatrix
+        int maxId = depotId;
+        for (const auto& c : clientes)
+            maxId = std::max(maxId, c.getId());
+
+        auto idDistMatrix = make_shared<vector<vector<double>>>(
+            maxId + 1, vector<double>(maxId + 1, 0.0));
+
+        // Copy distances
+        for (const auto& c1 : clientes) {
+            for (const auto& c2 : clientes) {
+                (*idDistMatrix)[c1.getId()][c2.getId()] = (*distMatrix)[c1.getId()][c2.getId()];
+            }
         }
+        // Include depot distances
+        for (const auto& c : clientes) {
+            (*idDistMatrix)[depotId][c.getId()] = (*distMatrix)[depotId][c.getId()];
+            (*idDistMatrix)[c.getId()][depotId] = (*distMatrix)[c.getId()][depotId];
+        }
+        (*idDistMatrix)[depotId][depotId] = 0.0;
+        idDist = make_shared<const ProveedorDistancias>(
+            shared_ptr<const vector<vector<double>>>(move(idDistMatrix)));
     }
-    // Include depot distances
-    for (const auto& c : clientes) {
-        idDistMatrix[depotId][c.getId()] = distMatrix[depotId][c.getId()];
-        idDistMatrix[c.getId()][depotId] = distMatrix[c.getId()][depotId];
-    }
-    idDistMatrix[depotId][depotId] = 0.0;
 
     // Initialize single-customer routes
     vector<Ruta> rutas;
-    inicializarRutas(rutas, idDistMatrix);
+    inicializarRutas(rutas, idDist);
 
-    Solucion sol(clientes, idDistMatrix, numVehiculos);
+    Solucion sol(clientes, idDist, numVehiculos);
 
     // Compute savings
-    vector<Ahorro> ahorros = calcularAhorros(idDistMatrix);
+    vector<Ahorro> ahorros = calcularAhorros(*idDist);
 
     // Merge routes
     for (const auto& ahorro : ahorros) {
+        if (control && control->debeDetenerse())
+            break;
         int id1 = ahorro.cliente_i;
         int id2 = ahorro.cliente_j;
 
@@ -66,7 +90,7 @@ Solucion HeuristicaClarkeWright::resolver() {
 
         if (idx1 != -1 && idx2 != -1 && idx1 != idx2) {
             if (esFactibleFusion(rutas[idx1], rutas[idx2], id1, id2)) {
-                fusionarRutas(rutas, idx1, idx2, id1, id2, idDistMatrix);
+                fusionarRutas(rutas, idx1, idx2, id1, id2, idDist);
             }
         }
     }
@@ -78,8 +102,12 @@ Solucion HeuristicaClarkeWright::resolver() {
     return sol;
 }
 
+void HeuristicaClarkeWright::setControlParada(const ControlParada* nuevo) {
+    control = nuevo;
+}
+
 vector<HeuristicaClarkeWright::Ahorro>
-HeuristicaClarkeWright::calcularAhorros(const vector<vector<double>>& idDistMatrix) {
+HeuristicaClarkeWright::calcularAhorros(const ProveedorDistancias& idDist) {
     vector<Ahorro> ahorros;
 
     for (size_t i = 0; i < clientes.size(); ++i) {
@@ -91,9 +119,9 @@ HeuristicaClarkeWright::calcularAhorros(const vector<vector<double>>& idDistMatr
                 continue;
 
             double ahorro =
-                idDistMatrix[depotId][clientes[i].getId()] +
-                idDistMatrix[clientes[j].getId()][depotId] -
-                idDistMatrix[clientes[i].getId()][clientes[j].getId()];
+                idDist(depotId, clientes[i].getId()) +
+                idDist(clientes[j].getId(), depotId) -
+                idDist(clientes[i].getId(), clientes[j].getId());
 
             ahorros.emplace_back(ahorro, clientes[i].getId(), clientes[j].getId());
         }
@@ -105,13 +133,13 @@ HeuristicaClarkeWright::calcularAhorros(const vector<vector<double>>& idDistMatr
 
 void HeuristicaClarkeWright::inicializarRutas(
     vector<Ruta>& rutas,
-    const vector<vector<double>>& idDistMatrix) {
+    const shared_ptr<const ProveedorDistancias>& idDist) {
     rutas.clear();
     for (const auto& cliente : clientes) {
         if (cliente.getId() == depotId)
             continue;
         vector<int> soloCliente = {cliente.getId()};
-        rutas.emplace_back(capacidadVehiculo, depotId, idDistMatrix, clientes, soloCliente);
+        rutas.emplace_back(capacidadVehiculo, depotId, idDist, clientes, soloCliente);
     }
 }
 
@@ -141,7 +169,7 @@ void HeuristicaClarkeWright::fusionarRutas(
     int idx2,
     int id1,
     int id2,
-    const vector<vector<double>>& idDistMatrix) {
+    const shared_ptr<const ProveedorDistancias>& idDist) {
     Ruta& r1 = rutas[idx1];
     Ruta& r2 = rutas[idx2];
 
@@ -169,7 +197,7 @@ void HeuristicaClarkeWright::fusionarRutas(
         nuevaRuta.insert(nuevaRuta.end(), sub2.begin(), sub2.end());
     }
 
-    Ruta nueva(capacidadVehiculo, depotId, idDistMatrix, clientes, nuevaRuta);
+    Ruta nueva(capacidadVehiculo, depotId, idDist, clientes, nuevaRuta);
 
     if (idx1 > idx2) {
         rutas.erase(rutas.begin() + idx1);
@@ -2,11 +2,13 @@
 #define HEURISTICA_CLARKE_WRIGHT_H
 
 #include <iostream>
+#include <memory>
 #include <vector>
 #include "VRPLIBReader.h"
 #include "Cliente.h"
 #include "Ruta.h"
 #include "Solucion.h"
+#include "CriterioParada.h"
 
 using namespace std;
 
@@ -18,9 +20,21 @@ public:
                            int capacidadVehiculo,
                            int depotId,
                            int numVehiculos);
+    // Con distancias por ID de cualquier proveedor (por ejemplo, la caché
+    // mapeada del lector), sin copiarlas a una matriz
+    HeuristicaClarkeWright(const vector<Cliente>& clientes,
+                           shared_ptr<const ProveedorDistancias> distancias,
+                           int capacidadVehiculo,
+                           int depotId,
+                           int numVehiculos);
 
     Solucion resolver();
 
+    // Si se indica, se revisa entre fusiones: al pedir detenerse devuelve
+    // las rutas fusionadas hasta ese momento (todos los clientes quedan
+    // visitados, quizás con más rutas que vehículos)
+    void setControlParada(const ControlParada* control);
+
     // Make Ahorro public because it appears in function return types
     struct Ahorro {
         double valor;
@@ -32,21 +46,24 @@ public:
 
 private:
     const vector<Cliente>& clientes;
-    const vector<vector<double>>& distMatrix;
+    // Una de las dos: la matriz se copia por ID al resolver
+    const vector<vector<double>>* distMatrix;
+    shared_ptr<const ProveedorDistancias> distancias;
     int capacidadVehiculo;
     int depotId;
     int numVehiculos;
+    const ControlParada* control;
 
     void inicializarRutas(vector<Ruta>& rutas,
-                          const vector<vector<double>>& idDistMatrix);
+                          const shared_ptr<const ProveedorDistancias>& idDist);
 
-    vector<Ahorro> calcularAhorros(const vector<vector<double>>& idDistMatrix);
+    vector<Ahorro> calcularAhorros(const ProveedorDistancias& idDist);
 
     bool esFactibleFusion(const Ruta& r1, const Ruta& r2, int id1, int id2);
 
     void fusionarRutas(vector<Ruta>& rutas,
                        int idx1, int idx2, int id1, int id2,
-                       const vector<vector<double>>& idDistMatrix);
+                       const shared_ptr<const ProveedorDistancias>& idDist);
 };
 
 #endif
@@ -1,4 +1,5 @@
 #include "HeuristicaInsercionCercana.h"
+#include "InsercionCercana.h"
 #include <limits>
 #include <algorithm>
 #include <iostream>
@@ -12,26 +13,49 @@ HeuristicaInsercionCercana::HeuristicaInsercionCercana(
     int depotId,
     int numVehiculos)
   : clientes(clientes),
-    distMatrix(distMatrix),
+    distMatrix(&distMatrix),
     id2pos(id2pos),
     capacidadVehiculo(capacidadVehiculo),
     depotId(depotId),
-    numVehiculos(numVehiculos)
+    numVehiculos(numVehiculos),
+    control(nullptr)
+{}
+
+HeuristicaInsercionCercana::HeuristicaInsercionCercana(
+    const std::vector<Cliente>& clientes,
+    std::shared_ptr<const ProveedorDistancias> distancias,
+    int capacidadVehiculo,
+    int depotId,
+    int numVehiculos)
+  : clientes(clientes),
+    distMatrix(nullptr),
+    distancias(std::move(distancias)),
+    capacidadVehiculo(capacidadVehiculo),
+    depotId(depotId),
+    numVehiculos(numVehiculos),
+    control(nullptr)
 {}
 
 Solucion HeuristicaInsercionCercana::resolver() {
-    // 1) Reconstruir matriz de distancias ID→ID
-    int maxId = depotId;
-    for (const auto &p : id2pos) maxId = std::max(maxId, p.first);
-    std::vector<std::vector<double>> idDist(maxId+1, std::vector<double>(maxId+1, 0.0));
-    for (const auto &p1 : id2pos) {
-        for (const auto &p2 : id2pos) {
-            idDist[p1.first][p2.first] = distMatrix[p1.second][p2.second];
+    // 1) Reconstruir matriz de distancias ID→ID (si no vinieron por ID)
+    std::shared_ptr<const ProveedorDistancias> distancias = this->distancias;
+    if (!distancias) {
+        int maxId = depotId;
+        for (const auto &p : id2pos) maxId = std::max(maxId, p.first);
+        auto matriz = std::make_shared<std::vector<std::vector<double>>>(
+            maxId+1, std::vector<double>(maxId+1, 0.0));
+        for (const auto &p1 : id2pos) {
+            for (const auto &p2 : id2pos) {
+                (*matriz)[p1.first][p2.first] = (*distMatrix)[p1.second][p2.second];
+            }
         }
+        distancias = std::make_shared<const ProveedorDistancias>(
+            std::shared_ptr<const std::vector<std::vector<double>>>(std::move(matriz)));
     }
+    const ProveedorDistancias& idDist = *distancias;
 
     // 2) Inicializar solución
-    Solucion sol(clientes, idDist, numVehiculos);
+    Solucion sol(clientes, distancias, numVehiculos);
 
     // 3) Conjunto de clientes no visitados (IDs)
     std::set<int> unvisited;
@@ -40,6 +64,8 @@ Solucion HeuristicaInsercionCercana::resolver() {
     // 4) Construir rutas hasta agotar clientes o vehículos
     while (!unvisited.empty() &&
            sol.getRutas().size() < static_cast<size_t>(numVehiculos)) {
+        if (control && control->debeDetenerse())
+            break;
         std::vector<int> seq;          // Secuencia de clientes para la ruta
         int carga = 0;                 // Demanda actual
 
@@ -47,7 +73,7 @@ Solucion HeuristicaInsercionCercana::resolver() {
         int firstId = -1;
         double bestD = std::numeric_limits<double>::max();
         for (int id : unvisited) {
-            double d = idDist[depotId][id];
+            double d = idDist(depotId, id);
             if (d < bestD) { bestD = d; firstId = id; }
         }
         // Si ninguno cabe en un camión, abortar
@@ -60,15 +86,15 @@ Solucion HeuristicaInsercionCercana::resolver() {
         unvisited.erase(firstId);
 
         // 4.2) Inserción de los demás clientes
-        while (true) {
+        while (!(control && control->debeDetenerse())) {
             // Buscar cliente no visitado cuyo nodo más cercano en ruta esté a distancia mínima
             int candId = -1;
             double minDist = std::numeric_limits<double>::max();
             for (int id : unvisited) {
                 // distancia mínima a cualquier nodo en ruta o depósito
-                double d0 = idDist[depotId][id];
-                double dmin = d0;
-                for (int v : seq) dmin = std::min(dmin, idDist[v][id]);
+                double dmin = distanciaCercana(
+                    idDist(depotId, id), seq.data(), static_cast<int>(seq.size()), false,
+                    [&](int v) { return idDist(v, id); }, [](int) { return true; });
                 if (dmin < minDist) { minDist = dmin; candId = id; }
             }
             if (candId < 0) break;
@@ -78,15 +104,10 @@ Solucion HeuristicaInsercionCercana::resolver() {
             if (carga + demC > capacidadVehiculo) break;
 
             // Encontrar mejor posición de inserción en seq
-            size_t bestPos = 0;
-            double bestInc = std::numeric_limits<double>::max();
-            size_t n = seq.size();
-            for (size_t i = 0; i <= n; ++i) {
-                int prev = (i==0 ? depotId : seq[i-1]);
-                int next = (i==n ? depotId : seq[i]);
-                double inc = idDist[prev][candId] + idDist[candId][next] - idDist[prev][next];
-                if (inc < bestInc) { bestInc = inc; bestPos = i; }
-            }
+            double bestInc;
+            int bestPos = mejorPosicionInsercion(
+                seq.data(), static_cast<int>(seq.size()), candId, depotId,
+                [&](int a, int b) { return idDist(a, b); }, bestInc);
             // Insertar
             seq.insert(seq.begin() + bestPos, candId);
             carga += demC;
@@ -94,7 +115,7 @@ Solucion HeuristicaInsercionCercana::resolver() {
         }
 
         // 4.3) Crear y agregar ruta a la solución
-        Ruta ruta(capacidadVehiculo, depotId, idDist, clientes, seq);
+        Ruta ruta(capacidadVehiculo, depotId, distancias, clientes, seq);
         if (!sol.agregarRuta(ruta)) {
             // Excedió vehículo
             break;
@@ -104,6 +125,10 @@ Solucion HeuristicaInsercionCercana::resolver() {
     return sol;
 }
 
+void HeuristicaInsercionCercana::setControlParada(const ControlParada* nuevo) {
+    control = nuevo;
+}
+
 Cliente HeuristicaInsercionCercana::buscarMasCercano(
     int desde,
     const std::vector<bool>&,
@@ -1,6 +1,8 @@
 #pragma once
 #include "Cliente.h"
 #include "Solucion.h"
+#include "CriterioParada.h"
+#include <memory>
 #include <vector>
 #include <unordered_map>
 
@@ -13,15 +15,30 @@ public:
         int capacidadVehiculo,
         int depotId,
         int numVehiculos);
+    // Con distancias por ID de cualquier proveedor (por ejemplo, las de
+    // InstanciaCompacta::getIdDistancias), sin copiarlas a una matriz
+    HeuristicaInsercionCercana(
+        const std::vector<Cliente>& clientes,
+        std::shared_ptr<const ProveedorDistancias> distancias,
+        int capacidadVehiculo,
+        int depotId,
+        int numVehiculos);
 
     Solucion resolver();
 
+    // Si se indica, se revisa entre inserciones: al pedir detenerse
+    // devuelve la solución parcial (no visita a todos)
+    void setControlParada(const ControlParada* control);
+
 private:
     Cliente buscarMasCercano(int desde, const std::vector<bool>& visitado, const std::vector<std::vector<double>>& distMatrix);
     std::vector<Cliente> clientes;
-    const std::vector<std::vector<double>>& distMatrix;
+    // Una de las dos: la matriz (por posición) se copia por ID al resolver
+    const std::vector<std::vector<double>>* distMatrix;
+    std::shared_ptr<const ProveedorDistancias> distancias;
     std::unordered_map<int,int> id2pos;
     int capacidadVehiculo;
     int depotId;
     int numVehiculos;
+    const ControlParada* control;
 };
@@ -0,0 +1,383 @@
+#include "HybridGeneticSearch.h"
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+// Vecinos granulares de la educación
+static const int VECINOS_BUSQUEDA_LOCAL = 20;
+
+// Corte por defecto: iteraciones sin mejora por cliente
+static const int ITERACIONES_SIN_MEJORA_POR_CLIENTE = 10;
+
+// Individuos de la población inicial, en múltiplos de mu
+static const int FACTOR_POBLACION_INICIAL = 4;
+
+// Penalización por ruta de más, relativa a la mayor distancia al depósito
+static const double PENALIZACION_RUTA_RELATIVA = 10.0;
+
+HybridGeneticSearch::HybridGeneticSearch(
+    const vector<Cliente>& clientes,
+    const vector<vector<double>>& distMatrix,
+    const unordered_map<int, int>& id2pos,
+    int capacidadVehiculo,
+    int depotId,
+    int numVehiculos,
+    uint64_t semilla)
+    : HybridGeneticSearch(clientes, make_shared<const ProveedorDistancias>(distMatrix), id2pos,
+                          capacidadVehiculo, depotId, numVehiculos, semilla)
+{}
+
+HybridGeneticSearch::HybridGeneticSearch(
+    const vector<Cliente>& clientes,
+    shared_ptr<const ProveedorDistancias> distancias,
+    const unordered_map<int, int>& id2pos,
+    int capacidadVehiculo,
+    int depotId,
+    int numVehiculos,
+    uint64_t semilla)
+    : HybridGeneticSearch(make_shared<const InstanciaCompacta>(clientes, move(distancias), id2pos,
+                                                               capacidadVehiculo, depotId, numVehiculos),
+                          semilla)
+{}
+
+HybridGeneticSearch::HybridGeneticSearch(shared_ptr<const InstanciaCompacta> compartida, uint64_t semilla)
+    : clientes(compartida->getClientes()),
+      semilla(semilla),
+      instancia(move(compartida)),
+      inst(*instancia),
+      vecinos(inst.getDistancias(), VECINOS_BUSQUEDA_LOCAL),
+      busqueda(inst, vecinos),
+      split(inst),
+      tamPoblacion(25),
+      tamGeneracion(40),
+      cantElite(4),
+      cantCercanos(5),
+      iteracionesReinicio(20000),
+      maxIteraciones(0),
+      mejorCosto(numeric_limits<double>::max()),
+      iteracionesRealizadas(0),
+      reinicios(0),
+      penalizacionRuta(0),
+      trabajo(inst)
+{
+    double maxDeposito = 0;
+    for (int pos : inst.getPosClientes()) {
+        maxDeposito = max(maxDeposito, inst.dist(inst.getPosDeposito(), pos));
+    }
+    penalizacionRuta = PENALIZACION_RUTA_RELATIVA * maxDeposito;
+}
+
+unique_ptr<HybridGeneticSearch::Individuo> HybridGeneticSearch::nuevoIndividuo() {
+    if (reserva.empty())
+        return unique_ptr<Individuo>(new Individuo());
+    unique_ptr<Individuo> ind = move(reserva.back());
+    reserva.pop_back();
+    return ind;
+}
+
+void HybridGeneticSearch::educar(const vector<int>& tour, Individuo& ind) {
+    split.dividir(tour, inst.getNumVehiculos(), ind.rutas);
+    trabajo.cargar(ind.rutas);
+    trabajo.completar();
+    busqueda.mejorar(trabajo);
+    completarIndividuo(ind);
+}
+
+void HybridGeneticSearch::completarIndividuo(Individuo& ind) {
+    // Rutas no vacías de `trabajo`, tour gigante y sucesores/predecesores
+    int deposito = inst.getPosDeposito();
+    int cantRutas = 0;
+    ind.tour.clear();
+    ind.sucesor.assign(inst.getCantPos(), deposito);
+    ind.predecesor.assign(inst.getCantPos(), deposito);
+    for (int r = 0; r < trabajo.getCantRutas(); ++r) {
+        const vector<int>& ruta = trabajo.getRuta(r);
+        if (ruta.empty())
+            continue;
+        if (static_cast<int>(ind.rutas.size()) <= cantRutas)
+            ind.rutas.emplace_back();
+        ind.rutas[cantRutas++].assign(ruta.begin(), ruta.end());
+        for (size_t i = 0; i < ruta.size(); ++i) {
+            ind.tour.push_back(ruta[i]);
+            if (i > 0) ind.predecesor[ruta[i]] = ruta[i - 1];
+            if (i + 1 < ruta.size()) ind.sucesor[ruta[i]] = ruta[i + 1];
+        }
+    }
+    ind.rutas.resize(cantRutas);
+    int exceso = max(0, cantRutas - inst.getNumVehiculos());
+    ind.factible = (exceso == 0);
+    ind.costo = trabajo.getCosto() + exceso * penalizacionRuta;
+    ind.aptitud = 0;
+}
+
+double HybridGeneticSearch::distancia(const Individuo& a, const Individuo& b) const {
+    // Pares rotos: clientes cuyo sucesor en a no es vecino suyo en b, más
+    // los que empiezan ruta en a y no en b
+    int deposito = inst.getPosDeposito();
+    int diferentes = 0;
+    for (int c : inst.getPosClientes()) {
+        if (a.sucesor[c] != b.sucesor[c] && a.sucesor[c] != b.predecesor[c])
+            diferentes++;
+        if (a.predecesor[c] == deposito && b.predecesor[c] != deposito && b.sucesor[c] != deposito)
+            diferentes++;
+    }
+    return static_cast<double>(diferentes) / max(1, inst.getCantClientes());
+}
+
+double HybridGeneticSearch::diversidad(const Individuo& ind) const {
+    int cantidad = min(cantCercanos, static_cast<int>(ind.cercanos.size()));
+    if (cantidad == 0)
+        return 0;
+    double suma = 0;
+    for (int i = 0; i < cantidad; ++i) suma += ind.cercanos[i].first;
+    return suma / cantidad;
+}
+
+void HybridGeneticSearch::agregar(unique_ptr<Individuo> ind) {
+    ind->cercanos.clear();
+    for (unique_ptr<Individuo>& otro : poblacion) {
+        double d = distancia(*ind, *otro);
+        pair<double, Individuo*> haciaOtro(d, otro.get());
+        pair<double, Individuo*> haciaNuevo(d, ind.get());
+        ind->cercanos.insert(upper_bound(ind->cercanos.begin(), ind->cercanos.end(), haciaOtro),
+                             haciaOtro);
+        otro->cercanos.insert(upper_bound(otro->cercanos.begin(), otro->cercanos.end(), haciaNuevo),
+                              haciaNuevo);
+    }
+    poblacion.push_back(move(ind));
+}
+
+void HybridGeneticSearch::quitar(int indice) {
+    Individuo* ind = poblacion[indice].get();
+    for (unique_ptr<Individuo>& otro : poblacion) {
+        vector<pair<double, Individuo*>>& lista = otro->cercanos;
+        for (size_t i = 0; i < lista.size(); ++i) {
+            if (lista[i].second == ind) {
+                lista.erase(lista.begin() + i);
+                break;
+            }
+        }
+    }
+    reserva.push_back(move(poblacion[indice]));
+    poblacion[indice] = move(poblacion.back());
+    poblacion.pop_back();
+}
+
+void HybridGeneticSearch::calcularAptitudes() {
+    // aptitud = rango por costo + (1 - elite / tamaño) * rango por
+    // diversidad, ambos en [0, 1]; menor es mejor
+    int tam = static_cast<int>(poblacion.size());
+    if (tam == 1) {
+        poblacion[0]->aptitud = 0;
+        return;
+    }
+    orden.clear();
+    for (int i = 0; i < tam; ++i) orden.emplace_back(poblacion[i]->costo, i);
+    sort(orden.begin(), orden.end());
+    rangoCosto.assign(tam, 0);
+    for (int k = 0; k < tam; ++k) rangoCosto[orden[k].second] = static_cast<double>(k) / (tam - 1);
+
+    orden.clear();
+    for (int i = 0; i < tam; ++i) orden.emplace_back(-diversidad(*poblacion[i]), i);
+    sort(orden.begin(), orden.end());
+    double pesoDiversidad = 1.0 - static_cast<double>(cantElite) / tam;
+    for (int k = 0; k < tam; ++k) {
+        int i = orden[k].second;
+        poblacion[i]->aptitud = rangoCosto[i] + pesoDiversidad * static_cast<double>(k) / (tam - 1);
+    }
+}
+
+void HybridGeneticSearch::seleccionarSobrevivientes() {
+    // Se descarta el de peor aptitud, primero entre los clones
+    while (static_cast<int>(poblacion.size()) > tamPoblacion) {
+        calcularAptitudes();
+        int peor = -1;
+        bool peorEsClon = false;
+        for (int i = 0; i < static_cast<int>(poblacion.size()); ++i) {
+            const Individuo& ind = *poblacion[i];
+            bool clon = !ind.cercanos.empty() && ind.cercanos[0].first < 1e-9;
+            if (peor < 0 || (clon && !peorEsClon) ||
+                (clon == peorEsClon && ind.aptitud > poblacion[peor]->aptitud)) {
+                peor = i;
+                peorEsClon = clon;
+            }
+        }
+        quitar(peor);
+    }
+}
+
+const HybridGeneticSearch::Individuo& HybridGeneticSearch::torneo(GeneradorAleatorio& rng) {
+    int tam = static_cast<int>(poblacion.size());
+    const Individuo& a = *poblacion[rng.enteroEn(tam)];
+    const Individuo& b = *poblacion[rng.enteroEn(tam)];
+    return a.aptitud <= b.aptitud ? a : b;
+}
+
+void HybridGeneticSearch::cruzarOX(const Individuo& padre, const Individuo& madre,
+                                   GeneradorAleatorio& rng) {
+    int n = static_cast<int>(padre.tour.size());
+    if (n < 2) {
+        tourHijo.assign(padre.tour.begin(), padre.tour.end());
+        return;
+    }
+    // El tramo nunca queda vacío ni cubre el tour entero: el hijo siempre
+    // hereda de los dos
+    int inicio = rng.enteroEn(n);
+    int largo = 1 + rng.enteroEn(n - 1);
+    enHijo.assign(inst.getCantPos(), 0);
+    cruceOX(padre.tour, madre.tour, inicio, largo, tourHijo, enHijo);
+}
+
+void HybridGeneticSearch::cruceOX(const vector<int>& padre, const vector<int>& madre, int inicio,
+                                  int largo, vector<int>& hijo, vector<char>& marca) {
+    const int n = static_cast<int>(padre.size());
+    hijo.assign(padre.begin(), padre.end());
+    int j = inicio;
+    for (int k = 0; k < largo; ++k, ++j)
+        marca[padre[j % n]] = 1;
+    const int fin = inicio + largo - 1;
+    for (int i = 1; i <= n; ++i) {
+        int c = madre[(fin + i) % n];
+        if (!marca[c]) {
+            hijo[j % n] = c;
+            j++;
+        }
+    }
+}
+
+bool HybridGeneticSearch::registrarMejora(const Individuo& ind) {
+    if (!ind.factible || ind.costo >= mejorCosto - 1e-9)
+        return false;
+    mejoresRutas = ind.rutas;
+    mejorCosto = ind.costo;
+    if (alMejorar)
+        alMejorar(inst.aSolucion(mejoresRutas), control.segundos());
+    if (control.objetivoAlcanzado(mejorCosto))
+        control.detener();
+    return true;
+}
+
+bool HybridGeneticSearch::poblarInicial(GeneradorAleatorio& rng) {
+    bool mejoro = false;
+    int cantidad = FACTOR_POBLACION_INICIAL * tamPoblacion;
+    for (int i = 0; i < cantidad && !control.debeDetenerse(); ++i) {
+        tourHijo.assign(inst.getPosClientes().begin(), inst.getPosClientes().end());
+        shuffle(tourHijo.begin(), tourHijo.end(), rng);
+        unique_ptr<Individuo> ind = nuevoIndividuo();
+        educar(tourHijo, *ind);
+        mejoro = registrarMejora(*ind) || mejoro;
+        agregar(move(ind));
+        if (static_cast<int>(poblacion.size()) >= tamPoblacion + tamGeneracion)
+            seleccionarSobrevivientes();
+    }
+    return mejoro;
+}
+
+Solucion HybridGeneticSearch::resolver() {
+    control.reiniciar();
+    iteracionesRealizadas = 0;
+    reinicios = 0;
+    mejorCosto = numeric_limits<double>::max();
+    mejoresRutas.clear();
+    while (!poblacion.empty()) quitar(static_cast<int>(poblacion.size()) - 1);
+
+    GeneradorAleatorio rng(semilla);
+    if (solucionInicial) {
+        trabajo.cargar(inst.rutasDesde(*solucionInicial));
+        trabajo.completar();
+        busqueda.mejorar(trabajo);
+        unique_ptr<Individuo> ind = nuevoIndividuo();
+        completarIndividuo(*ind);
+        registrarMejora(*ind);
+        agregar(move(ind));
+    }
+    poblarInicial(rng);
+
+    long sinMejoraPorDefecto = 0;
+    if (!control.getCriterio().tieneLimite() && maxIteraciones <= 0)
+        sinMejoraPorDefecto = static_cast<long>(ITERACIONES_SIN_MEJORA_POR_CLIENTE) *
+                              max(1, inst.getCantClientes());
+
+    long sinMejora = 0;
+    long sinMejoraReinicio = 0;
+    while (!poblacion.empty() && !control.debeDetenerse()) {
+        if (maxIteraciones > 0 && iteracionesRealizadas >= maxIteraciones)
+            break;
+        if (sinMejoraPorDefecto > 0 && sinMejora >= sinMejoraPorDefecto)
+            break;
+
+        calcularAptitudes();
+        const Individuo& padre = torneo(rng);
+        const Individuo& madre = torneo(rng);
+        cruzarOX(padre, madre, rng);
+        unique_ptr<Individuo> hijo = nuevoIndividuo();
+        educar(tourHijo, *hijo);
+        bool mejoro = registrarMejora(*hijo);
+        agregar(move(hijo));
+        iteracionesRealizadas++;
+        if (static_cast<int>(poblacion.size()) >= tamPoblacion + tamGeneracion)
+            seleccionarSobrevivientes();
+
+        if (mejoro) {
+            sinMejora = 0;
+            sinMejoraReinicio = 0;
+        } else {
+            sinMejora++;
+            sinMejoraReinicio++;
+            if (control.sinMejoraAgotado(sinMejora))
+                control.detener();
+        }
+
+        // Estancada: se regenera la población (la mejor queda guardada aparte)
+        if (iteracionesReinicio > 0 && sinMejoraReinicio >= iteracionesReinicio) {
+            while (!poblacion.empty()) quitar(static_cast<int>(poblacion.size()) - 1);
+            poblarInicial(rng);
+            reinicios++;
+            sinMejoraReinicio = 0;
+        }
+    }
+
+    // Sin ninguna solución dentro de la flota, la de menor costo penalizado
+    if (mejoresRutas.empty() && !poblacion.empty()) {
+        const Individuo* menor = poblacion[0].get();
+        for (const unique_ptr<Individuo>& ind : poblacion) {
+            if (ind->costo < menor->costo) menor = ind.get();
+        }
+        return inst.aSolucion(menor->rutas);
+    }
+    return inst.aSolucion(mejoresRutas);
+}
+
+void HybridGeneticSearch::setSolucionInicial(const Solucion& sol) {
+    solucionInicial.reset(new Solucion(sol));
+}
+
+void HybridGeneticSearch::setPoblacion(int mu, int lambda, int elite, int cercanos) {
+    tamPoblacion = mu > 0 ? mu : 25;
+    tamGeneracion = lambda > 0 ? lambda : 40;
+    cantElite = max(0, min(elite, tamPoblacion));
+    cantCercanos = cercanos > 0 ? cercanos : 5;
+}
+
+void HybridGeneticSearch::setReinicio(long iteraciones) { iteracionesReinicio = iteraciones; }
+
+void HybridGeneticSearch::setMaxIteraciones(long iteraciones) { maxIteraciones = iteraciones; }
+
+void HybridGeneticSearch::setCriterioParada(const CriterioParada& criterio) {
+    control.setCriterio(criterio);
+}
+
+void HybridGeneticSearch::setAlMejorar(function<void(const Solucion&, double)> callback) {
+    alMejorar = move(callback);
+}
+
+void HybridGeneticSearch::detener() { control.detener(); }
+
+double HybridGeneticSearch::getMejorCosto() const { return mejorCosto; }
+
+long HybridGeneticSearch::getIteracionesRealizadas() const { return iteracionesRealizadas; }
+
+long HybridGeneticSearch::getReinicios() const { return reinicios; }
+
+uint64_t HybridGeneticSearch::getSemilla() const { return semilla; }
@@ -0,0 +1,145 @@
+#ifndef HYBRID_GENETIC_SEARCH_H
+#define HYBRID_GENETIC_SEARCH_H
+
+#include "Cliente.h"
+#include "Solucion.h"
+#include "InstanciaCompacta.h"
+#include "SolucionCompacta.h"
+#include "ListaVecinos.h"
+#include "BusquedaLocalCompacta.h"
+#include "Split.h"
+#include "GeneradorAleatorio.h"
+#include "CriterioParada.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// Búsqueda genética híbrida al estilo HGS: los cromosomas son tours
+// gigantes sin depósitos, los hijos salen de un cruce OX, se decodifican
+// con Split y se educan con BusquedaLocalCompacta. La selección usa la
+// aptitud sesgada: el rango por costo más el rango por aporte a la
+// diversidad (distancia de pares rotos a los más parecidos). Los
+// individuos descartados vuelven a una reserva y se reutilizan, así que en
+// régimen no se reserva memoria por generación.
+class HybridGeneticSearch {
+private:
+    struct Individuo {
+        vector<int> tour;
+        vector<vector<int>> rutas;
+        vector<int> sucesor;     // por posición; el depósito en los extremos
+        vector<int> predecesor;
+        double costo;            // penalizado por rutas de más
+        bool factible;
+        double aptitud;
+        // Distancia a los demás individuos de la población, ordenada
+        vector<pair<double, Individuo*>> cercanos;
+    };
+
+    const vector<Cliente>& clientes;
+    uint64_t semilla;
+
+    // Propia o compartida con otros solvers (sólo se lee)
+    shared_ptr<const InstanciaCompacta> instancia;
+    const InstanciaCompacta& inst;
+    ListaVecinos vecinos;
+    BusquedaLocalCompacta busqueda;
+    Split split;
+    unique_ptr<Solucion> solucionInicial;
+
+    int tamPoblacion;     // mu
+    int tamGeneracion;    // lambda
+    int cantElite;
+    int cantCercanos;
+    long iteracionesReinicio;
+    long maxIteraciones;
+
+    ControlParada control;
+    function<void(const Solucion&, double)> alMejorar;
+
+    double mejorCosto;
+    vector<vector<int>> mejoresRutas;
+    long iteracionesRealizadas;
+    long reinicios;
+    double penalizacionRuta;
+
+    // Población y reserva de individuos descartados para reutilizar
+    vector<unique_ptr<Individuo>> poblacion;
+    vector<unique_ptr<Individuo>> reserva;
+
+    // Memoria de trabajo reutilizada entre generaciones
+    SolucionCompacta trabajo;
+    vector<int> tourHijo;
+    vector<char> enHijo;
+    vector<pair<double, int>> orden;
+    vector<double> rangoCosto;
+
+    unique_ptr<Individuo> nuevoIndividuo();
+    void educar(const vector<int>& tour, Individuo& ind);
+    void completarIndividuo(Individuo& ind);
+    double distancia(const Individuo& a, const Individuo& b) const;
+    double diversidad(const Individuo& ind) const;
+    void agregar(unique_ptr<Individuo> ind);
+    void quitar(int indice);
+    void calcularAptitudes();
+    void seleccionarSobrevivientes();
+    const Individuo& torneo(GeneradorAleatorio& rng);
+    void cruzarOX(const Individuo& padre, const Individuo& madre, GeneradorAleatorio& rng);
+    bool registrarMejora(const Individuo& ind);
+    bool poblarInicial(GeneradorAleatorio& rng);
+
+public:
+    HybridGeneticSearch(const vector<Cliente>& clientes,
+                        const vector<vector<double>>& distMatrix,
+                        const unordered_map<int, int>& id2pos,
+                        int capacidadVehiculo,
+                        int depotId,
+                        int numVehiculos,
+                        uint64_t semilla = 0);
+    // Igual, con distancias por posición de cualquier proveedor (con uno por
+    // coordenadas no se arma ninguna matriz de n^2)
+    HybridGeneticSearch(const vector<Cliente>& clientes,
+                        shared_ptr<const ProveedorDistancias> distancias,
+                        const unordered_map<int, int>& id2pos,
+                        int capacidadVehiculo,
+                        int depotId,
+                        int numVehiculos,
+                        uint64_t semilla = 0);
+    // Sobre una instancia ya armada, que puede compartirse entre varios
+    // solvers
+    HybridGeneticSearch(shared_ptr<const InstanciaCompacta> instancia, uint64_t semilla = 0);
+
+    // Cada iteración produce y educa un hijo. Sin criterio de parada ni
+    // límite de iteraciones corta tras 10 iteraciones por cliente sin
+    // mejorar la mejor solución.
+    Solucion resolver();
+
+    // Se agrega a la población inicial (educada)
+    void setSolucionInicial(const Solucion& sol);
+    // mu, lambda, individuos elite y cercanos para la diversidad
+    void setPoblacion(int mu, int lambda = 40, int elite = 4, int cercanos = 5);
+    // Iteraciones sin mejora tras las que se regenera la población
+    void setReinicio(long iteraciones);
+    void setMaxIteraciones(long iteraciones);
+    void setCriterioParada(const CriterioParada& criterio);
+    void setAlMejorar(function<void(const Solucion&, double)> callback);
+    void detener();
+
+    double getMejorCosto() const;
+    long getIteracionesRealizadas() const;
+    long getReinicios() const;
+    uint64_t getSemilla() const;
+
+    // OX sobre tours gigantes: deja en su lugar el tramo circular del padre
+    // de `largo` clientes (1..n-1) que empieza en `inicio`, y completa con
+    // el resto en el orden de la madre, desde después del tramo. `marca`
+    // debe venir en 0 con lugar para todas las posiciones.
+    static void cruceOX(const vector<int>& padre, const vector<int>& madre, int inicio, int largo,
+                        vector<int>& hijo, vector<char>& marca);
+};
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef INSERCION_CERCANA_H
+#define INSERCION_CERCANA_H
+
+#include <limits>
+
+using namespace std;
+
+// Costos del criterio de Inserción Más Cercana, compartidos por
+// HeuristicaInsercionCercana y las reparaciones de ALNS (vía
+// SolucionCompacta::mejorInsercion). Los nodos son enteros opacos: IDs en
+// una, posiciones en la otra; dist(a, b) los resuelve.
+
+// Distancia de selección de un cliente c: la menor entre alDeposito y la
+// distancia (distA(v)) a cada candidato v que esRuteado acepte. Con
+// ordenados los candidatos vienen de menor a mayor distancia (una lista de
+// vecinos) y el recorrido corta en el primero ruteado o en el que ya no
+// mejora.
+template <typename DistA, typename EsRuteado>
+double distanciaCercana(double alDeposito, const int* candidatos, int cantidad,
+                        bool ordenados, const DistA& distA, const EsRuteado& esRuteado) {
+    double d = alDeposito;
+    for (int k = 0; k < cantidad; ++k) {
+        double dv = distA(candidatos[k]);
+        if (ordenados && dv >= d)
+            break;
+        if (!esRuteado(candidatos[k]))
+            continue;
+        if (dv < d)
+            d = dv;
+        if (ordenados)
+            break;
+    }
+    return d;
+}
+
+// Mejor índice (0..largo) para insertar c en la ruta seq[0..largo), que
+// sale y vuelve a deposito; delta queda con el incremento de costo
+template <typename Dist>
+int mejorPosicionInsercion(const int* seq, int largo, int c, int deposito,
+                           const Dist& dist, double& delta) {
+    int mejor = 0;
+    delta = numeric_limits<double>::max();
+    for (int i = 0; i <= largo; ++i) {
+        int a = i > 0 ? seq[i - 1] : deposito;
+        int b = i < largo ? seq[i] : deposito;
+        double inc = dist(a, c) + dist(c, b) - dist(a, b);
+        if (inc < delta) {
+            delta = inc;
+            mejor = i;
+        }
+    }
+    return mejor;
+}
+
+#endif
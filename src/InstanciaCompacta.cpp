@@ -0,0 +1,138 @@
+#include "InstanciaCompacta.h"
+#include "Ruta.h"
+#include <algorithm>
+
+using namespace std;
+
+InstanciaCompacta::InstanciaCompacta(
+    const vector<Cliente>& clientes,
+    const vector<vector<double>>& distMatrix,
+    const unordered_map<int, int>& id2pos,
+    int capacidad,
+    int depotId,
+    int numVehiculos)
+    : InstanciaCompacta(clientes, make_shared<const ProveedorDistancias>(distMatrix), id2pos,
+                        capacidad, depotId, numVehiculos)
+{}
+
+InstanciaCompacta::InstanciaCompacta(
+    const vector<Cliente>& clientes,
+    shared_ptr<const ProveedorDistancias> distancias,
+    const unordered_map<int, int>& id2pos,
+    int capacidad,
+    int depotId,
+    int numVehiculos)
+    : InstanciaCompacta(clientes, move(distancias), nullptr, id2pos, capacidad, depotId,
+                        numVehiculos)
+{}
+
+InstanciaCompacta::InstanciaCompacta(
+    const vector<Cliente>& clientes,
+    shared_ptr<const ProveedorDistancias> distancias,
+    shared_ptr<const ProveedorDistancias> idDistancias,
+    const unordered_map<int, int>& id2pos,
+    int capacidad,
+    int depotId,
+    int numVehiculos)
+    : clientes(&clientes),
+      distancias(move(distancias)),
+      filas(this->distancias->esDensa() ? this->distancias->getMatriz().data() : nullptr),
+      capacidad(capacidad),
+      depotId(depotId),
+      numVehiculos(numVehiculos),
+      cantPos(0),
+      posDeposito(id2pos.at(depotId)),
+      simetrica(true),
+      idDistancias(move(idDistancias))
+{
+    int maxId = depotId;
+    for (const auto& pair : id2pos) {
+        cantPos = max(cantPos, pair.second + 1);
+        maxId = max(maxId, pair.first);
+    }
+
+    idPorPos.assign(cantPos, depotId);
+    demandaPorPos.assign(cantPos, 0);
+    posPorId.assign(maxId + 1, -1);
+    for (const auto& pair : id2pos) {
+        posPorId[pair.first] = pair.second;
+    }
+    for (const Cliente& c : clientes) {
+        if (c.getId() == depotId) continue;
+        int pos = id2pos.at(c.getId());
+        idPorPos[pos] = c.getId();
+        demandaPorPos[pos] = c.getDemand();
+        posClientes.push_back(pos);
+    }
+
+    if (!this->idDistancias)
+        this->idDistancias = this->distancias->reindexar(posPorId);
+
+    // Las distancias por coordenadas y las triangulares son simétricas por
+    // construcción
+    for (int a = 0; a < cantPos && simetrica && !this->distancias->simetricaPorConstruccion(); ++a) {
+        for (int b = a + 1; b < cantPos; ++b) {
+            if (dist(a, b) != dist(b, a)) {
+                simetrica = false;
+                break;
+            }
+        }
+    }
+}
+
+int InstanciaCompacta::getCantPos() const { return cantPos; }
+
+int InstanciaCompacta::getPosDeposito() const { return posDeposito; }
+
+int InstanciaCompacta::getCantClientes() const { return static_cast<int>(posClientes.size()); }
+
+int InstanciaCompacta::getCapacidad() const { return capacidad; }
+
+int InstanciaCompacta::getDepotId() const { return depotId; }
+
+bool InstanciaCompacta::esSimetrica() const { return simetrica; }
+
+int InstanciaCompacta::getNumVehiculos() const { return numVehiculos; }
+
+int InstanciaCompacta::getPos(int id) const {
+    return (id >= 0 && id < static_cast<int>(posPorId.size())) ? posPorId[id] : -1;
+}
+
+const vector<int>& InstanciaCompacta::getPosClientes() const { return posClientes; }
+
+const vector<Cliente>& InstanciaCompacta::getClientes() const { return *clientes; }
+
+const vector<vector<double>>& InstanciaCompacta::getDistMatrix() const { return distancias->getMatriz(); }
+
+const ProveedorDistancias& InstanciaCompacta::getDistancias() const { return *distancias; }
+
+const vector<vector<double>>& InstanciaCompacta::getIdDistMatrix() const { return idDistancias->getMatriz(); }
+
+const shared_ptr<const ProveedorDistancias>& InstanciaCompacta::getIdDistancias() const {
+    return idDistancias;
+}
+
+Solucion InstanciaCompacta::aSolucion(const vector<vector<int>>& rutas) const {
+    vector<Ruta> rutasSol;
+    vector<int> ids;
+    for (const vector<int>& ruta : rutas) {
+        if (ruta.empty()) continue;
+        ids.clear();
+        for (int pos : ruta) ids.push_back(idPorPos[pos]);
+        rutasSol.emplace_back(capacidad, depotId, idDistancias, *clientes, ids);
+    }
+    return Solucion(*clientes, idDistancias, numVehiculos, rutasSol);
+}
+
+vector<vector<int>> InstanciaCompacta::rutasDesde(const Solucion& sol) const {
+    vector<vector<int>> rutas;
+    for (const Ruta& ruta : sol.getRutas()) {
+        vector<int> posiciones;
+        for (int id : ruta.getClientes()) {
+            if (id == depotId) continue;
+            posiciones.push_back(getPos(id));
+        }
+        if (!posiciones.empty()) rutas.push_back(posiciones);
+    }
+    return rutas;
+}
@@ -0,0 +1,94 @@
+#ifndef INSTANCIA_COMPACTA_H
+#define INSTANCIA_COMPACTA_H
+
+#include "Cliente.h"
+#include "ProveedorDistancias.h"
+#include "Solucion.h"
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// Datos de una instancia indexados por posición (la misma convención que
+// id2pos: el depósito y cada cliente tienen una posición en la matriz de
+// distancias). Es la base de las representaciones compactas que usan las
+// metaheurísticas; se arma una vez y se comparte entre hilos (sólo lectura).
+// Las distancias vienen de un ProveedorDistancias: con uno por coordenadas
+// ninguna matriz de n^2 llega a armarse.
+class InstanciaCompacta {
+private:
+    const vector<Cliente>* clientes;
+    shared_ptr<const ProveedorDistancias> distancias;
+    // Filas de la matriz si el proveedor es denso (nullptr si no): dist()
+    // las lee directo, sin pasar por el proveedor
+    const vector<double>* filas;
+    int capacidad;
+    int depotId;
+    int numVehiculos;
+    int cantPos;
+    int posDeposito;
+    bool simetrica;
+    vector<int> idPorPos;
+    vector<int> demandaPorPos;
+    vector<int> posPorId;
+    vector<int> posClientes;
+    shared_ptr<const ProveedorDistancias> idDistancias;
+
+public:
+    // Las referencias a clientes y distMatrix deben sobrevivir a la instancia
+    InstanciaCompacta(const vector<Cliente>& clientes,
+                      const vector<vector<double>>& distMatrix,
+                      const unordered_map<int, int>& id2pos,
+                      int capacidad,
+                      int depotId,
+                      int numVehiculos);
+    // Distancias por posición; `clientes` debe sobrevivir a la instancia
+    InstanciaCompacta(const vector<Cliente>& clientes,
+                      shared_ptr<const ProveedorDistancias> distancias,
+                      const unordered_map<int, int>& id2pos,
+                      int capacidad,
+                      int depotId,
+                      int numVehiculos);
+    // Igual, con las mismas distancias ya indexadas por ID (las de Ruta y
+    // Solucion) en lugar de reindexar una copia
+    InstanciaCompacta(const vector<Cliente>& clientes,
+                      shared_ptr<const ProveedorDistancias> distancias,
+                      shared_ptr<const ProveedorDistancias> idDistancias,
+                      const unordered_map<int, int>& id2pos,
+                      int capacidad,
+                      int depotId,
+                      int numVehiculos);
+
+    double dist(int a, int b) const { return filas ? filas[a][b] : (*distancias)(a, b); }
+    int getDemanda(int pos) const { return demandaPorPos[pos]; }
+    int getId(int pos) const { return idPorPos[pos]; }
+    bool esCliente(int pos) const { return pos != posDeposito && idPorPos[pos] != depotId; }
+
+    int getCantPos() const;
+    int getPosDeposito() const;
+    int getCantClientes() const;
+    int getCapacidad() const;
+    int getDepotId() const;
+    int getNumVehiculos() const;
+    // false si algún par tiene distinta distancia en cada sentido (por
+    // ejemplo, una matriz EXPLICIT de red vial)
+    bool esSimetrica() const;
+    int getPos(int id) const;
+    const vector<int>& getPosClientes() const;
+    const vector<Cliente>& getClientes() const;
+    // Las matrices sólo existen con un proveedor denso (si no, logic_error)
+    const vector<vector<double>>& getDistMatrix() const;
+    const ProveedorDistancias& getDistancias() const;
+
+    // Distancias por ID que usan Ruta y Solucion
+    const vector<vector<double>>& getIdDistMatrix() const;
+    // Las mismas, para construir Ruta/Solucion sin copiarlas
+    const shared_ptr<const ProveedorDistancias>& getIdDistancias() const;
+
+    // Conversión entre rutas por posición (sin depósitos) y Solucion
+    Solucion aSolucion(const vector<vector<int>>& rutas) const;
+    vector<vector<int>> rutasDesde(const Solucion& sol) const;
+};
+
+#endif
@@ -0,0 +1,273 @@
+#include "IteratedLocalSearch.h"
+#include "HeuristicaInsercionCercana.h"
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+// Vecinos granulares de la búsqueda local
+static const int VECINOS_BUSQUEDA_LOCAL = 20;
+
+// Corte por defecto: iteraciones sin mejora por cliente
+static const int ITERACIONES_SIN_MEJORA_POR_CLIENTE = 10;
+
+// Intentos de ubicar un cliente al perturbar antes de darse por vencido
+static const int INTENTOS_PERTURBACION = 20;
+
+IteratedLocalSearch::IteratedLocalSearch(
+    const vector<Cliente>& clientes,
+    const vector<vector<double>>& distMatrix,
+    const unordered_map<int, int>& id2pos,
+    int capacidadVehiculo,
+    int depotId,
+    int numVehiculos,
+    uint64_t semilla)
+    : IteratedLocalSearch(make_shared<const InstanciaCompacta>(clientes, distMatrix, id2pos,
+                                                               capacidadVehiculo, depotId,
+                                                               numVehiculos),
+                          nullptr, semilla)
+{}
+
+IteratedLocalSearch::IteratedLocalSearch(
+    shared_ptr<const InstanciaCompacta> compartida,
+    shared_ptr<const ListaVecinos> vecinosCompartidos,
+    uint64_t semilla)
+    : clientes(compartida->getClientes()),
+      semilla(semilla),
+      instancia(move(compartida)),
+      listaVecinos(vecinosCompartidos ? move(vecinosCompartidos) : crearVecinos(*instancia)),
+      inst(*instancia),
+      vecinos(*listaVecinos),
+      perturbacion(Perturbacion::MultiRelocate),
+      fuerza(3),
+      aceptacion(Aceptacion::Mejor),
+      umbral(0.01),
+      maxIteraciones(0),
+      mejorCosto(numeric_limits<double>::max()),
+      iteracionesRealizadas(0)
+{}
+
+shared_ptr<const ListaVecinos> IteratedLocalSearch::crearVecinos(const InstanciaCompacta& inst) {
+    return make_shared<const ListaVecinos>(inst.getDistancias(), VECINOS_BUSQUEDA_LOCAL);
+}
+
+SolucionCompacta IteratedLocalSearch::construirInicial() const {
+    vector<vector<int>> rutas;
+    if (solucionInicial) {
+        rutas = inst.rutasDesde(*solucionInicial);
+    } else {
+        HeuristicaInsercionCercana ni(clientes, inst.getIdDistancias(), inst.getCapacidad(),
+                                      inst.getDepotId(), inst.getNumVehiculos());
+        rutas = inst.rutasDesde(ni.resolver());
+    }
+    SolucionCompacta sol(inst, rutas);
+    sol.eliminarRutasVacias();
+    sol.completar();
+    return sol;
+}
+
+void IteratedLocalSearch::perturbar(SolucionCompacta& sol, GeneradorAleatorio& rng,
+                                    vector<int>& tocadas) const {
+    tocadas.clear();
+    if (perturbacion == Perturbacion::MultiRelocate)
+        multiRelocate(sol, rng, tocadas);
+    else
+        dobleBridge(sol, rng, tocadas);
+    sort(tocadas.begin(), tocadas.end());
+    tocadas.erase(unique(tocadas.begin(), tocadas.end()), tocadas.end());
+}
+
+void IteratedLocalSearch::multiRelocate(SolucionCompacta& sol, GeneradorAleatorio& rng,
+                                        vector<int>& tocadas) const {
+    const vector<int>& posClientes = inst.getPosClientes();
+    int n = static_cast<int>(posClientes.size());
+    int cantRutas = sol.getCantRutas();
+    if (n == 0 || cantRutas < 2)
+        return;
+
+    for (int m = 0; m < fuerza; ++m) {
+        int c = posClientes[rng.enteroEn(n)];
+        int r1 = sol.getRutaDe(c);
+        for (int intento = 0; intento < INTENTOS_PERTURBACION; ++intento) {
+            int r2 = rng.enteroEn(cantRutas);
+            if (r2 == r1 || sol.getCarga(r2) + inst.getDemanda(c) > inst.getCapacidad())
+                continue;
+            int j = rng.enteroEn(static_cast<int>(sol.getRuta(r2).size()) + 1);
+            sol.mover(r1, sol.getIndiceEn(c), r2, j);
+            tocadas.push_back(r1);
+            tocadas.push_back(r2);
+            break;
+        }
+    }
+}
+
+void IteratedLocalSearch::dobleBridge(SolucionCompacta& sol, GeneradorAleatorio& rng,
+                                      vector<int>& tocadas) const {
+    vector<int> noVacias;
+    for (int r = 0; r < sol.getCantRutas(); ++r) {
+        if (!sol.getRuta(r).empty()) noVacias.push_back(r);
+    }
+    if (noVacias.empty())
+        return;
+
+    // Tramo al azar de largo 1..fuerza
+    auto tramo = [&](int r, int& desde, int& hasta) {
+        int largo = static_cast<int>(sol.getRuta(r).size());
+        int l = 1 + rng.enteroEn(min(fuerza, largo));
+        desde = rng.enteroEn(largo - l + 1);
+        hasta = desde + l;
+    };
+    auto carga = [&](const vector<int>& ruta, int desde, int hasta) {
+        int total = 0;
+        for (int i = desde; i < hasta; ++i) total += inst.getDemanda(ruta[i]);
+        return total;
+    };
+
+    // Entre dos rutas: intercambiar un tramo de cada una (cuatro cortes)
+    for (int intento = 0; intento < INTENTOS_PERTURBACION && noVacias.size() >= 2; ++intento) {
+        int r1 = noVacias[rng.enteroEn(static_cast<int>(noVacias.size()))];
+        int r2 = noVacias[rng.enteroEn(static_cast<int>(noVacias.size()))];
+        if (r1 == r2)
+            continue;
+        int a1, b1, a2, b2;
+        tramo(r1, a1, b1);
+        tramo(r2, a2, b2);
+        const vector<int>& ruta1 = sol.getRuta(r1);
+        const vector<int>& ruta2 = sol.getRuta(r2);
+        int diferencia = carga(ruta2, a2, b2) - carga(ruta1, a1, b1);
+        if (sol.getCarga(r1) + diferencia > inst.getCapacidad() ||
+            sol.getCarga(r2) - diferencia > inst.getCapacidad())
+            continue;
+
+        vector<int> nueva1(ruta1.begin(), ruta1.begin() + a1);
+        nueva1.insert(nueva1.end(), ruta2.begin() + a2, ruta2.begin() + b2);
+        nueva1.insert(nueva1.end(), ruta1.begin() + b1, ruta1.end());
+        vector<int> nueva2(ruta2.begin(), ruta2.begin() + a2);
+        nueva2.insert(nueva2.end(), ruta1.begin() + a1, ruta1.begin() + b1);
+        nueva2.insert(nueva2.end(), ruta2.begin() + b2, ruta2.end());
+        sol.reemplazarRuta(r1, nueva1);
+        sol.reemplazarRuta(r2, nueva2);
+        tocadas.push_back(r1);
+        tocadas.push_back(r2);
+        return;
+    }
+
+    // Una sola ruta (o ningún intercambio factible): double-bridge clásico
+    // A B C D -> A C B D
+    int r = noVacias[rng.enteroEn(static_cast<int>(noVacias.size()))];
+    const vector<int>& ruta = sol.getRuta(r);
+    int largo = static_cast<int>(ruta.size());
+    if (largo < 4)
+        return;
+    int cortes[3];
+    for (int k = 0; k < 3; ++k) {
+        cortes[k] = 1 + rng.enteroEn(largo - 1);
+    }
+    sort(cortes, cortes + 3);
+    vector<int> nueva(ruta.begin(), ruta.begin() + cortes[0]);
+    nueva.insert(nueva.end(), ruta.begin() + cortes[1], ruta.begin() + cortes[2]);
+    nueva.insert(nueva.end(), ruta.begin() + cortes[0], ruta.begin() + cortes[1]);
+    nueva.insert(nueva.end(), ruta.begin() + cortes[2], ruta.end());
+    sol.reemplazarRuta(r, nueva);
+    tocadas.push_back(r);
+}
+
+bool IteratedLocalSearch::acepta(double candidato, double actual) const {
+    switch (aceptacion) {
+        case Aceptacion::Mejor:
+            return candidato <= actual + 1e-9;
+        case Aceptacion::Umbral:
+            return candidato <= mejorCosto * (1 + umbral);
+        case Aceptacion::Siempre:
+            return true;
+    }
+    return false;
+}
+
+Solucion IteratedLocalSearch::resolver() {
+    control.reiniciar();
+    iteracionesRealizadas = 0;
+
+    GeneradorAleatorio rng(semilla);
+    BusquedaLocalCompacta busqueda(inst, vecinos);
+    SolucionCompacta actual = construirInicial();
+    busqueda.mejorar(actual);
+    SolucionCompacta mejor = actual;
+    mejorCosto = mejor.getCosto();
+    if (control.objetivoAlcanzado(mejorCosto))
+        control.detener();
+
+    long sinMejoraPorDefecto = 0;
+    if (!control.getCriterio().tieneLimite() && maxIteraciones <= 0)
+        sinMejoraPorDefecto = static_cast<long>(ITERACIONES_SIN_MEJORA_POR_CLIENTE) *
+                              max(1, inst.getCantClientes());
+
+    vector<int> tocadas;
+    long sinMejora = 0;
+    while (!control.debeDetenerse()) {
+        if (maxIteraciones > 0 && iteracionesRealizadas >= maxIteraciones)
+            break;
+        if (sinMejoraPorDefecto > 0 && sinMejora >= sinMejoraPorDefecto)
+            break;
+
+        SolucionCompacta candidata = actual;
+        perturbar(candidata, rng, tocadas);
+        busqueda.mejorar(candidata, tocadas);
+        iteracionesRealizadas++;
+
+        if (candidata.getCosto() < mejorCosto - 1e-9) {
+            candidata.recalcular();
+            mejor = candidata;
+            mejorCosto = mejor.getCosto();
+            sinMejora = 0;
+            if (alMejorar)
+                alMejorar(mejor.aSolucion(), control.segundos());
+            if (control.objetivoAlcanzado(mejorCosto))
+                control.detener();
+        } else {
+            sinMejora++;
+            if (control.sinMejoraAgotado(sinMejora))
+                control.detener();
+        }
+        if (acepta(candidata.getCosto(), actual.getCosto()))
+            actual = move(candidata);
+    }
+
+    return mejor.aSolucion();
+}
+
+void IteratedLocalSearch::setSolucionInicial(const Solucion& sol) {
+    solucionInicial.reset(new Solucion(sol));
+}
+
+void IteratedLocalSearch::setSemilla(uint64_t nuevaSemilla) { semilla = nuevaSemilla; }
+
+void IteratedLocalSearch::setPerturbacion(Perturbacion tipo, int nuevaFuerza) {
+    perturbacion = tipo;
+    fuerza = nuevaFuerza > 0 ? nuevaFuerza : 3;
+}
+
+void IteratedLocalSearch::setAceptacion(Aceptacion tipo, double nuevoUmbral) {
+    aceptacion = tipo;
+    umbral = nuevoUmbral;
+}
+
+void IteratedLocalSearch::setMaxIteraciones(long iteraciones) { maxIteraciones = iteraciones; }
+
+void IteratedLocalSearch::setCriterioParada(const CriterioParada& criterio) {
+    control.setCriterio(criterio);
+}
+
+void IteratedLocalSearch::setAlMejorar(function<void(const Solucion&, double)> callback) {
+    alMejorar = move(callback);
+}
+
+void IteratedLocalSearch::detener() { control.detener(); }
+
+void IteratedLocalSearch::setControlExterno(const ControlParada* externo) { control.setExterno(externo); }
+
+double IteratedLocalSearch::getMejorCosto() const { return mejorCosto; }
+
+long IteratedLocalSearch::getIteracionesRealizadas() const { return iteracionesRealizadas; }
+
+uint64_t IteratedLocalSearch::getSemilla() const { return semilla; }
@@ -0,0 +1,106 @@
+#ifndef ITERATED_LOCAL_SEARCH_H
+#define ITERATED_LOCAL_SEARCH_H
+
+#include "Cliente.h"
+#include "Solucion.h"
+#include "InstanciaCompacta.h"
+#include "SolucionCompacta.h"
+#include "ListaVecinos.h"
+#include "BusquedaLocalCompacta.h"
+#include "GeneradorAleatorio.h"
+#include "CriterioParada.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// Búsqueda local iterada: se perturba el óptimo local actual, se vuelve a
+// optimizar sólo a partir de las rutas que tocó la perturbación y se decide
+// si el nuevo óptimo reemplaza al actual. Nunca se reconstruye desde cero.
+class IteratedLocalSearch {
+public:
+    enum class Perturbacion {
+        MultiRelocate,  // varios clientes a posiciones al azar de otras rutas
+        DobleBridge     // intercambio de tramos entre dos rutas (o double-bridge en una)
+    };
+
+    enum class Aceptacion {
+        Mejor,    // si no empeora al actual
+        Umbral,   // si no supera a la mejor en más de `umbral` (relativo)
+        Siempre   // camino al azar; la mejor se guarda aparte
+    };
+
+private:
+    const vector<Cliente>& clientes;
+    uint64_t semilla;
+
+    // Propias o compartidas con otros solvers (sólo se leen)
+    shared_ptr<const InstanciaCompacta> instancia;
+    shared_ptr<const ListaVecinos> listaVecinos;
+    const InstanciaCompacta& inst;
+    const ListaVecinos& vecinos;
+    unique_ptr<Solucion> solucionInicial;
+
+    Perturbacion perturbacion;
+    int fuerza;  // clientes movidos o largo máximo de tramo
+    Aceptacion aceptacion;
+    double umbral;
+    long maxIteraciones;
+
+    ControlParada control;
+    function<void(const Solucion&, double)> alMejorar;
+
+    double mejorCosto;
+    long iteracionesRealizadas;
+
+    SolucionCompacta construirInicial() const;
+    void perturbar(SolucionCompacta& sol, GeneradorAleatorio& rng, vector<int>& tocadas) const;
+    void multiRelocate(SolucionCompacta& sol, GeneradorAleatorio& rng, vector<int>& tocadas) const;
+    void dobleBridge(SolucionCompacta& sol, GeneradorAleatorio& rng, vector<int>& tocadas) const;
+    bool acepta(double candidato, double actual) const;
+
+public:
+    IteratedLocalSearch(const vector<Cliente>& clientes,
+                        const vector<vector<double>>& distMatrix,
+                        const unordered_map<int, int>& id2pos,
+                        int capacidadVehiculo,
+                        int depotId,
+                        int numVehiculos,
+                        uint64_t semilla = 0);
+    // Sobre una instancia ya armada, con cualquier proveedor de distancias,
+    // que puede compartirse entre varios solvers; vecinos == nullptr arma
+    // las listas de crearVecinos
+    IteratedLocalSearch(shared_ptr<const InstanciaCompacta> instancia,
+                        shared_ptr<const ListaVecinos> vecinos,
+                        uint64_t semilla = 0);
+    // Las listas de vecinos de su búsqueda local
+    static shared_ptr<const ListaVecinos> crearVecinos(const InstanciaCompacta& inst);
+
+    // Sin criterio de parada ni límite de iteraciones corta tras 10
+    // iteraciones por cliente sin mejorar la mejor solución
+    Solucion resolver();
+
+    // Por defecto se parte de Inserción Más Cercana
+    void setSolucionInicial(const Solucion& sol);
+    // Cambia la semilla de las próximas corridas
+    void setSemilla(uint64_t nuevaSemilla);
+    // fuerza <= 0 usa 3
+    void setPerturbacion(Perturbacion tipo, int fuerza = 0);
+    void setAceptacion(Aceptacion tipo, double umbral = 0.01);
+    void setMaxIteraciones(long iteraciones);
+    void setCriterioParada(const CriterioParada& criterio);
+    void setAlMejorar(function<void(const Solucion&, double)> callback);
+    void detener();
+    // Control de quien contiene a esta corrida: su detención la corta aunque
+    // llegue antes de resolver(), que no la limpia
+    void setControlExterno(const ControlParada* externo);
+
+    double getMejorCosto() const;
+    long getIteracionesRealizadas() const;
+    uint64_t getSemilla() const;
+};
+
+#endif
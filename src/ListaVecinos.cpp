@@ -0,0 +1,79 @@
+#include "ListaVecinos.h"
+#include "RejillaEspacial.h"
+#include <algorithm>
+
+using namespace std;
+
+ListaVecinos::ListaVecinos(const vector<vector<double>>& distMatrix, int cantidad, int maxVecinos)
+    : cantidad(cantidad),
+      vecinosPorNodo(0)
+{
+    if (cantidad <= 1) return;
+
+    vecinosPorNodo = (maxVecinos < 0 || maxVecinos > cantidad - 1) ? cantidad - 1 : maxVecinos;
+    vecinos.resize(static_cast<size_t>(cantidad) * vecinosPorNodo);
+
+    vector<int> orden;
+    orden.reserve(cantidad - 1);
+    for (int i = 0; i < cantidad; ++i)
+        ordenarFila(i, distMatrix[i].data(), orden);
+}
+
+ListaVecinos::ListaVecinos(const ProveedorDistancias& distancias, int maxVecinos)
+    : cantidad(distancias.getCantidad()),
+      vecinosPorNodo(0)
+{
+    if (distancias.esDensa()) {
+        *this = ListaVecinos(distancias.getMatriz(), cantidad, maxVecinos);
+        return;
+    }
+    if (cantidad <= 1) return;
+
+    vecinosPorNodo = (maxVecinos < 0 || maxVecinos > cantidad - 1) ? cantidad - 1 : maxVecinos;
+    vecinos.resize(static_cast<size_t>(cantidad) * vecinosPorNodo);
+    if (!distancias.tieneCoordenadas()) {
+        vector<double> fila(cantidad);
+        vector<int> orden;
+        orden.reserve(cantidad - 1);
+        for (int i = 0; i < cantidad; ++i) {
+            distancias.fila(i, fila.data());
+            ordenarFila(i, fila.data(), orden);
+        }
+        return;
+    }
+    RejillaEspacial rejilla(distancias);
+    vector<int> cercanos;
+    for (int i = 0; i < cantidad; ++i) {
+        rejilla.kCercanos(i, vecinosPorNodo, cercanos);
+        copy(cercanos.begin(), cercanos.end(), vecinos.begin() + static_cast<size_t>(i) * vecinosPorNodo);
+    }
+}
+
+void ListaVecinos::ordenarFila(int i, const double* fila, vector<int>& orden) {
+    orden.clear();
+    for (int j = 0; j < cantidad; ++j) {
+        if (j != i) orden.push_back(j);
+    }
+
+    // Desempate por posición para que el orden sea determinístico
+    auto menor = [fila](int a, int b) {
+        return fila[a] < fila[b] || (fila[a] == fila[b] && a < b);
+    };
+    if (vecinosPorNodo < static_cast<int>(orden.size())) {
+        partial_sort(orden.begin(), orden.begin() + vecinosPorNodo, orden.end(), menor);
+    } else {
+        sort(orden.begin(), orden.end(), menor);
+    }
+    copy(orden.begin(), orden.begin() + vecinosPorNodo,
+         vecinos.begin() + static_cast<size_t>(i) * vecinosPorNodo);
+}
+
+const int* ListaVecinos::getVecinos(int pos) const {
+    return vecinos.data() + static_cast<size_t>(pos) * vecinosPorNodo;
+}
+
+int ListaVecinos::getCantidadVecinos() const { return vecinosPorNodo; }
+
+int ListaVecinos::getCantidad() const { return cantidad; }
+
+bool ListaVecinos::esCompleta() const { return vecinosPorNodo >= cantidad - 1; }
@@ -0,0 +1,36 @@
+#ifndef LISTA_VECINOS_H
+#define LISTA_VECINOS_H
+
+#include "ProveedorDistancias.h"
+#include <vector>
+
+using namespace std;
+
+// Listas de vecinos ordenadas por distancia, calculadas una sola vez por
+// instancia. Los índices son posiciones en la matriz de distancias
+// (0..cantidad-1); cada lista excluye al propio nodo.
+class ListaVecinos {
+private:
+    int cantidad;
+    int vecinosPorNodo;
+    vector<int> vecinos;  // cantidad * vecinosPorNodo, fila por nodo
+
+    // Ordena los vecinos de i según fila (distancias desde i) y guarda los
+    // vecinosPorNodo primeros; orden es espacio de trabajo
+    void ordenarFila(int i, const double* fila, vector<int>& orden);
+
+public:
+    // maxVecinos < 0 (o mayor a cantidad-1) guarda las listas completas
+    ListaVecinos(const vector<vector<double>>& distMatrix, int cantidad, int maxVecinos = -1);
+    // Igual sobre un proveedor; con coordenadas usa una RejillaEspacial,
+    // O(n k) en lugar de O(n^2), y da las mismas listas. Los formatos
+    // compactos se recorren fila por fila, sin armar la matriz.
+    explicit ListaVecinos(const ProveedorDistancias& distancias, int maxVecinos = -1);
+
+    const int* getVecinos(int pos) const;
+    int getCantidadVecinos() const;
+    int getCantidad() const;
+    bool esCompleta() const;
+};
+
+#endif
@@ -0,0 +1,40 @@
+#include "MappedFile.h"
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string& filePath, bool sequential) {
+    int fd = open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Error: Could not open file " + filePath);
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        throw std::runtime_error("Error: Could not stat file " + filePath);
+    }
+    length = static_cast<std::size_t>(info.st_size);
+    // An empty file cannot be mapped; it is simply an empty view
+    if (length > 0) {
+        void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            close(fd);
+            throw std::runtime_error("Error: Could not map file " + filePath);
+        }
+        // The parser reads the file once, front to back
+        if (sequential) {
+            madvise(mapped, length, MADV_SEQUENTIAL);
+        }
+        begin = static_cast<const char*>(mapped);
+    }
+    // The mapping stays valid after closing the descriptor
+    close(fd);
+}
+
+MappedFile::~MappedFile() {
+    if (begin) {
+        munmap(const_cast<char*>(begin), length);
+    }
+}
@@ -0,0 +1,28 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+// Read-only view of a whole file. The file is memory-mapped, so the parser
+// walks the page cache directly instead of copying it through a stream.
+class MappedFile {
+public:
+    // Throws std::runtime_error if the file cannot be opened or mapped.
+    // With sequential, the kernel is told the file is read once, front to
+    // back; otherwise it keeps its default readahead (random lookups).
+    explicit MappedFile(const std::string& filePath, bool sequential = true);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return begin; }
+    std::size_t size() const { return length; }
+
+private:
+    const char* begin {nullptr};
+    std::size_t length {0};
+};
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,252 @@
+#include "ModeloIslas.h"
+#include "GeneradorAleatorio.h"
+#include "PoolHilos.h"
+#include <algorithm>
+#include <exception>
+#include <limits>
+#include <thread>
+
+using namespace std;
+
+// Segundos entre intercambios por defecto
+static const double PERIODO_MIGRACION_POR_DEFECTO = 1.0;
+
+// Períodos sin mejora global tras los que se corta si no hay otro criterio
+static const int PERIODOS_SIN_MEJORA_POR_DEFECTO = 5;
+
+// GRASP de cada isla: tamaño de la RCL y pool elite para el path
+// relinking, que es por donde entran las soluciones de las vecinas
+static const int K_RCL_ISLA = 3;
+static const int POOL_ELITE_ISLA = 10;
+
+ModeloIslas::ModeloIslas(
+    const vector<Cliente>& clientes,
+    const vector<vector<double>>& distMatrix,
+    const unordered_map<int, int>& id2pos,
+    int capacidadVehiculo,
+    int depotId,
+    int numVehiculos,
+    uint64_t semilla)
+    : ModeloIslas(make_shared<const InstanciaCompacta>(clientes, distMatrix, id2pos,
+                                                       capacidadVehiculo, depotId, numVehiculos),
+                  semilla)
+{}
+
+ModeloIslas::ModeloIslas(shared_ptr<const InstanciaCompacta> instancia, uint64_t semilla)
+    : semilla(semilla),
+      inst(move(instancia)),
+      numIslas(0),
+      algoritmos({Algoritmo::GRASP, Algoritmo::ILS, Algoritmo::SA}),
+      periodoMigracion(PERIODO_MIGRACION_POR_DEFECTO),
+      mejorCosto(numeric_limits<double>::max()),
+      migraciones(0),
+      periodos(0)
+{}
+
+void ModeloIslas::crearSolver(Isla& isla) {
+    // El control del modelo es el externo de cada solver: un detener()
+    // llega aunque el solver esté entre dos períodos
+    auto callback = [this](const Solucion& sol, double) { registrarMejora(sol); };
+    if (isla.algoritmo == Algoritmo::GRASP) {
+        isla.grasp.reset(new GRASP(inst, vecinosGRASP, 0, K_RCL_ISLA, isla.semilla));
+        isla.grasp->setNumHilos(1);
+        isla.grasp->setPathRelinking(POOL_ELITE_ISLA);
+        isla.grasp->setAlMejorar(callback);
+        isla.grasp->setControlExterno(&control);
+    } else if (isla.algoritmo == Algoritmo::ILS) {
+        isla.ils.reset(new IteratedLocalSearch(inst, vecinosILS, isla.semilla));
+        isla.ils->setAlMejorar(callback);
+        isla.ils->setControlExterno(&control);
+    } else {
+        isla.sa.reset(new SimulatedAnnealing(inst, isla.semilla));
+        isla.sa->setAlMejorar(callback);
+        isla.sa->setControlExterno(&control);
+    }
+}
+
+Solucion ModeloIslas::correrPeriodo(Isla& isla, const Solucion* inicial,
+                                    const CriterioParada& criterio) {
+    if (isla.grasp) {
+        if (inicial) isla.grasp->setSolucionInicial(*inicial);
+        isla.grasp->setSemilla(isla.semilla);
+        isla.grasp->setCriterioParada(criterio);
+        return isla.grasp->resolver();
+    }
+    if (isla.ils) {
+        if (inicial) isla.ils->setSolucionInicial(*inicial);
+        isla.ils->setSemilla(isla.semilla);
+        isla.ils->setCriterioParada(criterio);
+        return isla.ils->resolver();
+    }
+    if (inicial) isla.sa->setSolucionInicial(*inicial);
+    isla.sa->setSemilla(isla.semilla);
+    isla.sa->setCriterioParada(criterio);
+    return isla.sa->resolver();
+}
+
+void ModeloIslas::correrIsla(int indice) {
+    Isla& isla = *islas[indice];
+    Buzon& propio = *buzones[indice];
+    int cantidad = static_cast<int>(islas.size());
+    Buzon& vecino = *buzones[(indice + cantidad - 1) % cantidad];
+    crearSolver(isla);
+
+    const CriterioParada& global = control.getCriterio();
+    int limiteSinMejora = global.tieneLimite() ? global.iteracionesSinMejora
+                                               : PERIODOS_SIN_MEJORA_POR_DEFECTO;
+    uint64_t semillaIsla = isla.semilla;
+    unique_ptr<Solucion> actual;
+    double costoActual = numeric_limits<double>::max();
+
+    for (uint64_t periodo = 0; !control.debeDetenerse(); ++periodo) {
+        CriterioParada criterio;
+        criterio.limiteTiempo = periodoMigracion;
+        if (global.limiteTiempo > 0)
+            criterio.limiteTiempo = min(periodoMigracion, global.limiteTiempo - control.segundos());
+        if (criterio.limiteTiempo <= 0)
+            break;
+        criterio.costoObjetivo = global.costoObjetivo;
+        criterio.brechaObjetivo = global.brechaObjetivo;
+        criterio.cotaInferior = global.cotaInferior;
+
+        // Cada período sigue otra secuencia aleatoria, aunque arranque de
+        // la misma solución
+        isla.semilla = GeneradorAleatorio::derivarSemilla(semillaIsla, periodo);
+        double mejorAntes = mejorCosto.load();
+        Solucion sol = correrPeriodo(isla, actual.get(), criterio);
+        periodos++;
+
+        if (sol.esFactible() && sol.vistoTodos() && sol.getCostoTotal() < costoActual) {
+            costoActual = sol.getCostoTotal();
+            actual.reset(new Solucion(move(sol)));
+            registrarMejora(*actual);
+            lock_guard<mutex> lk(propio.mtx);
+            propio.solucion.reset(new Solucion(*actual));
+            propio.costo = costoActual;
+        }
+        {
+            lock_guard<mutex> lk(vecino.mtx);
+            if (vecino.solucion && vecino.costo < costoActual) {
+                actual.reset(new Solucion(*vecino.solucion));
+                costoActual = vecino.costo;
+                migraciones++;
+            }
+        }
+
+        // Una isla estancada sigue mientras otra mejore la global
+        if (mejorCosto.load() < mejorAntes) {
+            isla.sinMejora.store(0);
+        } else if (limiteSinMejora > 0) {
+            isla.sinMejora.fetch_add(1);
+            if (todasEstancadas(limiteSinMejora))
+                detener();
+        }
+    }
+}
+
+bool ModeloIslas::todasEstancadas(int limite) const {
+    for (const unique_ptr<Isla>& isla : islas) {
+        if (isla->sinMejora.load() < limite)
+            return false;
+    }
+    return true;
+}
+
+void ModeloIslas::registrarMejora(const Solucion& sol) {
+    if (!sol.esFactible())
+        return;
+    double costo = sol.getCostoTotal();
+    if (costo >= mejorCosto.load(memory_order_relaxed))
+        return;
+
+    lock_guard<mutex> lk(mtxMejor);
+    if (costo >= mejorCosto.load(memory_order_relaxed))
+        return;
+    mejorSol.reset(new Solucion(sol));
+    mejorCosto.store(costo);
+    if (alMejorar)
+        alMejorar(*mejorSol, control.segundos());
+    if (control.objetivoAlcanzado(costo))
+        detener();
+}
+
+Solucion ModeloIslas::resolver() {
+    control.reiniciar();
+    mejorCosto.store(numeric_limits<double>::max());
+    mejorSol.reset();
+    migraciones.store(0);
+    periodos.store(0);
+
+    int cantidad = numIslas > 0 ? numIslas : PoolHilos::hilosDisponibles();
+    islas.clear();
+    buzones.clear();
+    for (int i = 0; i < cantidad; ++i) {
+        islas.emplace_back(new Isla());
+        islas[i]->algoritmo = algoritmos[i % algoritmos.size()];
+        islas[i]->semilla = GeneradorAleatorio::derivarSemilla(semilla, i);
+        islas[i]->sinMejora.store(0);
+        buzones.emplace_back(new Buzon());
+        buzones[i]->costo = numeric_limits<double>::max();
+        if (islas[i]->algoritmo == Algoritmo::GRASP && !vecinosGRASP)
+            vecinosGRASP = GRASP::crearVecinos(*inst, K_RCL_ISLA);
+        if (islas[i]->algoritmo == Algoritmo::ILS && !vecinosILS)
+            vecinosILS = IteratedLocalSearch::crearVecinos(*inst);
+    }
+
+    vector<exception_ptr> errores(cantidad);
+    vector<thread> hilos;
+    for (int i = 0; i < cantidad; ++i) {
+        hilos.emplace_back([this, i, &errores]() {
+            try {
+                correrIsla(i);
+            } catch (...) {
+                errores[i] = current_exception();
+                detener();
+            }
+        });
+    }
+    for (thread& h : hilos)
+        h.join();
+
+    for (const exception_ptr& e : errores) {
+        if (e)
+            rethrow_exception(e);
+    }
+    lock_guard<mutex> lk(mtxMejor);
+    if (!mejorSol)
+        return Solucion(inst->getClientes(), inst->getIdDistancias(), inst->getNumVehiculos());
+    return *mejorSol;
+}
+
+void ModeloIslas::setIslas(int cantidad) { numIslas = cantidad; }
+
+void ModeloIslas::setAlgoritmos(const vector<Algoritmo>& lista) {
+    if (!lista.empty())
+        algoritmos = lista;
+}
+
+void ModeloIslas::setPeriodoMigracion(double segundos) {
+    periodoMigracion = segundos > 0 ? segundos : PERIODO_MIGRACION_POR_DEFECTO;
+}
+
+void ModeloIslas::setCriterioParada(const CriterioParada& criterio) {
+    control.setCriterio(criterio);
+}
+
+void ModeloIslas::setAlMejorar(function<void(const Solucion&, double)> callback) {
+    alMejorar = move(callback);
+}
+
+void ModeloIslas::detener() { control.detener(); }
+
+double ModeloIslas::getMejorCosto() const { return mejorCosto.load(); }
+
+long ModeloIslas::getMigraciones() const { return migraciones.load(); }
+
+long ModeloIslas::getPeriodos() const { return periodos.load(); }
+
+int ModeloIslas::getCantidadIslas() const {
+    return numIslas > 0 ? numIslas : PoolHilos::hilosDisponibles();
+}
+
+uint64_t ModeloIslas::getSemilla() const { return semilla; }
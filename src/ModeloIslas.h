@@ -0,0 +1,122 @@
+#ifndef MODELO_ISLAS_H
+#define MODELO_ISLAS_H
+
+#include "Cliente.h"
+#include "Solucion.h"
+#include "GRASP.h"
+#include "IteratedLocalSearch.h"
+#include "SimulatedAnnealing.h"
+#include "CriterioParada.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// Modelo de islas: varias metaheurísticas independientes (GRASP, ILS o
+// recocido), cada una en su hilo con su propio generador, memoria de
+// trabajo y estado. La instancia y las listas de vecinos se arman una sola
+// vez y todas las islas las leen. La corrida de cada isla se parte en períodos; al final
+// de cada uno la isla deja su mejor solución en su buzón y mira el de la
+// isla anterior del anillo: si la de su vecina es mejor, el próximo período
+// arranca desde ella. Los buzones están protegidos por un mutex cada uno,
+// así que las islas nunca se esperan entre sí. El resultado depende del
+// reparto de tiempo entre hilos, así que no es reproducible por semilla.
+class ModeloIslas {
+public:
+    enum class Algoritmo { GRASP, ILS, SA };
+
+private:
+    struct Isla {
+        Algoritmo algoritmo;
+        uint64_t semilla;
+        // Períodos seguidos de esta isla sin que mejore la mejor global
+        atomic<int> sinMejora;
+        unique_ptr<GRASP> grasp;
+        unique_ptr<IteratedLocalSearch> ils;
+        unique_ptr<SimulatedAnnealing> sa;
+    };
+
+    // Última solución publicada por una isla
+    struct Buzon {
+        mutex mtx;
+        unique_ptr<Solucion> solucion;
+        double costo;
+    };
+
+    uint64_t semilla;
+
+    // Compartidas por todas las islas; las listas se arman en el primer
+    // resolver() que tenga una isla del algoritmo que las usa
+    shared_ptr<const InstanciaCompacta> inst;
+    shared_ptr<const ListaVecinos> vecinosGRASP;
+    shared_ptr<const ListaVecinos> vecinosILS;
+
+    int numIslas;
+    vector<Algoritmo> algoritmos;
+    double periodoMigracion;
+
+    ControlParada control;
+    function<void(const Solucion&, double)> alMejorar;
+
+    vector<unique_ptr<Isla>> islas;
+    vector<unique_ptr<Buzon>> buzones;
+
+    // Mejor solución global (sólo las que respetan la flota)
+    mutex mtxMejor;
+    atomic<double> mejorCosto;
+    unique_ptr<Solucion> mejorSol;
+
+    atomic<long> migraciones;
+    atomic<long> periodos;
+
+    void crearSolver(Isla& isla);
+    Solucion correrPeriodo(Isla& isla, const Solucion* inicial, const CriterioParada& criterio);
+    void correrIsla(int indice);
+    bool todasEstancadas(int limite) const;
+    void registrarMejora(const Solucion& sol);
+
+public:
+    ModeloIslas(const vector<Cliente>& clientes,
+                const vector<vector<double>>& distMatrix,
+                const unordered_map<int, int>& id2pos,
+                int capacidadVehiculo,
+                int depotId,
+                int numVehiculos,
+                uint64_t semilla = 0);
+    // Sobre una instancia ya armada, con cualquier proveedor de distancias
+    ModeloIslas(shared_ptr<const InstanciaCompacta> instancia, uint64_t semilla = 0);
+
+    // Corta por tiempo o costo objetivo (revisados también dentro de cada
+    // período) o cuando todas las islas llevan `iteracionesSinMejora`
+    // períodos seguidos sin que mejore la mejor global. Sin criterio se
+    // usan 5 períodos sin mejora.
+    Solucion resolver();
+
+    // Cantidad de islas (<= 0: una por núcleo)
+    void setIslas(int cantidad);
+    // Algoritmo de cada isla, repartidos en ronda (por defecto GRASP, ILS
+    // y recocido alternados)
+    void setAlgoritmos(const vector<Algoritmo>& lista);
+    // Segundos entre intercambios
+    void setPeriodoMigracion(double segundos);
+    void setCriterioParada(const CriterioParada& criterio);
+    // Se invoca (serializado) cada vez que mejora la mejor global
+    void setAlMejorar(function<void(const Solucion&, double)> callback);
+    // Pide cortar la corrida en curso; puede llamarse desde otro hilo
+    void detener();
+
+    double getMejorCosto() const;
+    // Veces que una isla adoptó la solución de su vecina
+    long getMigraciones() const;
+    // Períodos completados entre todas las islas
+    long getPeriodos() const;
+    int getCantidadIslas() const;
+    uint64_t getSemilla() const;
+};
+
+#endif
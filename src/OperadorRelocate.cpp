@@ -2,7 +2,9 @@
 #include "Solucion.h"
 
 OperadorRelocate::OperadorRelocate(const Solucion &solucion)
-    : solucion(solucion) {}
+    : solucion(solucion), control(nullptr) {}
+
+void OperadorRelocate::setControlParada(const ControlParada *nuevo) { control = nuevo; }
 
 Solucion OperadorRelocate::aplicar() {
   Solucion mejorSolucion = solucion;
@@ -10,6 +12,8 @@ Solucion OperadorRelocate::aplicar() {
 
   for (size_t i = 0; i < solucion.getRutas().size(); i++) {
     for (size_t j = i + 1; j < solucion.getRutas().size(); j++) {
+      if (control && control->debeDetenerse())
+        return mejorSolucion;
       Solucion nuevaSolucion = mejorRelocateEntreRutas(i, j);
       if (nuevaSolucion.getCostoTotal() < mejorCosto) {
         mejorSolucion = nuevaSolucion;
@@ -22,7 +26,15 @@ Solucion OperadorRelocate::aplicar() {
 
 // VER QUE NO SE PISEN LAS RUTAS
 Solucion OperadorRelocate::mejorRelocateEntreRutas(size_t i, size_t j) {
-  const vector<vector<double>> &distMatrix = solucion.getDistMatrix();
+  // El bucle se compila una vez por formato de distancias, sin decidir el
+  // formato en cada consulta
+  return solucion.getDistancias()->conAlmacen(
+      [&](const auto &dist) { return mejorRelocateEntreRutas(i, j, dist); });
+}
+
+template <typename Distancias>
+Solucion OperadorRelocate::mejorRelocateEntreRutas(size_t i, size_t j, const Distancias &dist) {
+  const shared_ptr<const ProveedorDistancias> &distancias = solucion.getDistancias();
   Ruta ruta_j = solucion.getRutas()[j];
   Ruta ruta_i = solucion.getRutas()[i];
   int costo_i = ruta_i.getCosto();
@@ -36,6 +48,8 @@ Solucion OperadorRelocate::mejorRelocateEntreRutas(size_t i, size_t j) {
   int mejorCosto = costo_i + costo_j;
 
   for (size_t pos_i = 1; pos_i < static_cast<size_t>(size_i - 1); pos_i++) {
+    if (control && control->debeDetenerse())
+      break;
     vector<int> clientes_i = ruta_i.getClientes();
     vector<int> clientes_j = ruta_j.getClientes();
 
@@ -56,14 +70,14 @@ Solucion OperadorRelocate::mejorRelocateEntreRutas(size_t i, size_t j) {
       // Calcular nuevos costos (simplificado - podrías querer recalcular
       // apropiadamente)
       int nuevoCosto_i =
-          costo_i - distMatrix[clientes_i[pos_i - 1]][clientes_i[pos_i]] -
-          distMatrix[clientes_i[pos_i]][clientes_i[pos_i + 1]] +
-          distMatrix[clientes_i[pos_i - 1]][clientes_i[pos_i + 1]];
+          costo_i - dist(clientes_i[pos_i - 1], clientes_i[pos_i]) -
+          dist(clientes_i[pos_i], clientes_i[pos_i + 1]) +
+          dist(clientes_i[pos_i - 1], clientes_i[pos_i + 1]);
 
       int nuevoCosto_j = costo_j -
-                         distMatrix[clientes_j[pos_j - 1]][clientes_j[pos_j]] +
-                         distMatrix[clientes_j[pos_j - 1]][cliente_a_mover] +
-                         distMatrix[cliente_a_mover][clientes_j[pos_j]];
+                         dist(clientes_j[pos_j - 1], clientes_j[pos_j]) +
+                         dist(clientes_j[pos_j - 1], cliente_a_mover) +
+                         dist(cliente_a_mover, clientes_j[pos_j]);
 
       int nuevaDemanda_j = demanda_cliente + demanda_ruta_j;
 
@@ -86,10 +100,10 @@ Solucion OperadorRelocate::mejorRelocateEntreRutas(size_t i, size_t j) {
         // Crear nuevas rutas
         Ruta nuevaRuta_i =
             Ruta(ruta_i.getCapacidadMaxima(),
-                 ruta_i.getIdDeposito(), distMatrix, ruta_i.getAllClientes(), nuevos_clientes_i);
+                 ruta_i.getIdDeposito(), distancias, ruta_i.getAllClientes(), nuevos_clientes_i);
         Ruta nuevaRuta_j =
             Ruta(ruta_j.getCapacidadMaxima(),
-                 ruta_j.getIdDeposito(), distMatrix, ruta_j.getAllClientes(), nuevos_clientes_j);
+                 ruta_j.getIdDeposito(), distancias, ruta_j.getAllClientes(), nuevos_clientes_j);
 
         // Verificar si las nuevas rutas son factibles
         if (nuevaRuta_i.esFactible() && nuevaRuta_j.esFactible()) {
@@ -106,7 +120,7 @@ Solucion OperadorRelocate::mejorRelocateEntreRutas(size_t i, size_t j) {
   nuevasRutas[i] = mejorRuta_i;
   nuevasRutas[j] = mejorRuta_j;
   Solucion nuevaSolucion =
-      Solucion(solucion.getClientes(), distMatrix, solucion.getCantCamiones(), nuevasRutas);
+      Solucion(solucion.getClientes(), distancias, solucion.getCantCamiones(), nuevasRutas);
 
   return nuevaSolucion;
 }
\ No newline at end of file
@@ -1,15 +1,24 @@
 #ifndef OPERADOR_RELOCATE_H
 #define OPERADOR_RELOCATE_H
 #include "Solucion.h"
+#include "CriterioParada.h"
 
 class OperadorRelocate {
 public:
   OperadorRelocate(const Solucion &solucion);
   Solucion aplicar();
+  // Si se indica, se revisa entre pares de rutas y entre clientes de la
+  // ruta origen: al pedir detenerse devuelve la mejor solución hallada
+  // hasta ese momento (siempre factible si la original lo era)
+  void setControlParada(const ControlParada *control);
 
 private:
   const Solucion &solucion;
+  const ControlParada *control;
   Solucion mejorRelocateEntreRutas(size_t ruta1, size_t ruta2);
+  // dist es el acceso concreto que da ProveedorDistancias::conAlmacen
+  template <typename Distancias>
+  Solucion mejorRelocateEntreRutas(size_t ruta1, size_t ruta2, const Distancias &dist);
 };
 
 #endif // OPERADOR_RELOCATE_H
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "OperadorSwap.h"
 
-OperadorSwap::OperadorSwap(const Solucion &solucion) : solucion(solucion) {}
+OperadorSwap::OperadorSwap(const Solucion &solucion)
+    : solucion(solucion), control(nullptr) {}
+
+void OperadorSwap::setControlParada(const ControlParada *nuevo) { control = nuevo; }
 
 Solucion OperadorSwap::aplicar() {
   Solucion mejorSolucion = solucion;
@@ -8,6 +11,8 @@ Solucion OperadorSwap::aplicar() {
 
   for (size_t i = 0; i < solucion.getRutas().size(); i++) {
     for (size_t j = i + 1; j < solucion.getRutas().size(); j++) {
+      if (control && control->debeDetenerse())
+        return mejorSolucion;
       Solucion nuevaSolucion = mejorSwapEntreRutas(i, j);
       if (nuevaSolucion.getCostoTotal() < mejorCosto) {
         mejorSolucion = nuevaSolucion;
@@ -19,7 +24,15 @@ Solucion OperadorSwap::aplicar() {
 }
 
 Solucion OperadorSwap::mejorSwapEntreRutas(size_t i, size_t j) {
-  const vector<vector<double>> &distMatrix = solucion.getDistMatrix();
+  // El bucle se compila una vez por formato de distancias, sin decidir el
+  // formato en cada consulta
+  return solucion.getDistancias()->conAlmacen(
+      [&](const auto &dist) { return mejorSwapEntreRutas(i, j, dist); });
+}
+
+template <typename Distancias>
+Solucion OperadorSwap::mejorSwapEntreRutas(size_t i, size_t j, const Distancias &dist) {
+  const shared_ptr<const ProveedorDistancias> &distancias = solucion.getDistancias();
   Ruta ruta_i = solucion.getRutas()[i];
   Ruta ruta_j = solucion.getRutas()[j];
   int costo_i = ruta_i.getCosto();
@@ -33,6 +46,8 @@ Solucion OperadorSwap::mejorSwapEntreRutas(size_t i, size_t j) {
   int mejorCosto = costo_i + costo_j;
 
   for (size_t pos_i = 1; pos_i < static_cast<size_t>(size_i - 1); pos_i++) {
+    if (control && control->debeDetenerse())
+      break;
     vector<int> clientes_i = ruta_i.getClientes();
     vector<int> clientes_j = ruta_j.getClientes();
 
@@ -64,16 +79,16 @@ Solucion OperadorSwap::mejorSwapEntreRutas(size_t i, size_t j) {
 
       // Calcular nuevos costos incrementalmente
       int nuevoCosto_i = costo_i -
-                         distMatrix[clientes_i[pos_i - 1]][cliente_i] -
-                         distMatrix[cliente_i][clientes_i[pos_i + 1]] +
-                         distMatrix[clientes_i[pos_i - 1]][cliente_j] +
-                         distMatrix[cliente_j][clientes_i[pos_i + 1]];
+                         dist(clientes_i[pos_i - 1], cliente_i) -
+                         dist(cliente_i, clientes_i[pos_i + 1]) +
+                         dist(clientes_i[pos_i - 1], cliente_j) +
+                         dist(cliente_j, clientes_i[pos_i + 1]);
 
       int nuevoCosto_j = costo_j -
-                         distMatrix[clientes_j[pos_j - 1]][cliente_j] -
-                         distMatrix[cliente_j][clientes_j[pos_j + 1]] +
-                         distMatrix[clientes_j[pos_j - 1]][cliente_i] +
-                         distMatrix[cliente_i][clientes_j[pos_j + 1]];
+                         dist(clientes_j[pos_j - 1], cliente_j) -
+                         dist(cliente_j, clientes_j[pos_j + 1]) +
+                         dist(clientes_j[pos_j - 1], cliente_i) +
+                         dist(cliente_i, clientes_j[pos_j + 1]);
 
       // Verificar restricciones de capacidad
       int nuevaDemanda_i =
@@ -97,10 +112,10 @@ Solucion OperadorSwap::mejorSwapEntreRutas(size_t i, size_t j) {
         // Crear nuevas rutas
         Ruta nuevaRuta_i =
             Ruta(ruta_i.getCapacidadMaxima(),
-                 ruta_i.getIdDeposito(), distMatrix, ruta_i.getAllClientes(), nuevos_clientes_i);
+                 ruta_i.getIdDeposito(), distancias, ruta_i.getAllClientes(), nuevos_clientes_i);
         Ruta nuevaRuta_j =
             Ruta(ruta_j.getCapacidadMaxima(),
-                 ruta_j.getIdDeposito(), distMatrix, ruta_j.getAllClientes(), nuevos_clientes_j);
+                 ruta_j.getIdDeposito(), distancias, ruta_j.getAllClientes(), nuevos_clientes_j);
 
         // Verificar si las nuevas rutas son factibles
         if (nuevaRuta_i.esFactible() && nuevaRuta_j.esFactible()) {
@@ -117,7 +132,7 @@ Solucion OperadorSwap::mejorSwapEntreRutas(size_t i, size_t j) {
   nuevasRutas[i] = mejorRuta_i;
   nuevasRutas[j] = mejorRuta_j;
   Solucion nuevaSolucion =
-      Solucion(solucion.getClientes(), distMatrix, solucion.getCantCamiones(), nuevasRutas);
+      Solucion(solucion.getClientes(), distancias, solucion.getCantCamiones(), nuevasRutas);
 
   return nuevaSolucion;
 }
\ No newline at end of file
@@ -1,15 +1,24 @@
 #ifndef OPERADOR_SWAP_H
 #define OPERADOR_SWAP_H
 #include "Solucion.h"
+#include "CriterioParada.h"
 
 class OperadorSwap {
 public:
   OperadorSwap(const Solucion &solucion);
   Solucion aplicar();
+  // Si se indica, se revisa entre pares de rutas y entre clientes de la
+  // ruta origen: al pedir detenerse devuelve la mejor solución hallada
+  // hasta ese momento (siempre factible si la original lo era)
+  void setControlParada(const ControlParada *control);
   Solucion mejorSwapEntreRutas(size_t ruta1, size_t ruta2);
 
 private:
   const Solucion &solucion;
+  const ControlParada *control;
+  // dist es el acceso concreto que da ProveedorDistancias::conAlmacen
+  template <typename Distancias>
+  Solucion mejorSwapEntreRutas(size_t ruta1, size_t ruta2, const Distancias &dist);
 };
 
 #endif // OPERADOR_SWAP_H
\ No newline at end of file
@@ -0,0 +1,231 @@
+#include "OptimizadorRuta.h"
+#include "GeneradorAleatorio.h"
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+// Mejora mínima para reemplazar una ruta (evita cambios por redondeo)
+static const double EPSILON_MEJORA = 1e-9;
+
+// Más de 16 clientes no entra en memoria razonable (2^k * k entradas)
+static const int MAX_EXACTO_PERMITIDO = 16;
+
+// Tamaño máximo de la caché; al llenarse se vacía
+static const size_t MAX_ENTRADAS_CACHE = 1 << 16;
+
+// Largo máximo de los tramos que mueve Or-opt
+static const int LARGO_OR_OPT = 3;
+
+// Semilla de las claves por cliente del hash de conjuntos
+static const uint64_t SEMILLA_CLAVES = 0x4b3a5d1f2e6c7089ULL;
+
+OptimizadorRuta::OptimizadorRuta(const InstanciaCompacta& inst, int maxExacto)
+    : inst(inst),
+      maxExacto(min(max(0, maxExacto), MAX_EXACTO_PERMITIDO)),
+      resueltasExactas(0),
+      aciertosCache(0),
+      resueltasHeuristicas(0)
+{}
+
+double OptimizadorRuta::costoRuta(const vector<int>& ruta) const {
+    int deposito = inst.getPosDeposito();
+    int prev = deposito;
+    double costo = 0;
+    for (int pos : ruta) {
+        costo += inst.dist(prev, pos);
+        prev = pos;
+    }
+    return costo + inst.dist(prev, deposito);
+}
+
+uint64_t OptimizadorRuta::claveConjunto(const vector<int>& ruta) const {
+    // Suma de claves por cliente: no depende del orden
+    uint64_t clave = 0;
+    for (int pos : ruta)
+        clave += GeneradorAleatorio::derivarSemilla(SEMILLA_CLAVES, pos);
+    return clave;
+}
+
+double OptimizadorRuta::heldKarp(const vector<int>& ruta, vector<int>& orden) {
+    const int k = static_cast<int>(ruta.size());
+    const int deposito = inst.getPosDeposito();
+    const size_t completo = size_t(1) << k;
+
+    // Distancias locales con el depósito en el índice k
+    distLocal.resize((k + 1) * (k + 1));
+    for (int a = 0; a <= k; ++a) {
+        int pa = a == k ? deposito : ruta[a];
+        for (int b = 0; b <= k; ++b) {
+            int pb = b == k ? deposito : ruta[b];
+            distLocal[a * (k + 1) + b] = inst.dist(pa, pb);
+        }
+    }
+    auto d = [&](int a, int b) { return distLocal[a * (k + 1) + b]; };
+
+    // dp[S][j]: camino más corto que sale del depósito, visita S y termina en j
+    const double INF = numeric_limits<double>::max();
+    dp.assign(completo * k, INF);
+    previo.resize(completo * k);
+    for (int j = 0; j < k; ++j)
+        dp[(size_t(1) << j) * k + j] = d(k, j);
+
+    // Se recorren sólo los bits prendidos (j) y apagados (t) de cada máscara
+    for (size_t mascara = 1; mascara < completo; ++mascara) {
+        const double* fila = &dp[mascara * k];
+        for (size_t bitsJ = mascara; bitsJ; bitsJ &= bitsJ - 1) {
+            int j = __builtin_ctzll(bitsJ);
+            double base = fila[j];
+            const double* desdeJ = &distLocal[j * (k + 1)];
+            for (size_t bitsT = ~mascara & (completo - 1); bitsT; bitsT &= bitsT - 1) {
+                int t = __builtin_ctzll(bitsT);
+                size_t indice = (mascara | (size_t(1) << t)) * k + t;
+                double valor = base + desdeJ[t];
+                if (valor < dp[indice]) {
+                    dp[indice] = valor;
+                    previo[indice] = static_cast<uint8_t>(j);
+                }
+            }
+        }
+    }
+
+    size_t todos = completo - 1;
+    int ultimo = 0;
+    double mejor = INF;
+    for (int j = 0; j < k; ++j) {
+        double valor = dp[todos * k + j] + d(j, k);
+        if (valor < mejor) {
+            mejor = valor;
+            ultimo = j;
+        }
+    }
+
+    orden.resize(k);
+    size_t mascara = todos;
+    for (int i = k - 1; i >= 0; --i) {
+        orden[i] = ruta[ultimo];
+        int anterior = previo[mascara * k + ultimo];
+        mascara ^= size_t(1) << ultimo;
+        ultimo = anterior;
+    }
+    return mejor;
+}
+
+void OptimizadorRuta::mejorarLocal(vector<int>& ruta) const {
+    const int n = static_cast<int>(ruta.size());
+    const int deposito = inst.getPosDeposito();
+    auto nodo = [&](int i) { return (i < 0 || i >= n) ? deposito : ruta[i]; };
+
+    bool mejoro = true;
+    while (mejoro) {
+        mejoro = false;
+
+        // 2-opt: invertir ruta[i..j]
+        for (int i = 0; i < n - 1; ++i) {
+            for (int j = i + 1; j < n; ++j) {
+                int a = nodo(i - 1), b = ruta[i], c = ruta[j], e = nodo(j + 1);
+                double delta = inst.dist(a, c) + inst.dist(b, e)
+                             - inst.dist(a, b) - inst.dist(c, e);
+                // Con distancias asimétricas el tramo invertido también cambia de costo
+                if (!inst.esSimetrica()) {
+                    for (int k = i; k < j; ++k)
+                        delta += inst.dist(ruta[k + 1], ruta[k]) - inst.dist(ruta[k], ruta[k + 1]);
+                }
+                if (delta < -EPSILON_MEJORA) {
+                    reverse(ruta.begin() + i, ruta.begin() + j + 1);
+                    mejoro = true;
+                }
+            }
+        }
+
+        // Or-opt: llevar un tramo de 1 a 3 clientes a otro lugar de la ruta
+        for (int largo = 1; largo <= LARGO_OR_OPT; ++largo) {
+            for (int i = 0; i + largo <= n; ++i) {
+                int p = nodo(i - 1), s0 = ruta[i], s1 = ruta[i + largo - 1], q = nodo(i + largo);
+                double ahorro = inst.dist(p, s0) + inst.dist(s1, q) - inst.dist(p, q);
+                // El arco g une nodo(g - 1) con nodo(g); los de i..i+largo tocan el tramo
+                for (int g = 0; g <= n; ++g) {
+                    if (g >= i && g <= i + largo)
+                        continue;
+                    int u = nodo(g - 1), v = nodo(g);
+                    double agregado = inst.dist(u, s0) + inst.dist(s1, v) - inst.dist(u, v);
+                    if (agregado - ahorro >= -EPSILON_MEJORA)
+                        continue;
+                    vector<int> tramo(ruta.begin() + i, ruta.begin() + i + largo);
+                    ruta.erase(ruta.begin() + i, ruta.begin() + i + largo);
+                    int destino = g > i ? g - largo : g;
+                    ruta.insert(ruta.begin() + destino, tramo.begin(), tramo.end());
+                    mejoro = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+double OptimizadorRuta::optimizar(vector<int>& ruta) {
+    if (ruta.size() < 2)
+        return 0;
+    double antes = costoRuta(ruta);
+
+    if (static_cast<int>(ruta.size()) > maxExacto) {
+        vector<int> copia = ruta;
+        mejorarLocal(copia);
+        resueltasHeuristicas++;
+        double despues = costoRuta(copia);
+        if (despues >= antes - EPSILON_MEJORA)
+            return 0;
+        ruta = move(copia);
+        return antes - despues;
+    }
+
+    uint64_t clave = claveConjunto(ruta);
+    ordenado = ruta;
+    sort(ordenado.begin(), ordenado.end());
+    auto it = cache.find(clave);
+    if (it != cache.end() && it->second.conjunto == ordenado) {
+        aciertosCache++;
+    } else {
+        if (cache.size() >= MAX_ENTRADAS_CACHE)
+            cache.clear();
+        Entrada& entrada = cache[clave];
+        entrada.conjunto = ordenado;
+        // Se resuelve sobre el conjunto ordenado: el resultado depende sólo
+        // del conjunto, esté o no en la caché
+        entrada.costo = heldKarp(ordenado, entrada.orden);
+        resueltasExactas++;
+        it = cache.find(clave);
+    }
+
+    const Entrada& entrada = it->second;
+    if (entrada.costo >= antes - EPSILON_MEJORA)
+        return 0;
+    ruta = entrada.orden;
+    return antes - entrada.costo;
+}
+
+double OptimizadorRuta::optimizar(SolucionCompacta& sol) {
+    double mejora = 0;
+    vector<int> ruta;
+    for (int r = 0; r < sol.getCantRutas(); ++r) {
+        if (sol.getRuta(r).size() < 2)
+            continue;
+        ruta = sol.getRuta(r);
+        double delta = optimizar(ruta);
+        if (delta > 0) {
+            sol.reemplazarRuta(r, ruta);
+            mejora += delta;
+        }
+    }
+    return mejora;
+}
+
+void OptimizadorRuta::setMaxExacto(int clientes) {
+    maxExacto = min(max(0, clientes), MAX_EXACTO_PERMITIDO);
+}
+
+long OptimizadorRuta::getResueltasExactas() const { return resueltasExactas; }
+
+long OptimizadorRuta::getAciertosCache() const { return aciertosCache; }
+
+long OptimizadorRuta::getResueltasHeuristicas() const { return resueltasHeuristicas; }
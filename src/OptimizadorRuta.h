@@ -0,0 +1,64 @@
+#ifndef OPTIMIZADOR_RUTA_H
+#define OPTIMIZADOR_RUTA_H
+
+#include "InstanciaCompacta.h"
+#include "SolucionCompacta.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// Reordena cada ruta por separado. Las de hasta `maxExacto` clientes se
+// resuelven en forma exacta con la programación dinámica de Held-Karp
+// (O(2^k k^2)); las más largas, con 2-opt y Or-opt hasta óptimo local.
+// Los órdenes exactos se guardan en una caché indexada por el conjunto de
+// clientes, así un mismo conjunto no se vuelve a resolver. Las tablas y la
+// caché son del objeto: no es seguro compartirlo entre hilos, se usa uno
+// por hilo.
+class OptimizadorRuta {
+private:
+    struct Entrada {
+        vector<int> conjunto;  // ordenado, para descartar colisiones del hash
+        vector<int> orden;
+        double costo;
+    };
+
+    const InstanciaCompacta& inst;
+    int maxExacto;
+
+    // Tablas de Held-Karp, reutilizadas entre rutas
+    vector<double> dp;        // [mascara * k + ultimo]
+    vector<uint8_t> previo;
+    vector<double> distLocal; // (k + 1) x (k + 1), el depósito en k
+    vector<int> ordenado;
+
+    unordered_map<uint64_t, Entrada> cache;
+
+    long resueltasExactas;
+    long aciertosCache;
+    long resueltasHeuristicas;
+
+    double costoRuta(const vector<int>& ruta) const;
+    uint64_t claveConjunto(const vector<int>& ruta) const;
+    double heldKarp(const vector<int>& ruta, vector<int>& orden);
+    void mejorarLocal(vector<int>& ruta) const;
+
+public:
+    explicit OptimizadorRuta(const InstanciaCompacta& inst, int maxExacto = 12);
+
+    // Reordena `ruta` (posiciones, sin depósitos) y devuelve cuánto bajó
+    // su costo; si no mejora, la deja como estaba
+    double optimizar(vector<int>& ruta);
+    // Todas las rutas de la solución, en el lugar
+    double optimizar(SolucionCompacta& sol);
+
+    // Clientes por ruta hasta los que se usa Held-Karp (como mucho 16)
+    void setMaxExacto(int clientes);
+
+    long getResueltasExactas() const;
+    long getAciertosCache() const;
+    long getResueltasHeuristicas() const;
+};
+
+#endif
@@ -0,0 +1,276 @@
+#include "ParticionConjuntos.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+
+// Diferencia mínima para considerar que una partición mejora a otra
+static const double EPSILON_MEJORA = 1e-9;
+
+// Subgradiente: iteraciones, paso inicial (relativo) y cuántas iteraciones
+// sin mejorar la cota se esperan antes de achicar el paso a la mitad
+static const int ITERACIONES_SUBGRADIENTE = 300;
+static const double PASO_INICIAL = 2.0;
+static const int ITERACIONES_POR_PASO = 20;
+static const double PASO_MINIMO = 1e-4;
+
+// Cada cuántos nodos se consulta el control de parada
+static const long NODOS_POR_CONSULTA = 1024;
+
+ParticionConjuntos::ParticionConjuntos(const InstanciaCompacta& inst)
+    : inst(inst),
+      maxNodos(100000),
+      control(nullptr),
+      costoFijado(0),
+      sumaUPendiente(0),
+      sumaNegativos(0),
+      numVehiculos(0),
+      pendientes(0),
+      mejorCosto(0),
+      nodos(0),
+      cortado(false),
+      cotaInferior(0)
+{}
+
+void ParticionConjuntos::ajustarMultiplicadores(double cotaSuperior) {
+    const int n = static_cast<int>(rutasDe.size());
+    const int m = static_cast<int>(costos.size());
+
+    // Arranque: cada cliente paga su parte de la ruta más barata que lo cubre
+    u.assign(n, numeric_limits<double>::max());
+    for (int c = 0; c < m; ++c) {
+        double parte = costos[c] / clientesDe[c].size();
+        for (int i : clientesDe[c])
+            u[i] = min(u[i], parte);
+    }
+    if (!isfinite(cotaSuperior)) {
+        cotaSuperior = 0;
+        for (double ui : u)
+            cotaSuperior += 2 * ui;
+    }
+
+    vector<double> mejorU = u;
+    vector<double> subgradiente(n);
+    double mejorCota = -numeric_limits<double>::max();
+    double paso = PASO_INICIAL;
+    int sinMejora = 0;
+    for (int iter = 0; iter < ITERACIONES_SUBGRADIENTE && paso > PASO_MINIMO; ++iter) {
+        double cota = 0;
+        for (int i = 0; i < n; ++i) {
+            cota += u[i];
+            subgradiente[i] = 1;
+        }
+        for (int c = 0; c < m; ++c) {
+            double rc = costos[c];
+            for (int i : clientesDe[c])
+                rc -= u[i];
+            if (rc >= 0)
+                continue;
+            cota += rc;
+            for (int i : clientesDe[c])
+                subgradiente[i] -= 1;
+        }
+
+        if (cota > mejorCota + EPSILON_MEJORA) {
+            mejorCota = cota;
+            mejorU = u;
+            sinMejora = 0;
+        } else if (++sinMejora >= ITERACIONES_POR_PASO) {
+            paso /= 2;
+            sinMejora = 0;
+        }
+        if (mejorCota >= cotaSuperior - EPSILON_MEJORA)
+            break;
+
+        double norma = 0;
+        for (double g : subgradiente)
+            norma += g * g;
+        // Subgradiente nulo: la solución relajada ya es una partición
+        if (norma == 0)
+            break;
+        double t = paso * (cotaSuperior - cota) / norma;
+        for (int i = 0; i < n; ++i)
+            u[i] += t * subgradiente[i];
+    }
+    u = mejorU;
+    cotaInferior = mejorCota;
+}
+
+void ParticionConjuntos::elegir(int ruta) {
+    elegidas.push_back(ruta);
+    costoFijado += costos[ruta];
+    for (int i : clientesDe[ruta]) {
+        cubierto[i] = 1;
+        sumaUPendiente -= u[i];
+        pendientes--;
+        for (int otra : rutasDe[i]) {
+            if (bloqueos[otra]++ > 0)
+                continue;
+            sumaNegativos -= min(0.0, reducido[otra]);
+            for (int j : clientesDe[otra])
+                disponibles[j]--;
+        }
+    }
+}
+
+void ParticionConjuntos::deshacer(int ruta) {
+    const vector<int>& clientes = clientesDe[ruta];
+    for (auto it = clientes.rbegin(); it != clientes.rend(); ++it) {
+        int i = *it;
+        for (int otra : rutasDe[i]) {
+            if (--bloqueos[otra] > 0)
+                continue;
+            sumaNegativos += min(0.0, reducido[otra]);
+            for (int j : clientesDe[otra])
+                disponibles[j]++;
+        }
+        cubierto[i] = 0;
+        sumaUPendiente += u[i];
+        pendientes++;
+    }
+    costoFijado -= costos[ruta];
+    elegidas.pop_back();
+}
+
+void ParticionConjuntos::buscar() {
+    if (cortado)
+        return;
+    if (++nodos > maxNodos ||
+        (control && nodos % NODOS_POR_CONSULTA == 0 && control->debeDetenerse())) {
+        cortado = true;
+        return;
+    }
+    if (pendientes == 0) {
+        if (costoFijado < mejorCosto - EPSILON_MEJORA) {
+            mejorCosto = costoFijado;
+            mejorEleccion = elegidas;
+        }
+        return;
+    }
+    if (static_cast<int>(elegidas.size()) >= numVehiculos)
+        return;
+    if (costoFijado + sumaUPendiente + sumaNegativos >= mejorCosto - EPSILON_MEJORA)
+        return;
+
+    // Se ramifica sobre el cliente con menos rutas disponibles
+    int cliente = -1;
+    for (int i = 0; i < static_cast<int>(cubierto.size()); ++i) {
+        if (cubierto[i])
+            continue;
+        if (cliente < 0 || disponibles[i] < disponibles[cliente])
+            cliente = i;
+    }
+    if (disponibles[cliente] == 0)
+        return;
+
+    vector<int> candidatas;
+    for (int ruta : rutasDe[cliente]) {
+        if (bloqueos[ruta] == 0)
+            candidatas.push_back(ruta);
+    }
+    sort(candidatas.begin(), candidatas.end(),
+         [&](int a, int b) { return reducido[a] < reducido[b]; });
+    for (int ruta : candidatas) {
+        elegir(ruta);
+        buscar();
+        deshacer(ruta);
+        if (cortado)
+            return;
+    }
+}
+
+bool ParticionConjuntos::resolver(const PoolRutas& pool, double cotaSuperior,
+                                  vector<vector<int>>& rutas) {
+    const vector<int>& posClientes = inst.getPosClientes();
+    const int n = static_cast<int>(posClientes.size());
+    indicePorPos.assign(inst.getCantPos(), -1);
+    for (int i = 0; i < n; ++i)
+        indicePorPos[posClientes[i]] = i;
+
+    clientesDe.assign(pool.getTamano(), vector<int>());
+    costos.resize(pool.getTamano());
+    for (int c = 0; c < pool.getTamano(); ++c) {
+        for (int pos : pool.getConjunto(c))
+            clientesDe[c].push_back(indicePorPos[pos]);
+        costos[c] = pool.getCosto(c);
+    }
+    rutasDe.assign(n, vector<int>());
+    for (int c = 0; c < pool.getTamano(); ++c) {
+        for (int i : clientesDe[c])
+            rutasDe[i].push_back(c);
+    }
+
+    nodos = 0;
+    cortado = false;
+    cotaInferior = -numeric_limits<double>::max();
+    mejorEleccion.clear();
+    for (int i = 0; i < n; ++i) {
+        if (rutasDe[i].empty())
+            return false;
+    }
+
+    ajustarMultiplicadores(cotaSuperior);
+    if (cotaInferior >= cotaSuperior - EPSILON_MEJORA)
+        return false;
+
+    // Fijación por costo reducido: una ruta con cota + costo reducido por
+    // encima de la mejor conocida no puede estar en una partición mejor
+    vector<int> original;
+    vector<vector<int>> activas;
+    vector<double> costosActivas;
+    reducido.clear();
+    for (int c = 0; c < static_cast<int>(costos.size()); ++c) {
+        double rc = costos[c];
+        for (int i : clientesDe[c])
+            rc -= u[i];
+        if (cotaInferior + max(0.0, rc) >= cotaSuperior - EPSILON_MEJORA)
+            continue;
+        original.push_back(c);
+        activas.push_back(move(clientesDe[c]));
+        costosActivas.push_back(costos[c]);
+        reducido.push_back(rc);
+    }
+    clientesDe = move(activas);
+    costos = move(costosActivas);
+    rutasDe.assign(n, vector<int>());
+    for (int c = 0; c < static_cast<int>(costos.size()); ++c) {
+        for (int i : clientesDe[c])
+            rutasDe[i].push_back(c);
+    }
+
+    cubierto.assign(n, 0);
+    bloqueos.assign(costos.size(), 0);
+    disponibles.resize(n);
+    for (int i = 0; i < n; ++i)
+        disponibles[i] = static_cast<int>(rutasDe[i].size());
+    elegidas.clear();
+    costoFijado = 0;
+    sumaUPendiente = 0;
+    for (double ui : u)
+        sumaUPendiente += ui;
+    sumaNegativos = 0;
+    for (double rc : reducido)
+        sumaNegativos += min(0.0, rc);
+    numVehiculos = inst.getNumVehiculos();
+    pendientes = n;
+    mejorCosto = cotaSuperior;
+
+    buscar();
+    if (mejorEleccion.empty())
+        return false;
+    rutas.clear();
+    for (int c : mejorEleccion)
+        rutas.push_back(pool.getSecuencia(original[c]));
+    return true;
+}
+
+void ParticionConjuntos::setMaxNodos(long nuevo) { maxNodos = nuevo > 0 ? nuevo : 100000; }
+
+void ParticionConjuntos::setControlParada(const ControlParada* nuevo) { control = nuevo; }
+
+long ParticionConjuntos::getNodos() const { return nodos; }
+
+double ParticionConjuntos::getCotaInferior() const { return cotaInferior; }
+
+bool ParticionConjuntos::fueCompleta() const { return !cortado; }
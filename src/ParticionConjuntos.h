@@ -0,0 +1,76 @@
+#ifndef PARTICION_CONJUNTOS_H
+#define PARTICION_CONJUNTOS_H
+
+#include "InstanciaCompacta.h"
+#include "PoolRutas.h"
+#include "CriterioParada.h"
+#include <vector>
+
+using namespace std;
+
+// Recombinación por partición de conjuntos: entre las rutas de un
+// PoolRutas elige las de costo total mínimo que visitan a cada cliente
+// exactamente una vez, sin pasarse de la flota. Se resuelve con branch and
+// bound en profundidad. La cota de cada nodo es lagrangiana: con los
+// multiplicadores u de la raíz (ajustados por subgradiente) vale
+// costo fijado + suma de u de los no cubiertos + suma de los costos
+// reducidos negativos de las rutas todavía disponibles, y se mantiene en
+// O(1) al fijar y liberar rutas. En la raíz se descartan además las rutas
+// cuyo costo reducido ya supera la brecha.
+class ParticionConjuntos {
+private:
+    const InstanciaCompacta& inst;
+    long maxNodos;
+    const ControlParada* control;
+
+    // Problema de la llamada en curso (clientes por índice 0..n-1)
+    vector<int> indicePorPos;
+    vector<vector<int>> clientesDe;    // rutas -> clientes
+    vector<vector<int>> rutasDe;       // clientes -> rutas
+    vector<double> costos;
+    vector<double> u;
+    vector<double> reducido;
+
+    // Estado del branch and bound
+    vector<char> cubierto;
+    vector<int> bloqueos;      // clientes cubiertos de cada ruta
+    vector<int> disponibles;   // rutas no bloqueadas de cada cliente
+    vector<int> elegidas;
+    double costoFijado;
+    double sumaUPendiente;
+    double sumaNegativos;
+    int numVehiculos;
+    int pendientes;
+
+    double mejorCosto;
+    vector<int> mejorEleccion;
+    long nodos;
+    bool cortado;
+    double cotaInferior;
+
+    void ajustarMultiplicadores(double cotaSuperior);
+    void elegir(int ruta);
+    void deshacer(int ruta);
+    void buscar();
+
+public:
+    explicit ParticionConjuntos(const InstanciaCompacta& inst);
+
+    // Busca una partición de costo menor que `cotaSuperior`. Devuelve true
+    // y las secuencias elegidas si la encuentra; la búsqueda se corta al
+    // llegar al límite de nodos o si el control pide detenerse.
+    bool resolver(const PoolRutas& pool, double cotaSuperior, vector<vector<int>>& rutas);
+
+    // Nodos por llamada (100000 por defecto)
+    void setMaxNodos(long nodos);
+    void setControlParada(const ControlParada* control);
+
+    long getNodos() const;
+    // Cota lagrangiana de la raíz en la última llamada
+    double getCotaInferior() const;
+    // true si la última llamada recorrió todo el árbol (el resultado, o la
+    // falta de uno, es óptimo)
+    bool fueCompleta() const;
+};
+
+#endif
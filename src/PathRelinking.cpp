@@ -0,0 +1,102 @@
+#include "PathRelinking.h"
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+using namespace std;
+
+PathRelinking::PathRelinking(const InstanciaCompacta& inst) : inst(inst) {}
+
+vector<int> PathRelinking::emparejarRutas(const SolucionCompacta& origen,
+                                          const SolucionCompacta& guia) const {
+    int rg = guia.getCantRutas();
+    int ro = origen.getCantRutas();
+    vector<vector<int>> comunes(rg, vector<int>(ro, 0));
+    for (int pos : inst.getPosClientes()) {
+        int g = guia.getRutaDe(pos);
+        int o = origen.getRutaDe(pos);
+        if (g >= 0 && o >= 0) comunes[g][o]++;
+    }
+
+    vector<tuple<int, int, int>> pares;  // (-comunes, g, o)
+    for (int g = 0; g < rg; ++g) {
+        for (int o = 0; o < ro; ++o) {
+            if (comunes[g][o] > 0) pares.emplace_back(-comunes[g][o], g, o);
+        }
+    }
+    sort(pares.begin(), pares.end());
+
+    vector<int> destino(rg, -1);
+    vector<bool> usada(ro, false);
+    for (const auto& par : pares) {
+        int g = get<1>(par);
+        int o = get<2>(par);
+        if (destino[g] < 0 && !usada[o]) {
+            destino[g] = o;
+            usada[o] = true;
+        }
+    }
+    return destino;
+}
+
+SolucionCompacta PathRelinking::aplicar(const SolucionCompacta& origen,
+                                        const SolucionCompacta& guia) const {
+    SolucionCompacta actual = origen;
+    SolucionCompacta mejor = origen;
+    double mejorCosto = origen.getCosto();
+
+    // Rutas de la guía sin pareja: se les abre una ruta vacía en el origen
+    vector<int> destinoRuta = emparejarRutas(actual, guia);
+    for (int& d : destinoRuta) {
+        if (d < 0) d = actual.agregarRutaVacia();
+    }
+
+    vector<int> pendientes;
+    for (int pos : inst.getPosClientes()) {
+        int g = guia.getRutaDe(pos);
+        if (g >= 0 && actual.getRutaDe(pos) != destinoRuta[g])
+            pendientes.push_back(pos);
+    }
+
+    int capacidad = inst.getCapacidad();
+    // El último paso deja al origen con la partición de la guía: no cuenta
+    while (pendientes.size() > 1) {
+        int elegido = -1;
+        int indiceInsercion = 0;
+        double mejorDelta = numeric_limits<double>::max();
+        for (size_t p = 0; p < pendientes.size(); ++p) {
+            int pos = pendientes[p];
+            int destino = destinoRuta[guia.getRutaDe(pos)];
+            if (actual.getCarga(destino) + inst.getDemanda(pos) > capacidad)
+                continue;
+            int r = actual.getRutaDe(pos);
+            double delta = actual.deltaRemover(r, actual.getIndiceEn(pos));
+            double deltaIns;
+            int i = actual.mejorInsercion(destino, pos, deltaIns);
+            delta += deltaIns;
+            if (delta < mejorDelta) {
+                mejorDelta = delta;
+                elegido = static_cast<int>(p);
+                indiceInsercion = i;
+            }
+        }
+        if (elegido < 0)
+            break;  // ningún paso respeta la capacidad
+
+        int pos = pendientes[elegido];
+        int destino = destinoRuta[guia.getRutaDe(pos)];
+        actual.remover(actual.getRutaDe(pos), actual.getIndiceEn(pos));
+        actual.insertar(destino, indiceInsercion, pos);
+        pendientes[elegido] = pendientes.back();
+        pendientes.pop_back();
+
+        if (actual.getCosto() < mejorCosto - 1e-9 &&
+            actual.getCantRutasNoVacias() <= inst.getNumVehiculos()) {
+            mejor = actual;
+            mejorCosto = actual.getCosto();
+        }
+    }
+
+    mejor.eliminarRutasVacias();
+    return mejor;
+}
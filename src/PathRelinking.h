@@ -0,0 +1,27 @@
+#ifndef PATH_RELINKING_H
+#define PATH_RELINKING_H
+
+#include "SolucionCompacta.h"
+
+// Path relinking entre dos soluciones: parte del origen y, paso a paso,
+// mueve al cliente que más barato sale de llevar a la ruta que le asigna la
+// guía (ubicado en su mejor posición). Los intermedios se evalúan con los
+// deltas de SolucionCompacta, sin reconstruir soluciones; sólo se copia la
+// solución cuando un intermedio factible mejora al mejor visto.
+class PathRelinking {
+public:
+    explicit PathRelinking(const InstanciaCompacta& inst);
+
+    // Devuelve el mejor intermedio estrictamente mejor que el origen, o el
+    // origen si ninguno lo mejora. Los extremos no cuentan como intermedios.
+    SolucionCompacta aplicar(const SolucionCompacta& origen, const SolucionCompacta& guia) const;
+
+private:
+    const InstanciaCompacta& inst;
+
+    // Para cada ruta de la guía, la ruta del origen con la que más clientes
+    // comparte (emparejamiento goloso); -1 si no queda ninguna libre
+    vector<int> emparejarRutas(const SolucionCompacta& origen, const SolucionCompacta& guia) const;
+};
+
+#endif
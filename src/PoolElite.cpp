@@ -0,0 +1,100 @@
+#include "PoolElite.h"
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+PoolElite::PoolElite(int capacidad, int diferenciaMinima)
+    : capacidad(capacidad),
+      diferenciaMinima(diferenciaMinima)
+{}
+
+vector<uint64_t> PoolElite::aristasDe(const SolucionCompacta& sol) {
+    vector<uint64_t> aristas;
+    int deposito = sol.getInstancia().getPosDeposito();
+    auto clave = [](int a, int b) {
+        if (a > b) swap(a, b);
+        return (static_cast<uint64_t>(a) << 32) | static_cast<uint32_t>(b);
+    };
+    for (const vector<int>& ruta : sol.getRutas()) {
+        if (ruta.empty()) continue;
+        int prev = deposito;
+        for (int pos : ruta) {
+            aristas.push_back(clave(prev, pos));
+            prev = pos;
+        }
+        aristas.push_back(clave(prev, deposito));
+    }
+    sort(aristas.begin(), aristas.end());
+    return aristas;
+}
+
+int PoolElite::diferencia(const vector<uint64_t>& a, const vector<uint64_t>& b) {
+    // Diferencia simétrica de multiconjuntos ordenados
+    int comunes = 0;
+    size_t i = 0, j = 0;
+    while (i < a.size() && j < b.size()) {
+        if (a[i] < b[j]) {
+            i++;
+        } else if (b[j] < a[i]) {
+            j++;
+        } else {
+            comunes++;
+            i++;
+            j++;
+        }
+    }
+    return static_cast<int>(a.size() + b.size()) - 2 * comunes;
+}
+
+int PoolElite::diferencia(const SolucionCompacta& a, const SolucionCompacta& b) {
+    return diferencia(aristasDe(a), aristasDe(b));
+}
+
+bool PoolElite::intentarAgregar(const SolucionCompacta& sol) {
+    if (capacidad <= 0) return false;
+
+    double costo = sol.getCosto();
+    bool lleno = static_cast<int>(miembros.size()) >= capacidad;
+    if (lleno) {
+        double peor = 0;
+        for (const Miembro& m : miembros) peor = max(peor, m.sol.getCosto());
+        if (costo >= peor) return false;
+    }
+
+    vector<uint64_t> aristas = aristasDe(sol);
+    int reemplazo = -1;
+    int menorDif = numeric_limits<int>::max();
+    for (size_t i = 0; i < miembros.size(); ++i) {
+        int dif = diferencia(aristas, miembros[i].aristas);
+        bool peorQueNueva = miembros[i].sol.getCosto() > costo;
+        // Demasiado parecida a un miembro igual o mejor: no aporta
+        if (dif < diferenciaMinima && !peorQueNueva) return false;
+        if (peorQueNueva && dif < menorDif) {
+            menorDif = dif;
+            reemplazo = static_cast<int>(i);
+        }
+    }
+
+    // Si se parece a uno peor, lo reemplaza aunque el pool no esté lleno
+    if (reemplazo >= 0 && (lleno || menorDif < diferenciaMinima)) {
+        miembros[reemplazo] = Miembro{sol, move(aristas)};
+    } else if (!lleno) {
+        miembros.push_back(Miembro{sol, move(aristas)});
+    } else {
+        return false;
+    }
+    return true;
+}
+
+int PoolElite::getTamano() const { return static_cast<int>(miembros.size()); }
+
+int PoolElite::getCapacidad() const { return capacidad; }
+
+const SolucionCompacta& PoolElite::getMiembro(int i) const { return miembros[i].sol; }
+
+double PoolElite::getMejorCosto() const {
+    double mejor = numeric_limits<double>::max();
+    for (const Miembro& m : miembros) mejor = min(mejor, m.sol.getCosto());
+    return mejor;
+}
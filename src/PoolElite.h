@@ -0,0 +1,44 @@
+#ifndef POOL_ELITE_H
+#define POOL_ELITE_H
+
+#include "SolucionCompacta.h"
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+// Conjunto acotado de buenas soluciones distintas entre sí. La distancia
+// entre dos soluciones es el tamaño de la diferencia simétrica de sus
+// conjuntos de aristas (no dirigidas, incluidas las del depósito).
+class PoolElite {
+private:
+    struct Miembro {
+        SolucionCompacta sol;
+        vector<uint64_t> aristas;  // ordenadas
+    };
+
+    int capacidad;
+    int diferenciaMinima;
+    vector<Miembro> miembros;
+
+    static vector<uint64_t> aristasDe(const SolucionCompacta& sol);
+    static int diferencia(const vector<uint64_t>& a, const vector<uint64_t>& b);
+
+public:
+    PoolElite(int capacidad, int diferenciaMinima);
+
+    // Admite la solución si el pool no está lleno o si es mejor que el peor
+    // miembro, siempre que difiera en al menos `diferenciaMinima` aristas de
+    // todos (salvo de los que mejora, que pueden ser reemplazados). Si está
+    // lleno reemplaza al más parecido entre los peores que ella.
+    bool intentarAgregar(const SolucionCompacta& sol);
+
+    int getTamano() const;
+    int getCapacidad() const;
+    const SolucionCompacta& getMiembro(int i) const;
+    double getMejorCosto() const;
+
+    static int diferencia(const SolucionCompacta& a, const SolucionCompacta& b);
+};
+
+#endif
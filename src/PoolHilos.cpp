@@ -0,0 +1,98 @@
+#include "PoolHilos.h"
+
+using namespace std;
+
+PoolHilos::PoolHilos(int cantidadHilos)
+    : tareaActual(nullptr),
+      total(0),
+      siguiente(0),
+      pendientes(0),
+      generacion(0),
+      terminar(false)
+{
+    int cantidad = cantidadHilos > 0 ? cantidadHilos : hilosDisponibles();
+    for (int hilo = 1; hilo < cantidad; ++hilo) {
+        trabajadores.emplace_back(&PoolHilos::bucleTrabajador, this, hilo);
+    }
+}
+
+PoolHilos::~PoolHilos() {
+    {
+        lock_guard<mutex> lk(mtx);
+        terminar = true;
+    }
+    cvTrabajo.notify_all();
+    for (thread& t : trabajadores) {
+        t.join();
+    }
+}
+
+int PoolHilos::getCantidadHilos() const {
+    return static_cast<int>(trabajadores.size()) + 1;
+}
+
+int PoolHilos::hilosDisponibles() {
+    unsigned int n = thread::hardware_concurrency();
+    return n > 0 ? static_cast<int>(n) : 1;
+}
+
+void PoolHilos::paraCada(int cantidad, const function<void(int, int)>& tarea) {
+    if (cantidad <= 0) return;
+
+    if (trabajadores.empty()) {
+        for (int i = 0; i < cantidad; ++i) tarea(i, 0);
+        return;
+    }
+
+    {
+        lock_guard<mutex> lk(mtx);
+        tareaActual = &tarea;
+        total = cantidad;
+        siguiente.store(0);
+        pendientes = static_cast<int>(trabajadores.size());
+        error = nullptr;
+        ++generacion;
+    }
+    cvTrabajo.notify_all();
+
+    trabajar(0);
+
+    exception_ptr errorTarea;
+    {
+        unique_lock<mutex> lk(mtx);
+        cvFin.wait(lk, [this] { return pendientes == 0; });
+        tareaActual = nullptr;
+        errorTarea = error;
+    }
+    if (errorTarea) rethrow_exception(errorTarea);
+}
+
+void PoolHilos::bucleTrabajador(int hilo) {
+    unsigned long vista = 0;
+    while (true) {
+        {
+            unique_lock<mutex> lk(mtx);
+            cvTrabajo.wait(lk, [&] { return terminar || generacion != vista; });
+            if (terminar) return;
+            vista = generacion;
+        }
+        trabajar(hilo);
+        {
+            lock_guard<mutex> lk(mtx);
+            if (--pendientes == 0) cvFin.notify_one();
+        }
+    }
+}
+
+void PoolHilos::trabajar(int hilo) {
+    int i;
+    while ((i = siguiente.fetch_add(1)) < total) {
+        try {
+            (*tareaActual)(i, hilo);
+        } catch (...) {
+            lock_guard<mutex> lk(mtx);
+            if (!error) error = current_exception();
+            siguiente.store(total);
+        }
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef POOL_HILOS_H
+#define POOL_HILOS_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Pool de hilos persistente para repartir iteraciones independientes.
+// El hilo que llama a paraCada también trabaja (es el hilo 0), así que un
+// pool de N hilos crea N-1 hilos adicionales. No es reentrante: paraCada no
+// debe llamarse desde dentro de una tarea ni desde dos hilos a la vez.
+class PoolHilos {
+public:
+    // cantidadHilos <= 0 usa todos los núcleos disponibles
+    explicit PoolHilos(int cantidadHilos);
+    ~PoolHilos();
+
+    PoolHilos(const PoolHilos&) = delete;
+    PoolHilos& operator=(const PoolHilos&) = delete;
+
+    int getCantidadHilos() const;
+
+    // Ejecuta tarea(i, hilo) para cada i en [0, cantidad), con reparto
+    // dinámico. `hilo` está en [0, getCantidadHilos()) y permite indexar
+    // memoria de trabajo propia de cada hilo. Bloquea hasta que terminan
+    // todas; si alguna tarea lanza, la primera excepción se relanza acá.
+    void paraCada(int cantidad, const function<void(int, int)>& tarea);
+
+    static int hilosDisponibles();
+
+private:
+    vector<thread> trabajadores;
+    mutex mtx;
+    condition_variable cvTrabajo;
+    condition_variable cvFin;
+    const function<void(int, int)>* tareaActual;
+    int total;
+    atomic<int> siguiente;
+    int pendientes;
+    unsigned long generacion;
+    bool terminar;
+    exception_ptr error;
+
+    void bucleTrabajador(int hilo);
+    void trabajar(int hilo);
+};
+
+#endif
@@ -0,0 +1,71 @@
+#include "PoolRutas.h"
+#include "GeneradorAleatorio.h"
+#include <algorithm>
+
+using namespace std;
+
+// Semilla de las claves por cliente del hash de conjuntos
+static const uint64_t SEMILLA_CLAVES = 0x2f6d1c8b9a3e4057ULL;
+
+PoolRutas::PoolRutas(const InstanciaCompacta& inst, int capacidad)
+    : inst(inst),
+      capacidad(static_cast<size_t>(max(1, capacidad)))
+{}
+
+uint64_t PoolRutas::claveConjunto(const vector<int>& secuencia) const {
+    // Suma de claves por cliente: no depende del orden
+    uint64_t clave = 0;
+    for (int pos : secuencia)
+        clave += GeneradorAleatorio::derivarSemilla(SEMILLA_CLAVES, pos);
+    return clave;
+}
+
+bool PoolRutas::agregar(const vector<int>& secuencia) {
+    if (secuencia.empty())
+        return false;
+    int deposito = inst.getPosDeposito();
+    double costo = 0;
+    int prev = deposito;
+    for (int pos : secuencia) {
+        costo += inst.dist(prev, pos);
+        prev = pos;
+    }
+    costo += inst.dist(prev, deposito);
+
+    ordenado = secuencia;
+    sort(ordenado.begin(), ordenado.end());
+    uint64_t clave = claveConjunto(secuencia);
+    auto it = indicePorClave.find(clave);
+    if (it != indicePorClave.end()) {
+        RutaPool& existente = rutas[it->second];
+        // Una colisión del hash con otro conjunto se descarta
+        if (existente.conjunto != ordenado || costo >= existente.costo - 1e-9)
+            return false;
+        existente.secuencia = secuencia;
+        existente.costo = costo;
+        return true;
+    }
+    if (rutas.size() >= capacidad)
+        return false;
+    indicePorClave.emplace(clave, static_cast<int>(rutas.size()));
+    rutas.push_back({ordenado, secuencia, costo});
+    return true;
+}
+
+void PoolRutas::agregarRutas(const vector<vector<int>>& rutasSolucion) {
+    for (const vector<int>& ruta : rutasSolucion)
+        agregar(ruta);
+}
+
+void PoolRutas::vaciar() {
+    rutas.clear();
+    indicePorClave.clear();
+}
+
+int PoolRutas::getTamano() const { return static_cast<int>(rutas.size()); }
+
+const vector<int>& PoolRutas::getConjunto(int i) const { return rutas[i].conjunto; }
+
+const vector<int>& PoolRutas::getSecuencia(int i) const { return rutas[i].secuencia; }
+
+double PoolRutas::getCosto(int i) const { return rutas[i].costo; }
@@ -0,0 +1,47 @@
+#ifndef POOL_RUTAS_H
+#define POOL_RUTAS_H
+
+#include "InstanciaCompacta.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// Rutas distintas vistas a lo largo de una corrida. Dos rutas con el mismo
+// conjunto de clientes son la misma columna: se guarda la secuencia más
+// barata. Es la entrada de ParticionConjuntos.
+class PoolRutas {
+private:
+    struct RutaPool {
+        vector<int> conjunto;   // posiciones ordenadas
+        vector<int> secuencia;
+        double costo;
+    };
+
+    const InstanciaCompacta& inst;
+    size_t capacidad;
+    vector<RutaPool> rutas;
+    unordered_map<uint64_t, int> indicePorClave;
+    vector<int> ordenado;
+
+    uint64_t claveConjunto(const vector<int>& secuencia) const;
+
+public:
+    // Al llegar a `capacidad` rutas sólo se aceptan secuencias más baratas
+    // de conjuntos ya guardados
+    PoolRutas(const InstanciaCompacta& inst, int capacidad);
+
+    // Secuencia por posiciones, sin depósitos. Devuelve true si el
+    // conjunto es nuevo o si la secuencia es más barata que la guardada.
+    bool agregar(const vector<int>& secuencia);
+    void agregarRutas(const vector<vector<int>>& rutasSolucion);
+    void vaciar();
+
+    int getTamano() const;
+    const vector<int>& getConjunto(int i) const;
+    const vector<int>& getSecuencia(int i) const;
+    double getCosto(int i) const;
+};
+
+#endif
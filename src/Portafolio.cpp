@@ -0,0 +1,201 @@
+#include "Portafolio.h"
+#include "HeuristicaClarkeWright.h"
+#include "HeuristicaInsercionCercana.h"
+#include "SolucionCompacta.h"
+#include "BusquedaLocalCompacta.h"
+#include "OptimizadorRuta.h"
+#include "PoolHilos.h"
+#include <algorithm>
+#include <exception>
+#include <limits>
+#include <thread>
+
+using namespace std;
+
+// Vecinos granulares de la búsqueda local tras cada construcción
+static const int VECINOS_BUSQUEDA_LOCAL = 20;
+
+// Iteraciones de GRASP cuando no hay límite de tiempo ni se indicaron
+static const int ITERACIONES_GRASP_POR_DEFECTO = 100;
+
+// Hilos que ocupan las construcciones (C&W e Inserción Más Cercana)
+static const int HILOS_CONSTRUCTORES = 2;
+
+Portafolio::Portafolio(
+    const vector<Cliente>& clientes,
+    const vector<vector<double>>& distMatrix,
+    const unordered_map<int, int>& id2pos,
+    int capacidadVehiculo,
+    int depotId,
+    int numVehiculos,
+    uint64_t semilla)
+    : Portafolio(make_shared<const InstanciaCompacta>(clientes, distMatrix, id2pos,
+                                                      capacidadVehiculo, depotId, numVehiculos),
+                 semilla)
+{}
+
+Portafolio::Portafolio(shared_ptr<const InstanciaCompacta> compartida, uint64_t semilla)
+    : clientes(compartida->getClientes()),
+      capacidadVehiculo(compartida->getCapacidad()),
+      depotId(compartida->getDepotId()),
+      numVehiculos(compartida->getNumVehiculos()),
+      semilla(semilla),
+      instancia(move(compartida)),
+      inst(*instancia),
+      vecinos(inst.getDistancias(), VECINOS_BUSQUEDA_LOCAL),
+      numHilos(0),
+      iteracionesGRASP(0),
+      kRCL(3),
+      mejorCosto(numeric_limits<double>::max())
+{}
+
+void Portafolio::publicar(const Solucion& sol, const string& nombre) {
+    if (!sol.esFactible() || !sol.vistoTodos())
+        return;
+    double costo = sol.getCostoTotal();
+    if (costo >= mejorCosto.load(memory_order_relaxed))
+        return;
+
+    lock_guard<mutex> lk(mtxMejor);
+    if (costo >= mejorCosto.load(memory_order_relaxed))
+        return;
+    mejorSol.reset(new Solucion(sol));
+    mejorCosto.store(costo);
+    ganador = nombre;
+    if (alMejorar)
+        alMejorar(*mejorSol, control.segundos());
+    if (control.objetivoAlcanzado(costo))
+        detener();
+}
+
+Solucion Portafolio::construir(const string& nombre) {
+    if (nombre == "cw") {
+        HeuristicaClarkeWright cw(clientes, inst.getIdDistancias(), capacidadVehiculo,
+                                  depotId, numVehiculos);
+        cw.setControlParada(&control);
+        return cw.resolver();
+    }
+    HeuristicaInsercionCercana ni(clientes, inst.getIdDistancias(), capacidadVehiculo,
+                                  depotId, numVehiculos);
+    ni.setControlParada(&control);
+    return ni.resolver();
+}
+
+void Portafolio::correrConstructor(const string& nombre, Resultado& resultado) {
+    Solucion construida = construir(nombre);
+    publicar(construida, nombre);
+    if (control.debeDetenerse())
+        return;
+
+    SolucionCompacta sol(inst, inst.rutasDesde(construida));
+    sol.eliminarRutasVacias();
+    sol.completar();
+    BusquedaLocalCompacta busqueda(inst, vecinos);
+    busqueda.setControlParada(&control);
+    busqueda.mejorar(sol);
+    if (!control.debeDetenerse()) {
+        OptimizadorRuta optimizador(inst);
+        optimizador.optimizar(sol);
+    }
+    sol.eliminarRutasVacias();
+    Solucion mejorada = sol.aSolucion();
+    publicar(mejorada, nombre);
+
+    if (mejorada.esFactible() && mejorada.vistoTodos())
+        resultado.costo = mejorada.getCostoTotal();
+    else if (construida.esFactible() && construida.vistoTodos())
+        resultado.costo = construida.getCostoTotal();
+}
+
+void Portafolio::correrGRASP(int hilos, Resultado& resultado) {
+    CriterioParada criterio;
+    criterio.limiteTiempo = control.getCriterio().limiteTiempo;
+    criterio.costoObjetivo = control.getCriterio().costoObjetivo;
+    criterio.brechaObjetivo = control.getCriterio().brechaObjetivo;
+    criterio.cotaInferior = control.getCriterio().cotaInferior;
+    int iteraciones = iteracionesGRASP > 0 ? iteracionesGRASP
+                    : criterio.limiteTiempo > 0 ? 0
+                    : ITERACIONES_GRASP_POR_DEFECTO;
+
+    GRASP grasp(instancia, nullptr, iteraciones, kRCL, semilla);
+    grasp.setNumHilos(hilos);
+    grasp.setCriterioParada(criterio);
+    grasp.setAlMejorar([this](const Solucion& sol, double) { publicar(sol, "grasp"); });
+    grasp.setControlExterno(&control);
+    Solucion sol = grasp.resolver();
+    if (sol.esFactible() && sol.vistoTodos())
+        resultado.costo = sol.getCostoTotal();
+}
+
+Solucion Portafolio::resolver() {
+    control.reiniciar();
+    mejorCosto.store(numeric_limits<double>::max());
+    mejorSol.reset();
+    ganador.clear();
+
+    resultados.clear();
+    for (const char* nombre : {"cw", "ni", "grasp"})
+        resultados.push_back({nombre, -1.0, 0.0, false});
+
+    int hilos = numHilos > 0 ? numHilos : PoolHilos::hilosDisponibles();
+    int hilosGRASP = max(1, hilos - HILOS_CONSTRUCTORES);
+
+    vector<exception_ptr> errores(resultados.size());
+    vector<thread> participantes;
+    for (size_t i = 0; i < resultados.size(); ++i) {
+        participantes.emplace_back([this, i, hilosGRASP, &errores]() {
+            Resultado& resultado = resultados[i];
+            try {
+                if (resultado.nombre == "grasp")
+                    correrGRASP(hilosGRASP, resultado);
+                else
+                    correrConstructor(resultado.nombre, resultado);
+            } catch (...) {
+                errores[i] = current_exception();
+                detener();
+            }
+            resultado.segundos = control.segundos();
+            resultado.cancelado = control.debeDetenerse();
+        });
+    }
+    for (thread& t : participantes)
+        t.join();
+
+    for (const exception_ptr& e : errores) {
+        if (e)
+            rethrow_exception(e);
+    }
+    lock_guard<mutex> lk(mtxMejor);
+    if (!mejorSol)
+        return Solucion(clientes, inst.getIdDistancias(), numVehiculos);
+    return *mejorSol;
+}
+
+void Portafolio::setNumHilos(int hilos) { numHilos = hilos; }
+
+void Portafolio::setGRASP(int iteraciones, int k) {
+    iteracionesGRASP = iteraciones;
+    if (k > 0)
+        kRCL = k;
+}
+
+void Portafolio::setCriterioParada(const CriterioParada& criterio) {
+    control.setCriterio(criterio);
+}
+
+void Portafolio::setAlMejorar(function<void(const Solucion&, double)> callback) {
+    alMejorar = move(callback);
+}
+
+void Portafolio::detener() { control.detener(); }
+
+double Portafolio::getMejorCosto() const { return mejorCosto.load(); }
+
+string Portafolio::getGanador() {
+    lock_guard<mutex> lk(mtxMejor);
+    return ganador;
+}
+
+const vector<Portafolio::Resultado>& Portafolio::getResultados() const { return resultados; }
+
+uint64_t Portafolio::getSemilla() const { return semilla; }
@@ -0,0 +1,102 @@
+#ifndef PORTAFOLIO_H
+#define PORTAFOLIO_H
+
+#include "Cliente.h"
+#include "Solucion.h"
+#include "InstanciaCompacta.h"
+#include "ListaVecinos.h"
+#include "GRASP.h"
+#include "CriterioParada.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// Modo portafolio: corre a la vez Clarke & Wright y Inserción Más Cercana
+// (cada una seguida de búsqueda local) y GRASP, cada una en su hilo, con
+// una mejor solución compartida. Al alcanzar el costo objetivo o el límite
+// de tiempo se detiene a todas de forma cooperativa: las construcciones y
+// la búsqueda local revisan el mismo ControlParada dentro de sus bucles, y
+// GRASP lo tiene como control externo (un pedido de detención no se pierde
+// aunque llegue antes de que GRASP arranque).
+class Portafolio {
+public:
+    struct Resultado {
+        string nombre;
+        double costo;      // < 0: no llegó a una solución factible
+        double segundos;   // al terminar
+        bool cancelado;    // la cortó el objetivo, el tiempo o detener()
+    };
+
+private:
+    const vector<Cliente>& clientes;
+    int capacidadVehiculo;
+    int depotId;
+    int numVehiculos;
+    uint64_t semilla;
+
+    // Propia o compartida; GRASP corre sobre la misma (sólo se lee)
+    shared_ptr<const InstanciaCompacta> instancia;
+    const InstanciaCompacta& inst;
+    ListaVecinos vecinos;
+    int numHilos;
+    int iteracionesGRASP;
+    int kRCL;
+
+    ControlParada control;
+    function<void(const Solucion&, double)> alMejorar;
+
+    // Mejor solución compartida; el costo se consulta sin lock
+    mutex mtxMejor;
+    atomic<double> mejorCosto;
+    unique_ptr<Solucion> mejorSol;
+    string ganador;
+
+    vector<Resultado> resultados;
+
+    Solucion construir(const string& nombre);
+    void correrConstructor(const string& nombre, Resultado& resultado);
+    void correrGRASP(int hilos, Resultado& resultado);
+    void publicar(const Solucion& sol, const string& nombre);
+
+public:
+    Portafolio(const vector<Cliente>& clientes,
+               const vector<vector<double>>& distMatrix,
+               const unordered_map<int, int>& id2pos,
+               int capacidadVehiculo,
+               int depotId,
+               int numVehiculos,
+               uint64_t semilla = 0);
+    // Sobre una instancia ya armada, con cualquier proveedor de distancias
+    Portafolio(shared_ptr<const InstanciaCompacta> instancia, uint64_t semilla = 0);
+
+    // Termina cuando terminan todas o al cortar por objetivo o tiempo
+    Solucion resolver();
+
+    // Hilos en total (<= 0: todos los núcleos); GRASP usa los que dejan
+    // libres las construcciones, al menos uno
+    void setNumHilos(int hilos);
+    // Iteraciones de GRASP (<= 0: sin límite si hay límite de tiempo, si
+    // no 100) y tamaño de su RCL
+    void setGRASP(int iteraciones, int k);
+    // Se usan el límite de tiempo y el costo objetivo
+    void setCriterioParada(const CriterioParada& criterio);
+    // Se invoca (serializado) cada vez que mejora la mejor compartida
+    void setAlMejorar(function<void(const Solucion&, double)> callback);
+    // Pide cortar la corrida en curso; puede llamarse desde otro hilo
+    void detener();
+
+    double getMejorCosto() const;
+    // Nombre de la que encontró la mejor ("cw", "ni" o "grasp")
+    string getGanador();
+    const vector<Resultado>& getResultados() const;
+    uint64_t getSemilla() const;
+};
+
+#endif
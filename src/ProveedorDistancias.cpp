@@ -0,0 +1,232 @@
+#include "ProveedorDistancias.h"
+#include "DistanceKernels.h"
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+// Copia fuente en un almacenamiento compacto; con triangulo sólo se guarda
+// b >= a y se verifica que la parte de abajo coincida
+template <typename Almacen>
+static shared_ptr<const Almacen> copiarAlmacen(const ProveedorDistancias& fuente, bool triangulo) {
+    const int n = fuente.getCantidad();
+    auto almacen = make_shared<Almacen>(n);
+    const bool verificar = triangulo && !fuente.simetricaPorConstruccion();
+    vector<double> fila(n);
+    for (int a = 0; a < n; ++a) {
+        fuente.fila(a, fila.data());
+        for (int b = triangulo ? a : 0; b < n; ++b)
+            almacen->fijar(a, b, fila[b]);
+        for (int b = 0; verificar && b < a; ++b) {
+            if (fila[b] != fuente(b, a))
+                throw invalid_argument("ProveedorDistancias: el formato triangular exige distancias simétricas");
+        }
+    }
+    return almacen;
+}
+
+template <typename Almacen>
+static shared_ptr<const Almacen> reindexarAlmacen(const Almacen& viejo, const vector<int>& origen, bool triangulo) {
+    const int n = static_cast<int>(origen.size());
+    auto nuevo = make_shared<Almacen>(n);
+    for (int i = 0; i < n; ++i) {
+        if (origen[i] < 0) continue;
+        for (int j = triangulo ? i : 0; j < n; ++j) {
+            if (origen[j] >= 0)
+                nuevo->fijar(i, j, viejo(origen[i], origen[j]));
+        }
+    }
+    return nuevo;
+}
+
+ProveedorDistancias::ProveedorDistancias(const vector<vector<double>>& matriz)
+    : formato(Formato::Densa),
+      filas(matriz.data()),
+      matriz(&matriz),
+      cantidad(static_cast<int>(matriz.size())),
+      redondeo(Redondeo::Ninguno)
+{}
+
+ProveedorDistancias::ProveedorDistancias(shared_ptr<const vector<vector<double>>> matriz)
+    : formato(Formato::Densa),
+      filas(matriz->data()),
+      matrizPropia(move(matriz)),
+      matriz(matrizPropia.get()),
+      cantidad(static_cast<int>(matrizPropia->size())),
+      redondeo(Redondeo::Ninguno)
+{}
+
+ProveedorDistancias::ProveedorDistancias(vector<double> xs, vector<double> ys, Redondeo redondeo)
+    : formato(Formato::Coordenadas),
+      filas(nullptr),
+      matriz(nullptr),
+      cantidad(static_cast<int>(xs.size())),
+      xs(move(xs)),
+      ys(move(ys)),
+      redondeo(redondeo)
+{
+    if (this->ys.size() != this->xs.size())
+        throw invalid_argument("ProveedorDistancias: xs e ys de distinto largo");
+}
+
+ProveedorDistancias::ProveedorDistancias(shared_ptr<const double> bloque, int cantidad)
+    : formato(Formato::Externa),
+      filas(nullptr),
+      matriz(nullptr),
+      cantidad(cantidad),
+      redondeo(Redondeo::Ninguno),
+      externa(make_shared<const VistaCompleta>(move(bloque), cantidad, 0, cantidad))
+{}
+
+ProveedorDistancias::ProveedorDistancias(const ProveedorDistancias& fuente, Formato formato)
+    : formato(formato),
+      filas(nullptr),
+      matriz(nullptr),
+      cantidad(fuente.cantidad),
+      redondeo(Redondeo::Ninguno)
+{
+    switch (formato) {
+        case Formato::Densa: {
+            auto nueva = make_shared<vector<vector<double>>>(cantidad, vector<double>(cantidad));
+            for (int a = 0; a < cantidad; ++a)
+                fuente.fila(a, (*nueva)[a].data());
+            matrizPropia = move(nueva);
+            matriz = matrizPropia.get();
+            filas = matriz->data();
+            break;
+        }
+        case Formato::Simple:
+            simple = copiarAlmacen<AlmacenCompleto<float>>(fuente, false);
+            break;
+        case Formato::Triangular:
+            triangular = copiarAlmacen<AlmacenTriangular<double>>(fuente, true);
+            break;
+        case Formato::TriangularSimple:
+            triangularSimple = copiarAlmacen<AlmacenTriangular<float>>(fuente, true);
+            break;
+        case Formato::Coordenadas:
+            throw invalid_argument("ProveedorDistancias: no se puede pasar una matriz a coordenadas");
+        case Formato::Externa:
+            throw invalid_argument("ProveedorDistancias: no hay un bloque externo al que copiar");
+    }
+}
+
+void ProveedorDistancias::fila(int a, double* salida) const {
+    if (filas) {
+        copy(filas[a].begin(), filas[a].end(), salida);
+        return;
+    }
+    if (formato != Formato::Coordenadas) {
+        conAlmacen([&](const auto& dist) {
+            for (int b = 0; b < cantidad; ++b)
+                salida[b] = dist(a, b);
+        });
+        return;
+    }
+    static const EuclideanRowKernel kernel = selectEuclideanRowKernel();
+    kernel(xs[a], ys[a], xs.data(), ys.data(), salida, xs.size());
+    if (redondeo == Redondeo::HaciaArriba) {
+        for (int j = 0; j < cantidad; ++j)
+            salida[j] = ceil(salida[j]);
+    }
+}
+
+shared_ptr<const ProveedorDistancias> ProveedorDistancias::reindexar(const vector<int>& origen) const {
+    const size_t n = origen.size();
+    if (filas) {
+        auto nueva = make_shared<vector<vector<double>>>(n, vector<double>(n, 0.0));
+        for (size_t i = 0; i < n; ++i) {
+            if (origen[i] < 0) continue;
+            const vector<double>& viejaFila = filas[origen[i]];
+            vector<double>& nuevaFila = (*nueva)[i];
+            for (size_t j = 0; j < n; ++j) {
+                if (origen[j] >= 0)
+                    nuevaFila[j] = viejaFila[origen[j]];
+            }
+        }
+        return make_shared<const ProveedorDistancias>(shared_ptr<const vector<vector<double>>>(move(nueva)));
+    }
+    if (externa) {
+        // Si los índices usados son consecutivos en el bloque alcanza con
+        // correr el tramo visto; si no, se copia en una matriz densa
+        int corrimiento = 0;
+        bool consecutivos = true, primero = true;
+        for (size_t i = 0; i < n && consecutivos; ++i) {
+            if (origen[i] < 0) continue;
+            if (primero)
+                corrimiento = origen[i] - static_cast<int>(i);
+            consecutivos = origen[i] - static_cast<int>(i) == corrimiento;
+            primero = false;
+        }
+        int inicio = externa->getPrimero() + corrimiento;
+        if (consecutivos && inicio >= 0 && inicio + static_cast<int>(n) <= externa->getAncho()) {
+            auto nuevo = make_shared<ProveedorDistancias>(*this);
+            nuevo->cantidad = static_cast<int>(n);
+            nuevo->externa = make_shared<const VistaCompleta>(
+                externa->getBloque(), externa->getAncho(), inicio, static_cast<int>(n));
+            return nuevo;
+        }
+        auto nueva = make_shared<vector<vector<double>>>(n, vector<double>(n, 0.0));
+        for (size_t i = 0; i < n; ++i) {
+            if (origen[i] < 0) continue;
+            for (size_t j = 0; j < n; ++j) {
+                if (origen[j] >= 0)
+                    (*nueva)[i][j] = (*externa)(origen[i], origen[j]);
+            }
+        }
+        return make_shared<const ProveedorDistancias>(shared_ptr<const vector<vector<double>>>(move(nueva)));
+    }
+    if (formato != Formato::Coordenadas) {
+        auto nuevo = make_shared<ProveedorDistancias>(vector<double>(), vector<double>());
+        nuevo->formato = formato;
+        nuevo->cantidad = static_cast<int>(n);
+        if (simple)
+            nuevo->simple = reindexarAlmacen(*simple, origen, false);
+        if (triangular)
+            nuevo->triangular = reindexarAlmacen(*triangular, origen, true);
+        if (triangularSimple)
+            nuevo->triangularSimple = reindexarAlmacen(*triangularSimple, origen, true);
+        return nuevo;
+    }
+    vector<double> nuevasX(n, 0.0), nuevasY(n, 0.0);
+    for (size_t i = 0; i < n; ++i) {
+        if (origen[i] < 0) continue;
+        nuevasX[i] = xs[origen[i]];
+        nuevasY[i] = ys[origen[i]];
+    }
+    return make_shared<const ProveedorDistancias>(move(nuevasX), move(nuevasY), redondeo);
+}
+
+int ProveedorDistancias::getCantidad() const { return cantidad; }
+
+ProveedorDistancias::Formato ProveedorDistancias::getFormato() const { return formato; }
+
+bool ProveedorDistancias::esDensa() const { return filas != nullptr; }
+
+bool ProveedorDistancias::tieneCoordenadas() const { return formato == Formato::Coordenadas; }
+
+bool ProveedorDistancias::simetricaPorConstruccion() const {
+    return formato == Formato::Coordenadas || formato == Formato::Triangular
+        || formato == Formato::TriangularSimple;
+}
+
+size_t ProveedorDistancias::getBytes() const {
+    switch (formato) {
+        case Formato::Densa: return static_cast<size_t>(cantidad) * cantidad * sizeof(double);
+        case Formato::Simple: return simple->getBytes();
+        case Formato::Triangular: return triangular->getBytes();
+        case Formato::TriangularSimple: return triangularSimple->getBytes();
+        case Formato::Externa: return externa->getBytes();
+        default: return (xs.size() + ys.size()) * sizeof(double);
+    }
+}
+
+const vector<vector<double>>& ProveedorDistancias::getMatriz() const {
+    if (!matriz)
+        throw logic_error("ProveedorDistancias: no hay matriz densa en este formato");
+    return *matriz;
+}
+
+const vector<double>& ProveedorDistancias::getX() const { return xs; }
+
+const vector<double>& ProveedorDistancias::getY() const { return ys; }
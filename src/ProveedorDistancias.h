@@ -0,0 +1,126 @@
+#ifndef PROVEEDOR_DISTANCIAS_H
+#define PROVEEDOR_DISTANCIAS_H
+
+#include "AlmacenDistancias.h"
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+// Distancias entre índices 0..cantidad-1, sea desde una matriz densa,
+// calculadas al vuelo desde coordenadas o desde un almacenamiento compacto
+// (AlmacenDistancias.h). El modo por coordenadas guarda x e y en arreglos
+// separados (O(n) de memoria en lugar de O(n^2)) y da los mismos valores,
+// bit a bit, que la matriz EUC_2D/CEIL_2D del lector. Es de sólo lectura y
+// se comparte entre hilos; las filas calientes se cachean aparte, por
+// consumidor (CacheFilas).
+class ProveedorDistancias {
+public:
+    enum class Redondeo { Ninguno, HaciaArriba };
+
+    // Densa: vector<vector<double>>. Simple: matriz completa en float.
+    // Triangular: triángulo superior en double (exige simetría).
+    // TriangularSimple: triángulo superior en float. Externa: matriz
+    // completa en double dentro de un bloque ajeno, sin copiar (VistaCompleta).
+    enum class Formato { Densa, Coordenadas, Simple, Triangular, TriangularSimple, Externa };
+
+    // Acceso del modo denso para conAlmacen
+    struct FilasDensas {
+        const vector<double>* filas;
+        double operator()(int a, int b) const { return filas[a][b]; }
+    };
+
+private:
+    Formato formato;
+    // Modo denso: filas de la matriz; nullptr en los demás
+    const vector<double>* filas;
+    shared_ptr<const vector<vector<double>>> matrizPropia;
+    const vector<vector<double>>* matriz;
+    int cantidad;
+
+    vector<double> xs;
+    vector<double> ys;
+    Redondeo redondeo;
+
+    shared_ptr<const AlmacenCompleto<float>> simple;
+    shared_ptr<const AlmacenTriangular<double>> triangular;
+    shared_ptr<const AlmacenTriangular<float>> triangularSimple;
+    shared_ptr<const VistaCompleta> externa;
+
+    double calcular(int a, int b) const {
+        switch (formato) {
+            case Formato::Simple: return (*simple)(a, b);
+            case Formato::Triangular: return (*triangular)(a, b);
+            case Formato::TriangularSimple: return (*triangularSimple)(a, b);
+            case Formato::Externa: return (*externa)(a, b);
+            default: break;
+        }
+        double dx = xs[a] - xs[b];
+        double dy = ys[a] - ys[b];
+        double d = sqrt(dx * dx + dy * dy);
+        return redondeo == Redondeo::HaciaArriba ? ceil(d) : d;
+    }
+
+public:
+    // Sin copiar: la matriz debe sobrevivir al proveedor
+    explicit ProveedorDistancias(const vector<vector<double>>& matriz);
+    // Comparte la matriz con quien la haya creado
+    explicit ProveedorDistancias(shared_ptr<const vector<vector<double>>> matriz);
+    // Distancia euclídea entre (xs[a], ys[a]) y (xs[b], ys[b])
+    ProveedorDistancias(vector<double> xs, vector<double> ys, Redondeo redondeo = Redondeo::Ninguno);
+    // Matriz de cantidad x cantidad, fila por fila, en un bloque ajeno (por
+    // ejemplo, VRPLIBReader::getMappedDistances); no se copia y `bloque` la
+    // mantiene viva
+    ProveedorDistancias(shared_ptr<const double> bloque, int cantidad);
+    // Copia de fuente en otro formato (no Coordenadas). Los triangulares
+    // lanzan invalid_argument si fuente no es simétrica; Externa también
+    // lanza (no hay bloque ajeno al que copiar).
+    ProveedorDistancias(const ProveedorDistancias& fuente, Formato formato);
+
+    double operator()(int a, int b) const { return filas ? filas[a][b] : calcular(a, b); }
+
+    // Llama a f con el acceso concreto del formato (FilasDensas, un
+    // AlmacenCompleto/AlmacenTriangular, una VistaCompleta o, por
+    // coordenadas, el propio proveedor): el bucle de f se compila una vez
+    // por formato y no decide nada por cada distancia.
+    template <typename F>
+    decltype(auto) conAlmacen(F&& f) const {
+        switch (formato) {
+            case Formato::Densa: return f(FilasDensas{filas});
+            case Formato::Simple: return f(*simple);
+            case Formato::Triangular: return f(*triangular);
+            case Formato::TriangularSimple: return f(*triangularSimple);
+            case Formato::Externa: return f(*externa);
+            default: return f(*this);
+        }
+    }
+
+    // Copia la fila a en salida[0..cantidad-1] (por coordenadas, con el
+    // kernel SIMD de DistanceKernels)
+    void fila(int a, double* salida) const;
+
+    // El mismo proveedor con índices nuevos: el índice i pasa a ser el
+    // viejo origen[i]. Con origen[i] = -1 el índice queda sin uso y sus
+    // distancias no significan nada (0 salvo por coordenadas). En formato
+    // Externa, si los índices usados son un tramo contiguo del bloque, el
+    // resultado es otra vista sobre el mismo bloque, sin copiar nada.
+    shared_ptr<const ProveedorDistancias> reindexar(const vector<int>& origen) const;
+
+    int getCantidad() const;
+    Formato getFormato() const;
+    bool esDensa() const;
+    bool tieneCoordenadas() const;
+    // Verdadero si el formato no puede guardar distancias asimétricas
+    bool simetricaPorConstruccion() const;
+    // Memoria aproximada de las distancias guardadas
+    size_t getBytes() const;
+    // Matriz del modo denso; lanza logic_error en los demás
+    const vector<vector<double>>& getMatriz() const;
+    // Coordenadas del modo por coordenadas (vacías en los demás)
+    const vector<double>& getX() const;
+    const vector<double>& getY() const;
+};
+
+#endif
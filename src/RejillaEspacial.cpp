@@ -0,0 +1,115 @@
+#include "RejillaEspacial.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+// Puntos por celda buscados al elegir el lado de la rejilla
+static const double PUNTOS_POR_CELDA = 2.0;
+
+// Margen relativo del radio cubierto, por el redondeo al ubicar puntos
+// justo en el borde de una celda
+static const double MARGEN_RADIO = 1e-9;
+
+RejillaEspacial::RejillaEspacial(const ProveedorDistancias& distancias)
+    : distancias(distancias),
+      minX(0),
+      minY(0),
+      lado(1),
+      columnas(1),
+      filas(1)
+{
+    if (!distancias.tieneCoordenadas())
+        throw invalid_argument("RejillaEspacial: el proveedor no tiene coordenadas");
+    const vector<double>& xs = distancias.getX();
+    const vector<double>& ys = distancias.getY();
+    const int n = distancias.getCantidad();
+    if (n == 0) {
+        inicioCelda.assign(2, 0);
+        return;
+    }
+
+    minX = *min_element(xs.begin(), xs.end());
+    minY = *min_element(ys.begin(), ys.end());
+    double ancho = *max_element(xs.begin(), xs.end()) - minX;
+    double alto = *max_element(ys.begin(), ys.end()) - minY;
+    double celdas = max(1.0, n / PUNTOS_POR_CELDA);
+    // Con puntos casi alineados (alto mucho menor que ancho, o al revés) el
+    // lado de área constante sería diminuto y las columnas, incontables:
+    // nunca más de `celdas` celdas a lo largo del lado mayor
+    if (ancho > 0 || alto > 0)
+        lado = max(sqrt(ancho * alto / celdas), max(ancho, alto) / celdas);
+    columnas = static_cast<int>(ancho / lado) + 1;
+    filas = static_cast<int>(alto / lado) + 1;
+
+    // Ordenamiento por conteo de los puntos según su celda
+    vector<int> celdaDe(n);
+    inicioCelda.assign(static_cast<size_t>(columnas) * filas + 1, 0);
+    for (int i = 0; i < n; ++i) {
+        celdaDe[i] = filaDe(ys[i]) * columnas + columnaDe(xs[i]);
+        inicioCelda[celdaDe[i] + 1]++;
+    }
+    for (size_t c = 1; c < inicioCelda.size(); ++c)
+        inicioCelda[c] += inicioCelda[c - 1];
+    puntos.resize(n);
+    vector<int> siguiente(inicioCelda.begin(), inicioCelda.end() - 1);
+    for (int i = 0; i < n; ++i)
+        puntos[siguiente[celdaDe[i]]++] = i;
+}
+
+int RejillaEspacial::columnaDe(double x) const {
+    return min(columnas - 1, max(0, static_cast<int>((x - minX) / lado)));
+}
+
+int RejillaEspacial::filaDe(double y) const {
+    return min(filas - 1, max(0, static_cast<int>((y - minY) / lado)));
+}
+
+void RejillaEspacial::kCercanos(int pos, int k, vector<int>& salida) const {
+    salida.clear();
+    k = min(k, distancias.getCantidad() - 1);
+    if (k <= 0)
+        return;
+
+    const int cx = columnaDe(distancias.getX()[pos]);
+    const int cy = filaDe(distancias.getY()[pos]);
+    const int maxAnillo = max(columnas, filas);
+    vector<pair<double, int>> candidatos;
+    auto agregarCelda = [&](int x, int y) {
+        if (x < 0 || x >= columnas || y < 0 || y >= filas)
+            return;
+        int celda = y * columnas + x;
+        for (int i = inicioCelda[celda]; i < inicioCelda[celda + 1]; ++i) {
+            if (puntos[i] != pos)
+                candidatos.emplace_back(distancias(pos, puntos[i]), puntos[i]);
+        }
+    };
+
+    for (int anillo = 0; anillo <= maxAnillo; ++anillo) {
+        if (anillo == 0) {
+            agregarCelda(cx, cy);
+        } else {
+            for (int x = cx - anillo; x <= cx + anillo; ++x) {
+                agregarCelda(x, cy - anillo);
+                agregarCelda(x, cy + anillo);
+            }
+            for (int y = cy - anillo + 1; y <= cy + anillo - 1; ++y) {
+                agregarCelda(cx - anillo, y);
+                agregarCelda(cx + anillo, y);
+            }
+        }
+        if (static_cast<int>(candidatos.size()) < k)
+            continue;
+        // Todo punto fuera de los anillos 0..anillo está al menos a
+        // anillo * lado (también con CEIL_2D, que sólo redondea hacia arriba)
+        nth_element(candidatos.begin(), candidatos.begin() + (k - 1), candidatos.end());
+        if (candidatos[k - 1].first < anillo * lado * (1 - MARGEN_RADIO))
+            break;
+    }
+
+    partial_sort(candidatos.begin(), candidatos.begin() + k, candidatos.end());
+    for (int i = 0; i < k; ++i)
+        salida.push_back(candidatos[i].second);
+}
@@ -0,0 +1,37 @@
+#ifndef REJILLA_ESPACIAL_H
+#define REJILLA_ESPACIAL_H
+
+#include "ProveedorDistancias.h"
+#include <vector>
+
+using namespace std;
+
+// Rejilla uniforme sobre las coordenadas de un proveedor por coordenadas,
+// con unos dos puntos por celda. Los k más cercanos de un punto se buscan
+// por anillos de celdas alrededor del suyo hasta que el k-ésimo queda más
+// cerca que cualquier celda sin mirar, así que el resultado es exacto (y el
+// mismo orden que ordenar la fila completa) en O(k) celdas típicas.
+class RejillaEspacial {
+private:
+    const ProveedorDistancias& distancias;
+    double minX;
+    double minY;
+    double lado;
+    int columnas;
+    int filas;
+    vector<int> inicioCelda;  // columnas * filas + 1, índices en puntos
+    vector<int> puntos;       // agrupados por celda
+
+    int columnaDe(double x) const;
+    int filaDe(double y) const;
+
+public:
+    // Requiere coordenadas (lanza invalid_argument con cualquier otro formato)
+    explicit RejillaEspacial(const ProveedorDistancias& distancias);
+
+    // Los k más cercanos a `pos` sin contarlo, por distancia y, a igual
+    // distancia, por índice
+    void kCercanos(int pos, int k, vector<int>& salida) const;
+};
+
+#endif
@@ -13,11 +13,33 @@ Ruta::Ruta(
   const vector<Cliente>& allClientes,
   const vector<int>& clientesIniciales
 )
+: Ruta(capacidad, deposito, make_shared<const vector<vector<double>>>(distMatrix),
+       allClientes, clientesIniciales)
+{}
+
+Ruta::Ruta(
+  int capacidad,
+  int deposito,
+  shared_ptr<const vector<vector<double>>> distMatrix,
+  const vector<Cliente>& allClientes,
+  const vector<int>& clientesIniciales
+)
+: Ruta(capacidad, deposito, make_shared<const ProveedorDistancias>(move(distMatrix)),
+       allClientes, clientesIniciales)
+{}
+
+Ruta::Ruta(
+  int capacidad,
+  int deposito,
+  shared_ptr<const ProveedorDistancias> distancias,
+  const vector<Cliente>& allClientes,
+  const vector<int>& clientesIniciales
+)
 : capacidadMaxima(capacidad),
   demandaActual(0),
   costoTotal(0),
   idDeposito(deposito),
-  distMatrix(distMatrix),
+  distancias(move(distancias)),
   allClientes(allClientes)
 {
   // Si el vector inicial ya contiene el depósito, úsalo tal cual
@@ -103,7 +125,7 @@ void Ruta::eliminarCliente(int cliente) {
 double Ruta::calcularCosto() {
   double costo = 0;
   for (size_t i = 0; i < clientes.size() - 1; i++) {
-    double d = (distMatrix)[clientes[i]][clientes[i+1]];
+    double d = (*distancias)(clientes[i], clientes[i+1]);
     costo += d;
   }
   return costo;
@@ -129,6 +151,8 @@ int Ruta::getDemandaActual() const { return demandaActual; }
 
 int Ruta::getIdDeposito() const { return idDeposito; }
 
-const vector<vector<double>> Ruta::getDistMatrix() const { return distMatrix; }
+const vector<vector<double>> Ruta::getDistMatrix() const { return distancias->getMatriz(); }
+
+const shared_ptr<const ProveedorDistancias>& Ruta::getDistancias() const { return distancias; }
 
 const vector<Cliente> Ruta::getAllClientes() const { return allClientes; }
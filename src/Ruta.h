@@ -1,8 +1,10 @@
 #ifndef RUTA_H
 #define RUTA_H
 
+#include <memory>
 #include <vector>
 #include "Cliente.h"
+#include "ProveedorDistancias.h"
 
 using namespace std;
 
@@ -13,12 +15,16 @@ private:
     int demandaActual;
     double costoTotal;
     int idDeposito;
-    vector<vector<double>> distMatrix;
+    shared_ptr<const ProveedorDistancias> distancias;  // compartidas entre copias
     vector<Cliente> allClientes;
 
 public:
     // Constructor básico
     Ruta(int capacidad, int deposito, const vector<vector<double>>& distMatrix, const vector<Cliente>& allClientes, const vector<int> &clientesIniciales = {});
+    // Igual, pero comparte la matriz en vez de copiarla
+    Ruta(int capacidad, int deposito, shared_ptr<const vector<vector<double>>> distMatrix, const vector<Cliente>& allClientes, const vector<int> &clientesIniciales = {});
+    // Con distancias por ID de cualquier proveedor (por ejemplo, sin matriz)
+    Ruta(int capacidad, int deposito, shared_ptr<const ProveedorDistancias> distancias, const vector<Cliente>& allClientes, const vector<int> &clientesIniciales = {});
     
     // Métodos de modificación
     void agregarCliente(int cliente);
@@ -35,6 +41,7 @@ public:
     int getDemandaActual() const;
     int getIdDeposito() const;
     const vector<vector<double>> getDistMatrix() const;
+    const shared_ptr<const ProveedorDistancias>& getDistancias() const;
     const vector<Cliente> getAllClientes() const;
     
     // Operador de igualdad
@@ -0,0 +1,333 @@
+#include "SISR.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+
+// Largo de las listas de vecinos que recorre la ruina
+static const int VECINOS_RUINA = 100;
+
+// Iteraciones por cliente cuando no hay otro límite
+static const int ITERACIONES_POR_CLIENTE = 100;
+
+// En un tramo partido, probabilidad de preservar un cliente más
+static const double PROBABILIDAD_PRESERVAR = 0.5;
+
+// Temperaturas automáticas, relativas a la distancia media al depósito
+static const double TEMPERATURA_INICIAL_RELATIVA = 0.2;
+static const double COCIENTE_TEMPERATURA_FINAL = 0.01;
+
+// Penalización por ruta de más, relativa a la mayor distancia al depósito
+static const double PENALIZACION_RUTA_RELATIVA = 10.0;
+
+SISR::SISR(
+    const vector<Cliente>& clientes,
+    const vector<vector<double>>& distMatrix,
+    const unordered_map<int, int>& id2pos,
+    int capacidadVehiculo,
+    int depotId,
+    int numVehiculos,
+    uint64_t semilla)
+    : SISR(clientes, make_shared<const ProveedorDistancias>(distMatrix), id2pos,
+           capacidadVehiculo, depotId, numVehiculos, semilla)
+{}
+
+SISR::SISR(
+    const vector<Cliente>& clientes,
+    shared_ptr<const ProveedorDistancias> distancias,
+    const unordered_map<int, int>& id2pos,
+    int capacidadVehiculo,
+    int depotId,
+    int numVehiculos,
+    uint64_t semilla)
+    : SISR(make_shared<const InstanciaCompacta>(clientes, move(distancias), id2pos,
+                                                capacidadVehiculo, depotId, numVehiculos),
+           semilla)
+{}
+
+SISR::SISR(shared_ptr<const InstanciaCompacta> compartida, uint64_t semilla)
+    : clientes(compartida->getClientes()),
+      semilla(semilla),
+      instancia(move(compartida)),
+      inst(*instancia),
+      vecinos(inst.getDistancias(), VECINOS_RUINA),
+      promedioQuitados(10),
+      largoMaximoTramo(10),
+      probabilidadSplit(0.5),
+      probabilidadSalto(0.01),
+      temperaturaInicial(0),
+      temperaturaFinal(0),
+      maxIteraciones(0),
+      mejorCosto(numeric_limits<double>::max()),
+      iteracionesRealizadas(0),
+      penalizacionRuta(0)
+{
+    double maxDeposito = 0;
+    for (int pos : inst.getPosClientes()) {
+        maxDeposito = max(maxDeposito, inst.dist(inst.getPosDeposito(), pos));
+    }
+    penalizacionRuta = PENALIZACION_RUTA_RELATIVA * maxDeposito;
+}
+
+double SISR::costoPenalizado(const SolucionCompacta& sol) const {
+    int exceso = sol.getCantRutasNoVacias() - inst.getNumVehiculos();
+    if (exceso <= 0)
+        return sol.getCosto();
+    return sol.getCosto() + exceso * penalizacionRuta;
+}
+
+void SISR::arruinar(SolucionCompacta& sol, GeneradorAleatorio& rng) {
+    quitados.clear();
+    rutaArruinada.assign(sol.getCantRutas(), 0);
+    const vector<int>& posClientes = inst.getPosClientes();
+    if (posClientes.empty())
+        return;
+
+    int noVacias = max(1, sol.getCantRutasNoVacias());
+    double cardinalidadMedia = static_cast<double>(posClientes.size()) / noVacias;
+    double largoMaximo = min(static_cast<double>(largoMaximoTramo), cardinalidadMedia);
+    double maxTramos = 4 * promedioQuitados / (1 + largoMaximo) - 1;
+    int tramos = static_cast<int>(rng.real01() * maxTramos) + 1;
+
+    int semillaRuina = posClientes[rng.enteroEn(static_cast<int>(posClientes.size()))];
+    const int* lista = vecinos.getVecinos(semillaRuina);
+    int largoLista = vecinos.getCantidadVecinos();
+    int arruinadas = 0;
+    for (int k = -1; k < largoLista && arruinadas < tramos; ++k) {
+        int c = k < 0 ? semillaRuina : lista[k];
+        if (!inst.esCliente(c) || sol.getRutaDe(c) < 0)
+            continue;
+        int r = sol.getRutaDe(c);
+        if (rutaArruinada[r])
+            continue;
+
+        int cardinalidad = static_cast<int>(sol.getRuta(r).size());
+        int largoRuta = static_cast<int>(min(static_cast<double>(cardinalidad), largoMaximo));
+        int largo = static_cast<int>(rng.real01() * largoRuta) + 1;
+        if (largo < cardinalidad && rng.real01() < probabilidadSplit)
+            quitarTramoPartido(sol, r, c, largo, rng);
+        else
+            quitarTramo(sol, r, c, largo, rng);
+        rutaArruinada[r] = 1;
+        arruinadas++;
+    }
+}
+
+void SISR::quitarTramo(SolucionCompacta& sol, int r, int c, int largo, GeneradorAleatorio& rng) {
+    int cardinalidad = static_cast<int>(sol.getRuta(r).size());
+    int i = sol.getIndiceEn(c);
+    int desdeMin = max(0, i - largo + 1);
+    int desdeMax = min(i, cardinalidad - largo);
+    int desde = desdeMin + rng.enteroEn(desdeMax - desdeMin + 1);
+    for (int k = desde + largo - 1; k >= desde; --k) {
+        quitados.push_back(sol.getRuta(r)[k]);
+        sol.remover(r, k);
+    }
+}
+
+void SISR::quitarTramoPartido(SolucionCompacta& sol, int r, int c, int largo, GeneradorAleatorio& rng) {
+    // Tramo de largo + m clientes del que se preservan m contiguos
+    int cardinalidad = static_cast<int>(sol.getRuta(r).size());
+    int preservados = 1;
+    while (largo + preservados < cardinalidad && rng.real01() < PROBABILIDAD_PRESERVAR)
+        preservados++;
+    int total = largo + preservados;
+    int i = sol.getIndiceEn(c);
+    int desdeMin = max(0, i - total + 1);
+    int desdeMax = min(i, cardinalidad - total);
+    int desde = desdeMin + rng.enteroEn(desdeMax - desdeMin + 1);
+    int inicioPreservado = desde + rng.enteroEn(largo + 1);
+    for (int k = desde + total - 1; k >= desde; --k) {
+        if (k >= inicioPreservado && k < inicioPreservado + preservados)
+            continue;
+        quitados.push_back(sol.getRuta(r)[k]);
+        sol.remover(r, k);
+    }
+}
+
+void SISR::ordenarQuitados(GeneradorAleatorio& rng) {
+    // Al azar, por demanda, lejanos primero o cercanos primero (4:4:2:1)
+    int orden = rng.enteroEn(11);
+    int deposito = inst.getPosDeposito();
+    if (orden < 4) {
+        shuffle(quitados.begin(), quitados.end(), rng);
+    } else if (orden < 8) {
+        sort(quitados.begin(), quitados.end(), [&](int a, int b) {
+            return inst.getDemanda(a) > inst.getDemanda(b) ||
+                   (inst.getDemanda(a) == inst.getDemanda(b) && a < b);
+        });
+    } else if (orden < 10) {
+        sort(quitados.begin(), quitados.end(), [&](int a, int b) {
+            double da = inst.dist(deposito, a), db = inst.dist(deposito, b);
+            return da > db || (da == db && a < b);
+        });
+    } else {
+        sort(quitados.begin(), quitados.end(), [&](int a, int b) {
+            double da = inst.dist(deposito, a), db = inst.dist(deposito, b);
+            return da < db || (da == db && a < b);
+        });
+    }
+}
+
+void SISR::recrear(SolucionCompacta& sol, GeneradorAleatorio& rng) {
+    ordenarQuitados(rng);
+    int capacidad = inst.getCapacidad();
+    for (int c : quitados) {
+        int demanda = inst.getDemanda(c);
+        int mejorRuta = -1, mejorIndice = 0;
+        double mejorDelta = numeric_limits<double>::max();
+        bool vaciaProbada = false;
+        for (int r = 0; r < sol.getCantRutas(); ++r) {
+            const vector<int>& ruta = sol.getRuta(r);
+            if (ruta.empty()) {
+                // Todas las rutas vacías son equivalentes: alcanza con una
+                if (vaciaProbada)
+                    continue;
+                vaciaProbada = true;
+            }
+            if (sol.getCarga(r) + demanda > capacidad)
+                continue;
+            int largo = static_cast<int>(ruta.size());
+            for (int i = 0; i <= largo; ++i) {
+                if (rng.real01() < probabilidadSalto)
+                    continue;
+                double delta = sol.deltaInsertar(r, i, c);
+                if (delta < mejorDelta) {
+                    mejorDelta = delta;
+                    mejorRuta = r;
+                    mejorIndice = i;
+                }
+            }
+        }
+        // Sin lugar en la flota: una ruta de más, penalizada en la aceptación
+        if (mejorRuta < 0) {
+            mejorRuta = sol.agregarRutaVacia();
+            mejorIndice = 0;
+        }
+        sol.insertar(mejorRuta, mejorIndice, c);
+    }
+    quitados.clear();
+}
+
+Solucion SISR::resolver() {
+    control.reiniciar();
+    iteracionesRealizadas = 0;
+
+    GeneradorAleatorio rng(semilla);
+    SolucionCompacta actual(inst);
+    if (solucionInicial) {
+        actual = SolucionCompacta(inst, inst.rutasDesde(*solucionInicial));
+        actual.eliminarRutasVacias();
+        actual.completar();
+    } else {
+        // Recreación completa desde la flota vacía
+        while (actual.getCantRutas() < inst.getNumVehiculos())
+            actual.agregarRutaVacia();
+        quitados = inst.getPosClientes();
+        recrear(actual, rng);
+        actual.completar();
+    }
+
+    double actualPenalizado = costoPenalizado(actual);
+    bool actualFactible = actual.getCantRutasNoVacias() <= inst.getNumVehiculos();
+    SolucionCompacta mejor = actual;
+    mejorCosto = actualFactible ? actual.getCosto() : numeric_limits<double>::max();
+    if (actualFactible && control.objetivoAlcanzado(mejorCosto))
+        control.detener();
+
+    // Temperaturas
+    double distanciaMedia = 0;
+    for (int pos : inst.getPosClientes()) {
+        distanciaMedia += inst.dist(inst.getPosDeposito(), pos);
+    }
+    distanciaMedia /= max(1, inst.getCantClientes());
+    double t0 = temperaturaInicial > 0 ? temperaturaInicial
+                                       : max(1e-9, TEMPERATURA_INICIAL_RELATIVA * distanciaMedia);
+    double tf = temperaturaFinal > 0 ? temperaturaFinal : t0 * COCIENTE_TEMPERATURA_FINAL;
+
+    double limiteTiempo = control.getCriterio().limiteTiempo;
+    long iteracionesTotales = maxIteraciones;
+    if (iteracionesTotales <= 0 && limiteTiempo <= 0)
+        iteracionesTotales = static_cast<long>(ITERACIONES_POR_CLIENTE) * max(1, inst.getCantClientes());
+
+    long sinMejora = 0;
+    while (!control.debeDetenerse()) {
+        if (iteracionesTotales > 0 && iteracionesRealizadas >= iteracionesTotales)
+            break;
+        double progreso = limiteTiempo > 0
+            ? min(1.0, control.segundos() / limiteTiempo)
+            : static_cast<double>(iteracionesRealizadas) / iteracionesTotales;
+        if (iteracionesTotales > 0 && limiteTiempo > 0)
+            progreso = max(progreso, static_cast<double>(iteracionesRealizadas) / iteracionesTotales);
+        double temperatura = t0 * pow(tf / t0, progreso);
+
+        SolucionCompacta candidata = actual;
+        arruinar(candidata, rng);
+        recrear(candidata, rng);
+        candidata.eliminarRutasVacias();
+        candidata.completar();
+        iteracionesRealizadas++;
+
+        double candidataPenalizado = costoPenalizado(candidata);
+        // Aceptación de recocido: c' < c - T ln U
+        double u = max(rng.real01(), 1e-300);
+        if (candidataPenalizado < actualPenalizado - temperatura * log(u)) {
+            actual = move(candidata);
+            actualPenalizado = candidataPenalizado;
+        }
+
+        bool factible = actual.getCantRutasNoVacias() <= inst.getNumVehiculos();
+        if (factible && actual.getCosto() < mejorCosto - 1e-9) {
+            actual.recalcular();
+            mejor = actual;
+            mejorCosto = actual.getCosto();
+            sinMejora = 0;
+            if (alMejorar)
+                alMejorar(mejor.aSolucion(), control.segundos());
+            if (control.objetivoAlcanzado(mejorCosto))
+                control.detener();
+        } else {
+            sinMejora++;
+            if (control.sinMejoraAgotado(sinMejora))
+                control.detener();
+        }
+    }
+
+    return mejor.aSolucion();
+}
+
+void SISR::setSolucionInicial(const Solucion& sol) {
+    solucionInicial.reset(new Solucion(sol));
+}
+
+void SISR::setRuina(double promedio, int largoMaximo, double split) {
+    promedioQuitados = promedio > 0 ? promedio : 10;
+    largoMaximoTramo = largoMaximo > 0 ? largoMaximo : 10;
+    probabilidadSplit = split;
+}
+
+void SISR::setProbabilidadSalto(double beta) { probabilidadSalto = beta; }
+
+void SISR::setTemperaturas(double inicial, double final) {
+    temperaturaInicial = inicial;
+    temperaturaFinal = final;
+}
+
+void SISR::setMaxIteraciones(long iteraciones) { maxIteraciones = iteraciones; }
+
+void SISR::setCriterioParada(const CriterioParada& criterio) {
+    control.setCriterio(criterio);
+}
+
+void SISR::setAlMejorar(function<void(const Solucion&, double)> callback) {
+    alMejorar = move(callback);
+}
+
+void SISR::detener() { control.detener(); }
+
+double SISR::getMejorCosto() const { return mejorCosto; }
+
+long SISR::getIteracionesRealizadas() const { return iteracionesRealizadas; }
+
+uint64_t SISR::getSemilla() const { return semilla; }
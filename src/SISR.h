@@ -0,0 +1,107 @@
+#ifndef SISR_H
+#define SISR_H
+
+#include "Cliente.h"
+#include "Solucion.h"
+#include "InstanciaCompacta.h"
+#include "SolucionCompacta.h"
+#include "ListaVecinos.h"
+#include "GeneradorAleatorio.h"
+#include "CriterioParada.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// Ruina y recreación al estilo SISR (Slack Induction by String Removals):
+// se sacan tramos de clientes contiguos de rutas cercanas a un cliente
+// semilla y se reinsertan de a uno en la mejor posición, salteando cada
+// posición con una probabilidad chica ("parpadeos"). El resultado se acepta
+// con un criterio de recocido simulado. No hay búsqueda local ni matrices
+// por ruta: cada iteración cuesta O(clientes quitados * clientes).
+class SISR {
+private:
+    const vector<Cliente>& clientes;
+    uint64_t semilla;
+
+    // Propia o compartida con otros solvers (sólo se lee)
+    shared_ptr<const InstanciaCompacta> instancia;
+    const InstanciaCompacta& inst;
+    ListaVecinos vecinos;
+    unique_ptr<Solucion> solucionInicial;
+
+    double promedioQuitados;    // c̄: clientes quitados en promedio
+    int largoMaximoTramo;       // L_max
+    double probabilidadSplit;   // alfa: tramo partido en vez de contiguo
+    double probabilidadSalto;   // beta: parpadeo al recorrer posiciones
+    double temperaturaInicial;
+    double temperaturaFinal;
+    long maxIteraciones;
+
+    ControlParada control;
+    function<void(const Solucion&, double)> alMejorar;
+
+    double mejorCosto;
+    long iteracionesRealizadas;
+
+    // Costo extra por cada ruta por encima de la flota
+    double penalizacionRuta;
+
+    // Memoria de trabajo reutilizada entre iteraciones
+    vector<int> quitados;
+    vector<char> rutaArruinada;
+
+    void arruinar(SolucionCompacta& sol, GeneradorAleatorio& rng);
+    void quitarTramo(SolucionCompacta& sol, int r, int c, int largo, GeneradorAleatorio& rng);
+    void quitarTramoPartido(SolucionCompacta& sol, int r, int c, int largo, GeneradorAleatorio& rng);
+    void recrear(SolucionCompacta& sol, GeneradorAleatorio& rng);
+    void ordenarQuitados(GeneradorAleatorio& rng);
+    double costoPenalizado(const SolucionCompacta& sol) const;
+
+public:
+    SISR(const vector<Cliente>& clientes,
+         const vector<vector<double>>& distMatrix,
+         const unordered_map<int, int>& id2pos,
+         int capacidadVehiculo,
+         int depotId,
+         int numVehiculos,
+         uint64_t semilla = 0);
+    // Igual, con distancias por posición de cualquier proveedor (con uno por
+    // coordenadas no se arma ninguna matriz de n^2)
+    SISR(const vector<Cliente>& clientes,
+         shared_ptr<const ProveedorDistancias> distancias,
+         const unordered_map<int, int>& id2pos,
+         int capacidadVehiculo,
+         int depotId,
+         int numVehiculos,
+         uint64_t semilla = 0);
+    // Sobre una instancia ya armada, que puede compartirse entre varios
+    // solvers
+    SISR(shared_ptr<const InstanciaCompacta> instancia, uint64_t semilla = 0);
+
+    // La temperatura baja de la inicial a la final a lo largo de la corrida
+    // (por tiempo si hay límite de tiempo, si no por iteraciones). Sin
+    // límite de tiempo ni de iteraciones se hacen 100 por cliente. Las
+    // temperaturas <= 0 se escalan con la distancia media al depósito.
+    Solucion resolver();
+
+    // Por defecto se parte de una recreación completa (todos los clientes
+    // quitados), que no depende de heurísticas O(n^3)
+    void setSolucionInicial(const Solucion& sol);
+    void setRuina(double promedioQuitados, int largoMaximoTramo, double probabilidadSplit = 0.5);
+    void setProbabilidadSalto(double beta);
+    void setTemperaturas(double inicial, double final);
+    void setMaxIteraciones(long iteraciones);
+    void setCriterioParada(const CriterioParada& criterio);
+    void setAlMejorar(function<void(const Solucion&, double)> callback);
+    void detener();
+
+    double getMejorCosto() const;
+    long getIteracionesRealizadas() const;
+    uint64_t getSemilla() const;
+};
+
+#endif
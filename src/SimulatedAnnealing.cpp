@@ -0,0 +1,282 @@
+#include "SimulatedAnnealing.h"
+#include "HeuristicaInsercionCercana.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+
+// Cada cuántos movimientos se consultan los criterios de corte
+static const int MOVIMIENTOS_ENTRE_CONTROLES = 1024;
+
+// Movimientos al azar para estimar la temperatura inicial
+static const int MUESTRAS_TEMPERATURA = 200;
+
+// Cada cuántos movimientos aceptados se recalcula el costo desde cero
+static const long ACEPTADOS_ENTRE_RECALCULOS = 1L << 20;
+
+// Tasa de aceptación de movimientos que empeoran al empezar cada ciclo
+static const double ACEPTACION_INICIAL = 0.5;
+
+SimulatedAnnealing::SimulatedAnnealing(
+    const vector<Cliente>& clientes,
+    const vector<vector<double>>& distMatrix,
+    const unordered_map<int, int>& id2pos,
+    int capacidadVehiculo,
+    int depotId,
+    int numVehiculos,
+    uint64_t semilla)
+    : SimulatedAnnealing(make_shared<const InstanciaCompacta>(clientes, distMatrix, id2pos,
+                                                              capacidadVehiculo, depotId,
+                                                              numVehiculos),
+                         semilla)
+{}
+
+SimulatedAnnealing::SimulatedAnnealing(
+    shared_ptr<const InstanciaCompacta> compartida,
+    uint64_t semilla)
+    : clientes(compartida->getClientes()),
+      semilla(semilla),
+      instancia(move(compartida)),
+      inst(*instancia),
+      enfriamiento(Enfriamiento::Geometrico),
+      alfa(0.995),
+      temperaturaInicial(0),
+      temperaturaFinal(0),
+      movimientosPorBloque(0),
+      maxMovimientos(0),
+      mejorCosto(numeric_limits<double>::max()),
+      movimientosRealizados(0),
+      movimientosAceptados(0)
+{}
+
+SolucionCompacta SimulatedAnnealing::construirInicial() const {
+    vector<vector<int>> rutas;
+    if (solucionInicial) {
+        rutas = inst.rutasDesde(*solucionInicial);
+    } else {
+        HeuristicaInsercionCercana ni(clientes, inst.getIdDistancias(), inst.getCapacidad(),
+                                      inst.getDepotId(), inst.getNumVehiculos());
+        rutas = inst.rutasDesde(ni.resolver());
+    }
+    SolucionCompacta sol(inst, rutas);
+    sol.eliminarRutasVacias();
+    sol.completar();
+    return sol;
+}
+
+bool SimulatedAnnealing::sortearMovimiento(const SolucionCompacta& sol, GeneradorAleatorio& rng,
+                                           Movimiento& mov) const {
+    const vector<int>& posClientes = inst.getPosClientes();
+    int n = static_cast<int>(posClientes.size());
+    if (n < 2)
+        return false;
+
+    int capacidad = inst.getCapacidad();
+    int c = posClientes[rng.enteroEn(n)];
+    mov.tipo = rng.enteroEn(3);
+    mov.r1 = sol.getRutaDe(c);
+    mov.i1 = sol.getIndiceEn(c);
+
+    if (mov.tipo == 0) {
+        mov.r2 = rng.enteroEn(sol.getCantRutas());
+        bool mismaRuta = mov.r1 == mov.r2;
+        int largo = static_cast<int>(sol.getRuta(mov.r2).size()) - (mismaRuta ? 1 : 0);
+        mov.i2 = rng.enteroEn(largo + 1);
+        if (mismaRuta && mov.i2 == mov.i1)
+            return false;
+        if (!mismaRuta && sol.getCarga(mov.r2) + inst.getDemanda(c) > capacidad)
+            return false;
+        mov.delta = sol.deltaMover(mov.r1, mov.i1, mov.r2, mov.i2);
+        return true;
+    }
+
+    if (mov.tipo == 1) {
+        int otro = posClientes[rng.enteroEn(n)];
+        if (otro == c)
+            return false;
+        mov.r2 = sol.getRutaDe(otro);
+        mov.i2 = sol.getIndiceEn(otro);
+        if (mov.r1 != mov.r2) {
+            int diferencia = inst.getDemanda(otro) - inst.getDemanda(c);
+            if (sol.getCarga(mov.r1) + diferencia > capacidad ||
+                sol.getCarga(mov.r2) - diferencia > capacidad)
+                return false;
+        }
+        mov.delta = sol.deltaIntercambiar(mov.r1, mov.i1, mov.r2, mov.i2);
+        return true;
+    }
+
+    int largo = static_cast<int>(sol.getRuta(mov.r1).size());
+    if (largo < 2)
+        return false;
+    int j = rng.enteroEn(largo);
+    if (j == mov.i1)
+        return false;
+    mov.r2 = mov.r1;
+    mov.i2 = max(mov.i1, j);
+    mov.i1 = min(mov.i1, j);
+    mov.delta = sol.deltaInvertir(mov.r1, mov.i1, mov.i2);
+    return true;
+}
+
+void SimulatedAnnealing::aplicarMovimiento(SolucionCompacta& sol, const Movimiento& mov) const {
+    if (mov.tipo == 0)
+        sol.mover(mov.r1, mov.i1, mov.r2, mov.i2);
+    else if (mov.tipo == 1)
+        sol.intercambiar(mov.r1, mov.i1, mov.r2, mov.i2);
+    else
+        sol.invertir(mov.r1, mov.i1, mov.i2);
+}
+
+double SimulatedAnnealing::estimarTemperaturaInicial(const SolucionCompacta& sol,
+                                                     GeneradorAleatorio& rng) const {
+    // Temperatura a la que el empeoramiento promedio se acepta con
+    // probabilidad ACEPTACION_INICIAL
+    double suma = 0;
+    int peores = 0;
+    Movimiento mov;
+    for (int m = 0; m < MUESTRAS_TEMPERATURA; ++m) {
+        if (sortearMovimiento(sol, rng, mov) && mov.delta > 0) {
+            suma += mov.delta;
+            peores++;
+        }
+    }
+    if (peores == 0)
+        return 1.0;
+    return (suma / peores) / -log(ACEPTACION_INICIAL);
+}
+
+Solucion SimulatedAnnealing::resolver() {
+    control.reiniciar();
+    movimientosRealizados = 0;
+    movimientosAceptados = 0;
+
+    GeneradorAleatorio rng(semilla);
+    SolucionCompacta actual = construirInicial();
+    mejoresRutas = actual.getRutas();
+    mejorCosto = actual.getCosto();
+    if (control.objetivoAlcanzado(mejorCosto))
+        control.detener();
+
+    double t0 = temperaturaInicial > 0 ? temperaturaInicial : estimarTemperaturaInicial(actual, rng);
+    double tFinal = temperaturaFinal > 0 ? temperaturaFinal : t0 * 1e-4;
+    int porBloque = movimientosPorBloque > 0 ? movimientosPorBloque
+                                             : max(100, 10 * inst.getCantClientes());
+    // Ambos esquemas duran lo mismo: los bloques que tarda el geométrico
+    // en llevar t0 a tFinal
+    long bloquesPorCiclo = max(1L, static_cast<long>(ceil(log(tFinal / t0) / log(alfa))));
+    bool repetirCiclos = control.getCriterio().tieneLimite() || maxMovimientos > 0;
+
+    double temperatura = t0;
+    double objetivo = ACEPTACION_INICIAL;
+    long bloqueEnCiclo = 0;
+    long bloquesSinMejora = 0;
+    bool fin = false;
+    while (!fin) {
+        long peoresPropuestos = 0, peoresAceptados = 0;
+        bool mejoro = false;
+        for (int m = 0; m < porBloque; ++m) {
+            if (maxMovimientos > 0 && movimientosRealizados >= maxMovimientos) {
+                fin = true;
+                break;
+            }
+            if (movimientosRealizados % MOVIMIENTOS_ENTRE_CONTROLES == 0 && control.debeDetenerse()) {
+                fin = true;
+                break;
+            }
+            movimientosRealizados++;
+
+            Movimiento mov;
+            if (!sortearMovimiento(actual, rng, mov))
+                continue;
+            if (mov.delta > 0) {
+                peoresPropuestos++;
+                if (rng.real01() >= exp(-mov.delta / temperatura))
+                    continue;
+                peoresAceptados++;
+            }
+            aplicarMovimiento(actual, mov);
+            if (++movimientosAceptados % ACEPTADOS_ENTRE_RECALCULOS == 0)
+                actual.recalcular();
+
+            if (actual.getCosto() < mejorCosto - 1e-9) {
+                mejorCosto = actual.getCosto();
+                mejoresRutas = actual.getRutas();
+                mejoro = true;
+                if (alMejorar)
+                    alMejorar(SolucionCompacta(inst, mejoresRutas).aSolucion(), control.segundos());
+                if (control.objetivoAlcanzado(mejorCosto))
+                    control.detener();
+            }
+        }
+
+        bloquesSinMejora = mejoro ? 0 : bloquesSinMejora + 1;
+        if (control.sinMejoraAgotado(bloquesSinMejora))
+            break;
+
+        if (enfriamiento == Enfriamiento::Geometrico) {
+            temperatura *= alfa;
+        } else {
+            // La tasa objetivo decae geométricamente; la temperatura se
+            // enfría más rápido si se acepta de más y se calienta si de menos
+            double tasa = peoresPropuestos > 0
+                ? static_cast<double>(peoresAceptados) / peoresPropuestos : 0.0;
+            objetivo *= alfa;
+            temperatura *= tasa > objetivo ? alfa * alfa : 1.0 / alfa;
+        }
+
+        if (++bloqueEnCiclo >= bloquesPorCiclo) {
+            if (!repetirCiclos)
+                break;
+            // Recalentar desde la mejor solución
+            temperatura = t0;
+            objetivo = ACEPTACION_INICIAL;
+            bloqueEnCiclo = 0;
+            actual = SolucionCompacta(inst, mejoresRutas);
+        }
+    }
+
+    return SolucionCompacta(inst, mejoresRutas).aSolucion();
+}
+
+void SimulatedAnnealing::setSolucionInicial(const Solucion& sol) {
+    solucionInicial.reset(new Solucion(sol));
+}
+
+void SimulatedAnnealing::setSemilla(uint64_t nuevaSemilla) { semilla = nuevaSemilla; }
+
+void SimulatedAnnealing::setEnfriamiento(Enfriamiento tipo, double nuevoAlfa) {
+    enfriamiento = tipo;
+    if (nuevoAlfa > 0 && nuevoAlfa < 1)
+        alfa = nuevoAlfa;
+}
+
+void SimulatedAnnealing::setTemperaturas(double inicial, double final) {
+    temperaturaInicial = inicial;
+    temperaturaFinal = final;
+}
+
+void SimulatedAnnealing::setMovimientosPorBloque(int movimientos) { movimientosPorBloque = movimientos; }
+
+void SimulatedAnnealing::setMaxMovimientos(long movimientos) { maxMovimientos = movimientos; }
+
+void SimulatedAnnealing::setCriterioParada(const CriterioParada& criterio) {
+    control.setCriterio(criterio);
+}
+
+void SimulatedAnnealing::setAlMejorar(function<void(const Solucion&, double)> callback) {
+    alMejorar = move(callback);
+}
+
+void SimulatedAnnealing::detener() { control.detener(); }
+
+void SimulatedAnnealing::setControlExterno(const ControlParada* externo) { control.setExterno(externo); }
+
+double SimulatedAnnealing::getMejorCosto() const { return mejorCosto; }
+
+long SimulatedAnnealing::getMovimientosRealizados() const { return movimientosRealizados; }
+
+long SimulatedAnnealing::getMovimientosAceptados() const { return movimientosAceptados; }
+
+uint64_t SimulatedAnnealing::getSemilla() const { return semilla; }
@@ -0,0 +1,104 @@
+#ifndef SIMULATED_ANNEALING_H
+#define SIMULATED_ANNEALING_H
+
+#include "Cliente.h"
+#include "Solucion.h"
+#include "InstanciaCompacta.h"
+#include "SolucionCompacta.h"
+#include "GeneradorAleatorio.h"
+#include "CriterioParada.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// Recocido simulado sobre SolucionCompacta: en cada paso se sortea un único
+// movimiento (relocate, swap o 2-opt dentro de una ruta), se evalúa su delta
+// en O(1) y se acepta con el criterio de Metropolis.
+class SimulatedAnnealing {
+public:
+    enum class Enfriamiento {
+        Geometrico,  // T *= alfa al final de cada bloque
+        Adaptativo   // T se corrige para seguir una tasa de aceptación objetivo
+    };
+
+private:
+    const vector<Cliente>& clientes;
+    uint64_t semilla;
+
+    // Propia o compartida con otros solvers (sólo se lee)
+    shared_ptr<const InstanciaCompacta> instancia;
+    const InstanciaCompacta& inst;
+    unique_ptr<Solucion> solucionInicial;
+
+    Enfriamiento enfriamiento;
+    double alfa;
+    double temperaturaInicial;   // <= 0: se estima con movimientos al azar
+    double temperaturaFinal;     // <= 0: una diezmilésima de la inicial
+    int movimientosPorBloque;    // <= 0: proporcional a la cantidad de clientes
+    long maxMovimientos;         // <= 0: sin límite propio
+
+    ControlParada control;
+    function<void(const Solucion&, double)> alMejorar;
+
+    vector<vector<int>> mejoresRutas;
+    double mejorCosto;
+    long movimientosRealizados;
+    long movimientosAceptados;
+
+    // Un movimiento sorteado, listo para evaluar y aplicar
+    struct Movimiento {
+        int tipo;  // 0: relocate, 1: swap, 2: 2-opt
+        int r1, i1, r2, i2;
+        double delta;
+    };
+
+    bool sortearMovimiento(const SolucionCompacta& sol, GeneradorAleatorio& rng, Movimiento& mov) const;
+    void aplicarMovimiento(SolucionCompacta& sol, const Movimiento& mov) const;
+    double estimarTemperaturaInicial(const SolucionCompacta& sol, GeneradorAleatorio& rng) const;
+    SolucionCompacta construirInicial() const;
+
+public:
+    SimulatedAnnealing(const vector<Cliente>& clientes,
+                       const vector<vector<double>>& distMatrix,
+                       const unordered_map<int, int>& id2pos,
+                       int capacidadVehiculo,
+                       int depotId,
+                       int numVehiculos,
+                       uint64_t semilla = 0);
+    // Sobre una instancia ya armada, con cualquier proveedor de distancias,
+    // que puede compartirse entre varios solvers
+    SimulatedAnnealing(shared_ptr<const InstanciaCompacta> instancia,
+                       uint64_t semilla = 0);
+
+    // Sin criterio de parada recorre un único ciclo de enfriamiento; con
+    // alguno activo, al llegar a la temperatura final recalienta desde la
+    // mejor solución hasta que se cumpla el criterio. Para el corte por
+    // iteraciones sin mejora, una iteración es un bloque de temperatura.
+    Solucion resolver();
+
+    // Por defecto se parte de Inserción Más Cercana
+    void setSolucionInicial(const Solucion& sol);
+    // Cambia la semilla de las próximas corridas
+    void setSemilla(uint64_t nuevaSemilla);
+    void setEnfriamiento(Enfriamiento tipo, double alfa = 0.995);
+    void setTemperaturas(double inicial, double final);
+    void setMovimientosPorBloque(int movimientos);
+    void setMaxMovimientos(long movimientos);
+    void setCriterioParada(const CriterioParada& criterio);
+    void setAlMejorar(function<void(const Solucion&, double)> callback);
+    void detener();
+    // Control de quien contiene a esta corrida: su detención la corta aunque
+    // llegue antes de resolver(), que no la limpia
+    void setControlExterno(const ControlParada* externo);
+
+    double getMejorCosto() const;
+    long getMovimientosRealizados() const;
+    long getMovimientosAceptados() const;
+    uint64_t getSemilla() const;
+};
+
+#endif
@@ -8,11 +8,29 @@ Solucion::Solucion(
   const vector<vector<double>>& distMatrix,
   const int cantCamiones,
   const vector<Ruta>& rutas)
+  : Solucion(clientes, make_shared<const vector<vector<double>>>(distMatrix),
+             cantCamiones, rutas)
+{}
+
+Solucion::Solucion(
+  const vector<Cliente>& clientes,
+  shared_ptr<const vector<vector<double>>> distMatrix,
+  const int cantCamiones,
+  const vector<Ruta>& rutas)
+  : Solucion(clientes, make_shared<const ProveedorDistancias>(move(distMatrix)),
+             cantCamiones, rutas)
+{}
+
+Solucion::Solucion(
+  const vector<Cliente>& clientes,
+  shared_ptr<const ProveedorDistancias> distancias,
+  const int cantCamiones,
+  const vector<Ruta>& rutas)
   : _rutas(rutas),
     _costoTotal(0),
     _cantCamiones(cantCamiones),
     _clientes(clientes),
-    _distMatrix(distMatrix)
+    _distancias(move(distancias))
 {
   for (const auto& ruta : _rutas) {
       _costoTotal += ruta.getCosto();
@@ -48,12 +66,16 @@ double Solucion::getCostoTotal() const { return _costoTotal; }
 
 int Solucion::getCantCamiones() const { return _cantCamiones; }
 
-vector<Ruta> Solucion::getRutas() const { return _rutas; }
+const vector<Ruta> &Solucion::getRutas() const { return _rutas; }
 
 const vector<Cliente> &Solucion::getClientes() const { return _clientes; }
 
 const vector<vector<double>> &Solucion::getDistMatrix() const {
-  return _distMatrix;
+  return _distancias->getMatriz();
+}
+
+const shared_ptr<const ProveedorDistancias> &Solucion::getDistancias() const {
+  return _distancias;
 }
 
 bool Solucion::esFactible() const { return _rutas.size() <= static_cast<size_t>(_cantCamiones); }
@@ -3,6 +3,7 @@
 
 #include "Cliente.h"
 #include "Ruta.h"
+#include <memory>
 #include <vector>
 #include <unordered_set>
 
@@ -14,7 +15,7 @@ private:
   double _costoTotal;
   int _cantCamiones;
   vector<Cliente> _clientes;
-  vector<vector<double>> _distMatrix;
+  shared_ptr<const ProveedorDistancias> _distancias;  // compartidas entre copias
 
 public:
   Solucion(
@@ -23,15 +24,31 @@ public:
     int cantCamiones,
     const vector<Ruta>& rutas = {}
   );
+  // Igual, pero comparte la matriz en vez de copiarla
+  Solucion(
+    const vector<Cliente>& clientes,
+    shared_ptr<const vector<vector<double>>> distMatrix,
+    int cantCamiones,
+    const vector<Ruta>& rutas = {}
+  );
+  // Con distancias por ID de cualquier proveedor (por ejemplo, sin matriz)
+  Solucion(
+    const vector<Cliente>& clientes,
+    shared_ptr<const ProveedorDistancias> distancias,
+    int cantCamiones,
+    const vector<Ruta>& rutas = {}
+  );
 
   double getCostoTotalRounding(const vector<vector<double>>& distMatrixRounded) const;
   bool agregarRuta(const Ruta& ruta);
   bool removerRuta(size_t index);
   double getCostoTotal() const;
   int getCantCamiones() const;
-  vector<Ruta> getRutas() const;
+  const vector<Ruta>& getRutas() const;
   const vector<Cliente>& getClientes() const;
+  // Sólo con distancias densas (si no, logic_error)
   const vector<vector<double>>& getDistMatrix() const;
+  const shared_ptr<const ProveedorDistancias>& getDistancias() const;
   bool esFactible() const;
   bool vistoTodos() const;
 
@@ -0,0 +1,344 @@
+#include "SolucionCompacta.h"
+#include "InsercionCercana.h"
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+SolucionCompacta::SolucionCompacta(const InstanciaCompacta& inst)
+    : inst(&inst),
+      costoTotal(0),
+      rutaDe(inst.getCantPos(), -1),
+      indiceEn(inst.getCantPos(), -1)
+{}
+
+SolucionCompacta::SolucionCompacta(const InstanciaCompacta& inst, const vector<vector<int>>& rutas)
+    : inst(&inst),
+      rutas(rutas),
+      costoTotal(0),
+      rutaDe(inst.getCantPos(), -1),
+      indiceEn(inst.getCantPos(), -1)
+{
+    recalcular();
+}
+
+void SolucionCompacta::cargar(const vector<vector<int>>& nuevasRutas) {
+    rutas.resize(nuevasRutas.size());
+    for (size_t r = 0; r < nuevasRutas.size(); ++r) {
+        rutas[r].assign(nuevasRutas[r].begin(), nuevasRutas[r].end());
+    }
+    recalcular();
+}
+
+void SolucionCompacta::recalcular() {
+    int deposito = inst->getPosDeposito();
+    cargas.assign(rutas.size(), 0);
+    costos.assign(rutas.size(), 0.0);
+    costoTotal = 0;
+    fill(rutaDe.begin(), rutaDe.end(), -1);
+    for (size_t r = 0; r < rutas.size(); ++r) {
+        int prev = deposito;
+        for (size_t i = 0; i < rutas[r].size(); ++i) {
+            int pos = rutas[r][i];
+            cargas[r] += inst->getDemanda(pos);
+            costos[r] += inst->dist(prev, pos);
+            rutaDe[pos] = static_cast<int>(r);
+            indiceEn[pos] = static_cast<int>(i);
+            prev = pos;
+        }
+        if (!rutas[r].empty()) costos[r] += inst->dist(prev, deposito);
+        costoTotal += costos[r];
+    }
+}
+
+void SolucionCompacta::reindexar(int r, int desde) {
+    const vector<int>& ruta = rutas[r];
+    for (size_t i = desde; i < ruta.size(); ++i) {
+        indiceEn[ruta[i]] = static_cast<int>(i);
+    }
+}
+
+const InstanciaCompacta& SolucionCompacta::getInstancia() const { return *inst; }
+
+int SolucionCompacta::getCantRutas() const { return static_cast<int>(rutas.size()); }
+
+int SolucionCompacta::getCantRutasNoVacias() const {
+    int cant = 0;
+    for (const auto& ruta : rutas) {
+        if (!ruta.empty()) cant++;
+    }
+    return cant;
+}
+
+const vector<int>& SolucionCompacta::getRuta(int r) const { return rutas[r]; }
+
+const vector<vector<int>>& SolucionCompacta::getRutas() const { return rutas; }
+
+int SolucionCompacta::getCarga(int r) const { return cargas[r]; }
+
+double SolucionCompacta::getCostoRuta(int r) const { return costos[r]; }
+
+double SolucionCompacta::getCosto() const { return costoTotal; }
+
+int SolucionCompacta::getRutaDe(int pos) const { return rutaDe[pos]; }
+
+int SolucionCompacta::getIndiceEn(int pos) const { return indiceEn[pos]; }
+
+int SolucionCompacta::anterior(int r, int i) const {
+    return i > 0 ? rutas[r][i - 1] : inst->getPosDeposito();
+}
+
+int SolucionCompacta::siguiente(int r, int i) const {
+    return i + 1 < static_cast<int>(rutas[r].size()) ? rutas[r][i + 1] : inst->getPosDeposito();
+}
+
+double SolucionCompacta::deltaRemover(int r, int i) const {
+    int a = anterior(r, i);
+    int b = siguiente(r, i);
+    int pos = rutas[r][i];
+    if (rutas[r].size() == 1) return -costos[r];
+    return inst->dist(a, b) - inst->dist(a, pos) - inst->dist(pos, b);
+}
+
+double SolucionCompacta::deltaInsertar(int r, int i, int pos) const {
+    int deposito = inst->getPosDeposito();
+    int a = i > 0 ? rutas[r][i - 1] : deposito;
+    int b = i < static_cast<int>(rutas[r].size()) ? rutas[r][i] : deposito;
+    return inst->dist(a, pos) + inst->dist(pos, b) - inst->dist(a, b);
+}
+
+int SolucionCompacta::mejorInsercion(int r, int pos, double& deltaMejor) const {
+    const InstanciaCompacta& instancia = *inst;
+    return mejorPosicionInsercion(rutas[r].data(), static_cast<int>(rutas[r].size()), pos,
+                                  instancia.getPosDeposito(),
+                                  [&](int a, int b) { return instancia.dist(a, b); }, deltaMejor);
+}
+
+double SolucionCompacta::deltaMover(int r1, int i1, int r2, int j) const {
+    if (r1 != r2)
+        return deltaRemover(r1, i1) + deltaInsertar(r2, j, rutas[r1][i1]);
+
+    // Misma ruta: los vecinos del hueco se leen salteando el índice i1
+    const vector<int>& ruta = rutas[r1];
+    int largo = static_cast<int>(ruta.size());
+    if (j == i1 || largo < 2) return 0;
+    int deposito = inst->getPosDeposito();
+    int pos = ruta[i1];
+    auto enReducida = [&](int k) {
+        if (k < 0 || k >= largo - 1) return deposito;
+        return k < i1 ? ruta[k] : ruta[k + 1];
+    };
+    int a = enReducida(j - 1);
+    int b = enReducida(j);
+    return deltaRemover(r1, i1) + inst->dist(a, pos) + inst->dist(pos, b) - inst->dist(a, b);
+}
+
+double SolucionCompacta::deltaIntercambiar(int r1, int i1, int r2, int i2) const {
+    if (r1 == r2 && i1 > i2) {
+        swap(i1, i2);
+    }
+    int a = rutas[r1][i1];
+    int b = rutas[r2][i2];
+    int pa = anterior(r1, i1), na = siguiente(r1, i1);
+    int pb = anterior(r2, i2), nb = siguiente(r2, i2);
+    if (r1 == r2 && i1 == i2) return 0;
+    if (r1 == r2 && i2 == i1 + 1) {
+        return inst->dist(pa, b) + inst->dist(b, a) + inst->dist(a, nb)
+             - inst->dist(pa, a) - inst->dist(a, b) - inst->dist(b, nb);
+    }
+    return inst->dist(pa, b) + inst->dist(b, na) + inst->dist(pb, a) + inst->dist(a, nb)
+         - inst->dist(pa, a) - inst->dist(a, na) - inst->dist(pb, b) - inst->dist(b, nb);
+}
+
+double SolucionCompacta::deltaInvertir(int r, int i, int j) const {
+    if (i >= j) return 0;
+    int a = anterior(r, i);
+    int b = siguiente(r, j);
+    const vector<int>& ruta = rutas[r];
+    double delta = inst->dist(a, ruta[j]) + inst->dist(ruta[i], b)
+                 - inst->dist(a, ruta[i]) - inst->dist(ruta[j], b);
+    // Con distancias asimétricas el tramo invertido también cambia de costo
+    if (!inst->esSimetrica()) {
+        for (int k = i; k < j; ++k)
+            delta += inst->dist(ruta[k + 1], ruta[k]) - inst->dist(ruta[k], ruta[k + 1]);
+    }
+    return delta;
+}
+
+void SolucionCompacta::insertar(int r, int i, int pos) {
+    double delta = deltaInsertar(r, i, pos);
+    rutas[r].insert(rutas[r].begin() + i, pos);
+    cargas[r] += inst->getDemanda(pos);
+    costos[r] += delta;
+    costoTotal += delta;
+    rutaDe[pos] = r;
+    reindexar(r, i);
+}
+
+void SolucionCompacta::remover(int r, int i) {
+    double delta = deltaRemover(r, i);
+    int pos = rutas[r][i];
+    rutas[r].erase(rutas[r].begin() + i);
+    cargas[r] -= inst->getDemanda(pos);
+    costos[r] += delta;
+    costoTotal += delta;
+    if (rutas[r].empty()) {
+        costoTotal -= costos[r];
+        costos[r] = 0;
+    }
+    rutaDe[pos] = -1;
+    indiceEn[pos] = -1;
+    reindexar(r, i);
+}
+
+void SolucionCompacta::mover(int r1, int i1, int r2, int j) {
+    int pos = rutas[r1][i1];
+    remover(r1, i1);
+    insertar(r2, j, pos);
+}
+
+void SolucionCompacta::intercambiar(int r1, int i1, int r2, int i2) {
+    if (r1 == r2) {
+        double delta = deltaIntercambiar(r1, i1, r2, i2);
+        swap(rutas[r1][i1], rutas[r1][i2]);
+        indiceEn[rutas[r1][i1]] = i1;
+        indiceEn[rutas[r1][i2]] = i2;
+        costos[r1] += delta;
+        costoTotal += delta;
+        return;
+    }
+    int a = rutas[r1][i1];
+    int b = rutas[r2][i2];
+    int pa = anterior(r1, i1), na = siguiente(r1, i1);
+    int pb = anterior(r2, i2), nb = siguiente(r2, i2);
+    double delta1 = inst->dist(pa, b) + inst->dist(b, na) - inst->dist(pa, a) - inst->dist(a, na);
+    double delta2 = inst->dist(pb, a) + inst->dist(a, nb) - inst->dist(pb, b) - inst->dist(b, nb);
+    rutas[r1][i1] = b;
+    rutas[r2][i2] = a;
+    rutaDe[a] = r2;
+    rutaDe[b] = r1;
+    indiceEn[a] = i2;
+    indiceEn[b] = i1;
+    int diferencia = inst->getDemanda(b) - inst->getDemanda(a);
+    cargas[r1] += diferencia;
+    cargas[r2] -= diferencia;
+    costos[r1] += delta1;
+    costos[r2] += delta2;
+    costoTotal += delta1 + delta2;
+}
+
+void SolucionCompacta::invertir(int r, int i, int j) {
+    if (i >= j) return;
+    double delta = deltaInvertir(r, i, j);
+    reverse(rutas[r].begin() + i, rutas[r].begin() + j + 1);
+    for (int k = i; k <= j; ++k) {
+        indiceEn[rutas[r][k]] = k;
+    }
+    costos[r] += delta;
+    costoTotal += delta;
+}
+
+int SolucionCompacta::agregarRutaVacia() {
+    rutas.emplace_back();
+    cargas.push_back(0);
+    costos.push_back(0.0);
+    return static_cast<int>(rutas.size()) - 1;
+}
+
+void SolucionCompacta::eliminarUltimaRuta() {
+    rutas.pop_back();
+    cargas.pop_back();
+    costos.pop_back();
+}
+
+void SolucionCompacta::eliminarRutasVacias() {
+    size_t destino = 0;
+    for (size_t r = 0; r < rutas.size(); ++r) {
+        if (rutas[r].empty()) continue;
+        if (destino != r) {
+            rutas[destino] = move(rutas[r]);
+            cargas[destino] = cargas[r];
+            costos[destino] = costos[r];
+            for (int pos : rutas[destino]) rutaDe[pos] = static_cast<int>(destino);
+        }
+        destino++;
+    }
+    rutas.resize(destino);
+    cargas.resize(destino);
+    costos.resize(destino);
+}
+
+void SolucionCompacta::completar() {
+    while (getCantRutas() < inst->getNumVehiculos()) {
+        agregarRutaVacia();
+    }
+    for (int pos : inst->getPosClientes()) {
+        if (rutaDe[pos] >= 0)
+            continue;
+        int mejorRuta = -1, mejorIndice = 0;
+        double mejorDelta = numeric_limits<double>::max();
+        for (int r = 0; r < getCantRutas(); ++r) {
+            if (cargas[r] + inst->getDemanda(pos) > inst->getCapacidad())
+                continue;
+            double delta;
+            int i = mejorInsercion(r, pos, delta);
+            if (delta < mejorDelta) {
+                mejorDelta = delta;
+                mejorRuta = r;
+                mejorIndice = i;
+            }
+        }
+        if (mejorRuta < 0)
+            mejorRuta = agregarRutaVacia();
+        insertar(mejorRuta, mejorIndice, pos);
+    }
+}
+
+vector<vector<int>> SolucionCompacta::getRutasNoVacias() const {
+    vector<vector<int>> resultado;
+    for (const vector<int>& ruta : rutas) {
+        if (!ruta.empty()) resultado.push_back(ruta);
+    }
+    return resultado;
+}
+
+void SolucionCompacta::reemplazarRuta(int r, const vector<int>& secuencia) {
+    // Sólo se desasignan los que siguen en esta ruta: al pasar clientes de
+    // una ruta a otra con dos reemplazos, el segundo no debe pisar al primero
+    for (int pos : rutas[r]) {
+        if (rutaDe[pos] != r) continue;
+        rutaDe[pos] = -1;
+        indiceEn[pos] = -1;
+    }
+    costoTotal -= costos[r];
+    rutas[r] = secuencia;
+    int deposito = inst->getPosDeposito();
+    int prev = deposito;
+    cargas[r] = 0;
+    costos[r] = 0;
+    for (size_t i = 0; i < secuencia.size(); ++i) {
+        int pos = secuencia[i];
+        cargas[r] += inst->getDemanda(pos);
+        costos[r] += inst->dist(prev, pos);
+        rutaDe[pos] = r;
+        indiceEn[pos] = static_cast<int>(i);
+        prev = pos;
+    }
+    if (!secuencia.empty()) costos[r] += inst->dist(prev, deposito);
+    costoTotal += costos[r];
+}
+
+bool SolucionCompacta::esFactible() const {
+    for (int carga : cargas) {
+        if (carga > inst->getCapacidad()) return false;
+    }
+    if (getCantRutasNoVacias() > inst->getNumVehiculos()) return false;
+    for (int pos : inst->getPosClientes()) {
+        if (rutaDe[pos] < 0) return false;
+    }
+    return true;
+}
+
+Solucion SolucionCompacta::aSolucion() const {
+    return inst->aSolucion(getRutasNoVacias());
+}
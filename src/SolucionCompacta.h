@@ -0,0 +1,89 @@
+#ifndef SOLUCION_COMPACTA_H
+#define SOLUCION_COMPACTA_H
+
+#include "InstanciaCompacta.h"
+#include "Solucion.h"
+#include <vector>
+
+using namespace std;
+
+// Solución mutable por posiciones, pensada para modificarse en el lugar:
+// cada ruta es la secuencia de clientes sin los depósitos, y se mantienen
+// carga, costo por ruta y la ubicación (ruta, índice) de cada cliente, de
+// modo que insertar/remover y sus deltas de costo no reconstruyen nada.
+class SolucionCompacta {
+private:
+    const InstanciaCompacta* inst;
+    vector<vector<int>> rutas;
+    vector<int> cargas;
+    vector<double> costos;
+    double costoTotal;
+    vector<int> rutaDe;    // por posición; -1 si no está asignado
+    vector<int> indiceEn;  // índice dentro de su ruta
+
+    void reindexar(int r, int desde);
+
+public:
+    explicit SolucionCompacta(const InstanciaCompacta& inst);
+    SolucionCompacta(const InstanciaCompacta& inst, const vector<vector<int>>& rutas);
+
+    // Reemplaza todas las rutas reutilizando la memoria ya reservada
+    void cargar(const vector<vector<int>>& nuevasRutas);
+
+    const InstanciaCompacta& getInstancia() const;
+    int getCantRutas() const;
+    int getCantRutasNoVacias() const;
+    const vector<int>& getRuta(int r) const;
+    const vector<vector<int>>& getRutas() const;
+    int getCarga(int r) const;
+    double getCostoRuta(int r) const;
+    double getCosto() const;
+    int getRutaDe(int pos) const;
+    int getIndiceEn(int pos) const;
+
+    // Vecinos en la ruta (el depósito en los extremos)
+    int anterior(int r, int i) const;
+    int siguiente(int r, int i) const;
+
+    // Deltas de costo sin modificar la solución. Insertar en el índice i
+    // deja al cliente antes del que hoy ocupa ese lugar (0..largo).
+    double deltaRemover(int r, int i) const;
+    double deltaInsertar(int r, int i, int pos) const;
+    // Mejor índice de inserción de pos en la ruta r (deltaMejor de salida)
+    int mejorInsercion(int r, int pos, double& deltaMejor) const;
+
+    // Mover el cliente (r1, i1) al índice j de r2; si r1 == r2, j es el
+    // índice en la ruta ya sin el cliente
+    double deltaMover(int r1, int i1, int r2, int j) const;
+    // Intercambiar los clientes (r1, i1) y (r2, i2)
+    double deltaIntercambiar(int r1, int i1, int r2, int i2) const;
+    // Invertir el tramo [i, j] de la ruta r (2-opt); O(1) con distancias
+    // simétricas, O(j - i) si no
+    double deltaInvertir(int r, int i, int j) const;
+
+    void insertar(int r, int i, int pos);
+    void remover(int r, int i);
+    void mover(int r1, int i1, int r2, int j);
+    void intercambiar(int r1, int i1, int r2, int i2);
+    void invertir(int r, int i, int j);
+    int agregarRutaVacia();
+    // Quita la última ruta, que tiene que estar vacía
+    void eliminarUltimaRuta();
+    void eliminarRutasVacias();
+    // Agrega rutas vacías hasta completar la flota (así un movimiento puede
+    // abrir una ruta) e inserta donde mejor entren los clientes sin ruta;
+    // si alguno no entra en ninguna, abre una ruta más
+    void completar();
+    // Rutas sin las vacías, para convertir o comparar
+    vector<vector<int>> getRutasNoVacias() const;
+    void reemplazarRuta(int r, const vector<int>& secuencia);
+
+    // Recalcula cargas y costos desde cero (corrige el error de redondeo
+    // acumulado tras muchas actualizaciones incrementales)
+    void recalcular();
+
+    bool esFactible() const;
+    Solucion aSolucion() const;
+};
+
+#endif
@@ -0,0 +1,115 @@
+#include "Split.h"
+#include <limits>
+
+using namespace std;
+
+static const double INFINITO = numeric_limits<double>::max();
+
+Split::Split(const InstanciaCompacta& inst)
+    : inst(inst)
+{}
+
+double Split::dividir(const vector<int>& tour, int maxRutas, vector<vector<int>>& rutas) {
+    double costo = dividirSinLimite(tour, rutas);
+    if (maxRutas > 0 && static_cast<int>(rutas.size()) > maxRutas) {
+        double costoLimitado = dividirConLimite(tour, maxRutas, rutas);
+        if (costoLimitado < INFINITO)
+            return costoLimitado;
+        costo = dividirSinLimite(tour, rutas);
+    }
+    return costo;
+}
+
+double Split::dividirSinLimite(const vector<int>& tour, vector<vector<int>>& rutas) {
+    int n = static_cast<int>(tour.size());
+    int deposito = inst.getPosDeposito();
+    int capacidad = inst.getCapacidad();
+    potencial.assign(n + 1, INFINITO);
+    predecesor.assign(n + 1, 0);
+    potencial[0] = 0;
+    for (int i = 0; i < n; ++i) {
+        int carga = 0;
+        double costo = 0;
+        for (int j = i + 1; j <= n; ++j) {
+            int c = tour[j - 1];
+            carga += inst.getDemanda(c);
+            if (carga > capacidad && j > i + 1)
+                break;
+            if (j == i + 1) {
+                costo = inst.dist(deposito, c) + inst.dist(c, deposito);
+            } else {
+                int anterior = tour[j - 2];
+                costo += inst.dist(anterior, c) + inst.dist(c, deposito) - inst.dist(anterior, deposito);
+            }
+            if (potencial[i] + costo < potencial[j]) {
+                potencial[j] = potencial[i] + costo;
+                predecesor[j] = i;
+            }
+        }
+    }
+
+    int cantRutas = 0;
+    for (int j = n; j > 0; j = predecesor[j]) cantRutas++;
+    rutas.resize(cantRutas);
+    int r = cantRutas - 1;
+    for (int j = n; j > 0; j = predecesor[j], --r) {
+        rutas[r].assign(tour.begin() + predecesor[j], tour.begin() + j);
+    }
+    return potencial[n];
+}
+
+double Split::dividirConLimite(const vector<int>& tour, int maxRutas, vector<vector<int>>& rutas) {
+    int n = static_cast<int>(tour.size());
+    int deposito = inst.getPosDeposito();
+    int capacidad = inst.getCapacidad();
+    int ancho = n + 1;
+    potencial.assign(static_cast<size_t>(maxRutas + 1) * ancho, INFINITO);
+    predecesor.assign(static_cast<size_t>(maxRutas + 1) * ancho, 0);
+    potencial[0] = 0;
+    for (int k = 0; k < maxRutas; ++k) {
+        for (int i = k; i < n; ++i) {
+            double base = potencial[k * ancho + i];
+            if (base == INFINITO)
+                continue;
+            int carga = 0;
+            double costo = 0;
+            for (int j = i + 1; j <= n; ++j) {
+                int c = tour[j - 1];
+                carga += inst.getDemanda(c);
+                if (carga > capacidad && j > i + 1)
+                    break;
+                if (j == i + 1) {
+                    costo = inst.dist(deposito, c) + inst.dist(c, deposito);
+                } else {
+                    int anterior = tour[j - 2];
+                    costo += inst.dist(anterior, c) + inst.dist(c, deposito) - inst.dist(anterior, deposito);
+                }
+                size_t destino = static_cast<size_t>(k + 1) * ancho + j;
+                if (base + costo < potencial[destino]) {
+                    potencial[destino] = base + costo;
+                    predecesor[destino] = i;
+                }
+            }
+        }
+    }
+
+    int mejorK = -1;
+    double mejor = INFINITO;
+    for (int k = 1; k <= maxRutas; ++k) {
+        if (potencial[static_cast<size_t>(k) * ancho + n] < mejor) {
+            mejor = potencial[static_cast<size_t>(k) * ancho + n];
+            mejorK = k;
+        }
+    }
+    if (mejorK < 0)
+        return INFINITO;
+
+    rutas.resize(mejorK);
+    int j = n;
+    for (int k = mejorK; k > 0; --k) {
+        int i = predecesor[static_cast<size_t>(k) * ancho + j];
+        rutas[k - 1].assign(tour.begin() + i, tour.begin() + j);
+        j = i;
+    }
+    return mejor;
+}
@@ -0,0 +1,33 @@
+#ifndef SPLIT_H
+#define SPLIT_H
+
+#include "InstanciaCompacta.h"
+#include <vector>
+
+using namespace std;
+
+// Split de Prins: parte un tour gigante (todos los clientes, sin depósitos)
+// en rutas consecutivas de costo total mínimo respetando la capacidad. Es un
+// camino mínimo sobre un grafo acíclico; como cada ruta corta al superar la
+// capacidad, cuesta O(clientes * largo de ruta), y con límite de flota
+// O(rutas * clientes * largo de ruta). Los buffers se reutilizan.
+class Split {
+private:
+    const InstanciaCompacta& inst;
+    vector<double> potencial;      // [k * (n + 1) + j] con límite de flota
+    vector<int> predecesor;
+
+    double dividirSinLimite(const vector<int>& tour, vector<vector<int>>& rutas);
+    double dividirConLimite(const vector<int>& tour, int maxRutas, vector<vector<int>>& rutas);
+
+public:
+    explicit Split(const InstanciaCompacta& inst);
+
+    // Deja las rutas en `rutas` (reutilizando sus vectores) y devuelve el
+    // costo. Si sin límite hacen falta más de maxRutas (> 0) rutas, busca la
+    // mejor partición con a lo sumo maxRutas; si no existe, devuelve la
+    // partición sin límite.
+    double dividir(const vector<int>& tour, int maxRutas, vector<vector<int>>& rutas);
+};
+
+#endif
@@ -0,0 +1,245 @@
+#include "TabuSearch.h"
+#include "HeuristicaInsercionCercana.h"
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+// Cada cuántas iteraciones se recalcula el costo desde cero
+static const long ITERACIONES_ENTRE_RECALCULOS = 10000;
+
+// Corte por defecto: iteraciones sin mejora por cliente
+static const int ITERACIONES_SIN_MEJORA_POR_CLIENTE = 10;
+
+TabuSearch::TabuSearch(
+    const vector<Cliente>& clientes,
+    const vector<vector<double>>& distMatrix,
+    const unordered_map<int, int>& id2pos,
+    int capacidadVehiculo,
+    int depotId,
+    int numVehiculos,
+    uint64_t semilla,
+    int vecinosGranulares)
+    : TabuSearch(make_shared<const InstanciaCompacta>(clientes, distMatrix, id2pos,
+                                                      capacidadVehiculo, depotId,
+                                                      numVehiculos),
+                 semilla, vecinosGranulares)
+{}
+
+TabuSearch::TabuSearch(
+    shared_ptr<const InstanciaCompacta> compartida,
+    uint64_t semilla,
+    int vecinosGranulares)
+    : clientes(compartida->getClientes()),
+      semilla(semilla),
+      instancia(move(compartida)),
+      inst(*instancia),
+      vecinos(inst.getDistancias(), vecinosGranulares),
+      tenenciaMin(0),
+      tenenciaMax(0),
+      maxIteraciones(0),
+      cantRutas(0),
+      mejorCosto(numeric_limits<double>::max()),
+      iteracionesRealizadas(0),
+      segundos(0)
+{}
+
+SolucionCompacta TabuSearch::construirInicial() const {
+    vector<vector<int>> rutas;
+    if (solucionInicial) {
+        rutas = inst.rutasDesde(*solucionInicial);
+    } else {
+        HeuristicaInsercionCercana ni(clientes, inst.getIdDistancias(), inst.getCapacidad(),
+                                      inst.getDepotId(), inst.getNumVehiculos());
+        rutas = inst.rutasDesde(ni.resolver());
+    }
+    SolucionCompacta sol(inst, rutas);
+    sol.eliminarRutasVacias();
+    sol.completar();
+    return sol;
+}
+
+bool TabuSearch::esTabu(int pos, int r, long iter) const {
+    return tabuHasta[static_cast<size_t>(pos) * cantRutas + r] > iter;
+}
+
+bool TabuSearch::buscarMejorMovimiento(const SolucionCompacta& sol, long iter,
+                                       Movimiento& elegido) const {
+    int capacidad = inst.getCapacidad();
+    double costo = sol.getCosto();
+    bool hayAdmisible = false, hayTabu = false;
+    Movimiento mejorTabu;
+    elegido.delta = numeric_limits<double>::max();
+    mejorTabu.delta = numeric_limits<double>::max();
+
+    // Un movimiento tabú sólo se admite si mejora la mejor solución
+    auto considerar = [&](const Movimiento& mov, bool tabu) {
+        if (tabu && costo + mov.delta >= mejorCosto - 1e-9) {
+            if (mov.delta < mejorTabu.delta) {
+                mejorTabu = mov;
+                hayTabu = true;
+            }
+            return;
+        }
+        if (mov.delta < elegido.delta) {
+            elegido = mov;
+            hayAdmisible = true;
+        }
+    };
+
+    int rutaVacia = -1;
+    for (int r = 0; r < sol.getCantRutas() && rutaVacia < 0; ++r) {
+        if (sol.getRuta(r).empty()) rutaVacia = r;
+    }
+
+    const int* lista;
+    int largoLista = vecinos.getCantidadVecinos();
+    Movimiento mov;
+    for (int c : inst.getPosClientes()) {
+        int r1 = sol.getRutaDe(c);
+        int i1 = sol.getIndiceEn(c);
+        int demanda = inst.getDemanda(c);
+        lista = vecinos.getVecinos(c);
+
+        for (int k = 0; k < largoLista; ++k) {
+            int v = lista[k];
+            if (!inst.esCliente(v))
+                continue;
+            int r2 = sol.getRutaDe(v);
+            if (r2 == r1)
+                continue;
+            int i2 = sol.getIndiceEn(v);
+
+            // Relocate: c antes o después de v
+            if (sol.getCarga(r2) + demanda <= capacidad) {
+                bool tabu = esTabu(c, r2, iter);
+                for (int lado = 0; lado < 2; ++lado) {
+                    mov = {false, r1, i1, r2, i2 + lado, 0};
+                    mov.delta = sol.deltaMover(r1, i1, r2, i2 + lado);
+                    considerar(mov, tabu);
+                }
+            }
+
+            // Swap: c ocupa el lugar de v y viceversa
+            int diferencia = inst.getDemanda(v) - demanda;
+            if (sol.getCarga(r1) + diferencia <= capacidad &&
+                sol.getCarga(r2) - diferencia <= capacidad) {
+                mov = {true, r1, i1, r2, i2, 0};
+                mov.delta = sol.deltaIntercambiar(r1, i1, r2, i2);
+                considerar(mov, esTabu(c, r2, iter) || esTabu(v, r1, iter));
+            }
+        }
+
+        // Abrir una ruta nueva con c, si queda algún vehículo libre
+        if (rutaVacia >= 0 && sol.getRuta(r1).size() > 1) {
+            mov = {false, r1, i1, rutaVacia, 0, 0};
+            mov.delta = sol.deltaMover(r1, i1, rutaVacia, 0);
+            considerar(mov, esTabu(c, rutaVacia, iter));
+        }
+    }
+
+    // Si todo es tabú, el menos malo de los tabú
+    if (!hayAdmisible && hayTabu)
+        elegido = mejorTabu;
+    return hayAdmisible || hayTabu;
+}
+
+Solucion TabuSearch::resolver() {
+    control.reiniciar();
+    iteracionesRealizadas = 0;
+    segundos = 0;
+
+    GeneradorAleatorio rng(semilla);
+    SolucionCompacta actual = construirInicial();
+    mejoresRutas = actual.getRutas();
+    mejorCosto = actual.getCosto();
+    if (control.objetivoAlcanzado(mejorCosto))
+        control.detener();
+
+    cantRutas = actual.getCantRutas();
+    tabuHasta.assign(static_cast<size_t>(inst.getCantPos()) * cantRutas, 0);
+
+    int n = inst.getCantClientes();
+    int tMin = tenenciaMin > 0 ? tenenciaMin : max(5, n / 20);
+    int tMax = tenenciaMax >= tMin ? tenenciaMax : max(tMin, max(10, n / 10));
+    long sinMejoraPorDefecto = 0;
+    if (!control.getCriterio().tieneLimite() && maxIteraciones <= 0)
+        sinMejoraPorDefecto = static_cast<long>(ITERACIONES_SIN_MEJORA_POR_CLIENTE) * max(1, n);
+
+    long sinMejora = 0;
+    for (long iter = 0; ; ++iter) {
+        if (maxIteraciones > 0 && iter >= maxIteraciones)
+            break;
+        if (control.debeDetenerse())
+            break;
+        if (sinMejoraPorDefecto > 0 && sinMejora >= sinMejoraPorDefecto)
+            break;
+
+        Movimiento mov;
+        if (!buscarMejorMovimiento(actual, iter, mov))
+            break;
+
+        // Atributos tabú: los clientes movidos no vuelven a su ruta de origen
+        int c = actual.getRuta(mov.r1)[mov.i1];
+        auto tenencia = [&]() { return tMin + rng.enteroEn(tMax - tMin + 1); };
+        tabuHasta[static_cast<size_t>(c) * cantRutas + mov.r1] = iter + tenencia();
+        if (mov.intercambio) {
+            int v = actual.getRuta(mov.r2)[mov.i2];
+            tabuHasta[static_cast<size_t>(v) * cantRutas + mov.r2] = iter + tenencia();
+            actual.intercambiar(mov.r1, mov.i1, mov.r2, mov.i2);
+        } else {
+            actual.mover(mov.r1, mov.i1, mov.r2, mov.i2);
+        }
+        iteracionesRealizadas++;
+        if (iteracionesRealizadas % ITERACIONES_ENTRE_RECALCULOS == 0)
+            actual.recalcular();
+
+        if (actual.getCosto() < mejorCosto - 1e-9) {
+            mejorCosto = actual.getCosto();
+            mejoresRutas = actual.getRutas();
+            sinMejora = 0;
+            if (alMejorar)
+                alMejorar(SolucionCompacta(inst, mejoresRutas).aSolucion(), control.segundos());
+            if (control.objetivoAlcanzado(mejorCosto))
+                control.detener();
+        } else {
+            sinMejora++;
+            if (control.sinMejoraAgotado(sinMejora))
+                control.detener();
+        }
+    }
+
+    segundos = control.segundos();
+    return SolucionCompacta(inst, mejoresRutas).aSolucion();
+}
+
+void TabuSearch::setSolucionInicial(const Solucion& sol) {
+    solucionInicial.reset(new Solucion(sol));
+}
+
+void TabuSearch::setTenencia(int minimo, int maximo) {
+    tenenciaMin = minimo;
+    tenenciaMax = maximo;
+}
+
+void TabuSearch::setMaxIteraciones(long iteraciones) { maxIteraciones = iteraciones; }
+
+void TabuSearch::setCriterioParada(const CriterioParada& criterio) {
+    control.setCriterio(criterio);
+}
+
+void TabuSearch::setAlMejorar(function<void(const Solucion&, double)> callback) {
+    alMejorar = move(callback);
+}
+
+void TabuSearch::detener() { control.detener(); }
+
+double TabuSearch::getMejorCosto() const { return mejorCosto; }
+
+long TabuSearch::getIteracionesRealizadas() const { return iteracionesRealizadas; }
+
+double TabuSearch::getIteracionesPorSegundo() const {
+    return segundos > 0 ? iteracionesRealizadas / segundos : 0.0;
+}
+
+uint64_t TabuSearch::getSemilla() const { return semilla; }
@@ -0,0 +1,96 @@
+#ifndef TABU_SEARCH_H
+#define TABU_SEARCH_H
+
+#include "Cliente.h"
+#include "Solucion.h"
+#include "InstanciaCompacta.h"
+#include "SolucionCompacta.h"
+#include "ListaVecinos.h"
+#include "GeneradorAleatorio.h"
+#include "CriterioParada.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// Búsqueda tabú con movimientos entre rutas (relocate y swap). En cada
+// iteración se aplica el mejor movimiento no tabú de una lista granular: sólo
+// se prueba llevar cada cliente junto a sus vecinos más cercanos. Un atributo
+// (cliente, ruta) queda tabú hasta cierta iteración al sacar al cliente de
+// esa ruta; la aspiración permite un movimiento tabú si mejora la mejor.
+class TabuSearch {
+private:
+    const vector<Cliente>& clientes;
+    uint64_t semilla;
+
+    // Propia o compartida con otros solvers (sólo se lee)
+    shared_ptr<const InstanciaCompacta> instancia;
+    const InstanciaCompacta& inst;
+    ListaVecinos vecinos;
+    unique_ptr<Solucion> solucionInicial;
+
+    int tenenciaMin;   // <= 0: automática según la cantidad de clientes
+    int tenenciaMax;
+    long maxIteraciones;  // <= 0: sin límite propio
+
+    ControlParada control;
+    function<void(const Solucion&, double)> alMejorar;
+
+    // tabuHasta[pos * cantRutas + r]: primera iteración en que `pos` puede
+    // volver a la ruta r
+    vector<long> tabuHasta;
+    int cantRutas;
+
+    vector<vector<int>> mejoresRutas;
+    double mejorCosto;
+    long iteracionesRealizadas;
+    double segundos;
+
+    struct Movimiento {
+        bool intercambio;  // false: relocate
+        int r1, i1, r2, i2;
+        double delta;
+    };
+
+    bool esTabu(int pos, int r, long iter) const;
+    bool buscarMejorMovimiento(const SolucionCompacta& sol, long iter, Movimiento& elegido) const;
+    SolucionCompacta construirInicial() const;
+
+public:
+    TabuSearch(const vector<Cliente>& clientes,
+               const vector<vector<double>>& distMatrix,
+               const unordered_map<int, int>& id2pos,
+               int capacidadVehiculo,
+               int depotId,
+               int numVehiculos,
+               uint64_t semilla = 0,
+               int vecinosGranulares = 20);
+    // Sobre una instancia ya armada, con cualquier proveedor de distancias,
+    // que puede compartirse entre varios solvers
+    TabuSearch(shared_ptr<const InstanciaCompacta> instancia,
+               uint64_t semilla = 0,
+               int vecinosGranulares = 20);
+
+    // Sin criterio de parada ni límite de iteraciones corta tras 10
+    // iteraciones por cliente sin mejorar la mejor solución
+    Solucion resolver();
+
+    // Por defecto se parte de Inserción Más Cercana
+    void setSolucionInicial(const Solucion& sol);
+    // La tenencia de cada atributo se sortea en [minimo, maximo]
+    void setTenencia(int minimo, int maximo);
+    void setMaxIteraciones(long iteraciones);
+    void setCriterioParada(const CriterioParada& criterio);
+    void setAlMejorar(function<void(const Solucion&, double)> callback);
+    void detener();
+
+    double getMejorCosto() const;
+    long getIteracionesRealizadas() const;
+    double getIteracionesPorSegundo() const;
+    uint64_t getSemilla() const;
+};
+
+#endif
@@ -1,77 +1,365 @@
 #include "VRPLIBReader.h"
+#include "MappedFile.h"
+#include "DistanceKernels.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <stdexcept>
 #include <cmath>
-#include <sstream>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+enum class Section { None, NodeCoord, Demand, Depot, EdgeWeight };
+
+// Cursor over the mapped file. Tokens never cross a line break and are
+// views into the buffer, so the file is walked once without copies.
+class Scanner {
+public:
+    Scanner(const char* begin, const char* end) : p(begin), end(end) {}
+
+    bool atEnd() const { return p >= end; }
+    bool atLineEnd() const { return p >= end || *p == '\n'; }
+    char peek() const { return *p; }
+
+    // Spaces, tabs and the '\r' of CRLF files
+    void skipBlanks() {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+    }
+
+    void nextLine() {
+        const void* newline = std::memchr(p, '\n', end - p);
+        p = newline ? static_cast<const char*>(newline) + 1 : end;
+    }
+
+    // Keyword up to a blank, a ':' or the end of the line
+    std::string_view word() {
+        const char* start = p;
+        while (p < end && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n' && *p != ':') ++p;
+        return std::string_view(start, p - start);
+    }
+
+    // Skips the ':' of "KEY : value" and "KEY: value" header lines
+    void skipSeparator() {
+        skipBlanks();
+        if (p < end && *p == ':') ++p;
+        skipBlanks();
+    }
+
+    // Rest of the line without trailing blanks
+    std::string_view rest() {
+        const char* start = p;
+        while (p < end && *p != '\n') ++p;
+        const char* last = p;
+        while (last > start && (last[-1] == ' ' || last[-1] == '\t' || last[-1] == '\r')) --last;
+        return std::string_view(start, last - start);
+    }
+
+    template <typename T>
+    bool number(T& value) {
+        skipBlanks();
+        auto result = std::from_chars(p, end, value);
+        if (result.ec != std::errc()) return false;
+        p = result.ptr;
+        return true;
+    }
+
+private:
+    const char* p;
+    const char* end;
+};
+
+// Places the values of an EXPLICIT EDGE_WEIGHT_SECTION straight into the
+// distance matrix (1-indexed), in the order given by the format. The
+// triangular formats are mirrored as they are read.
+class WeightCursor {
+public:
+    WeightCursor(std::vector<std::vector<double>>& matrix, int dimension, EdgeWeightFormat format)
+        : matrix(matrix), n(dimension), format(format) {
+        switch (format) {
+        case EdgeWeightFormat::FullMatrix:   row = 0; col = 0; break;
+        case EdgeWeightFormat::UpperRow:     row = 0; col = 1; break;
+        case EdgeWeightFormat::LowerRow:     row = 1; col = 0; break;
+        case EdgeWeightFormat::UpperDiagRow: row = 0; col = 0; break;
+        case EdgeWeightFormat::LowerDiagRow: row = 0; col = 0; break;
+        }
+    }
+
+    bool complete() const { return row >= n || (format == EdgeWeightFormat::UpperRow && row >= n - 1); }
+
+    void put(double value) {
+        if (complete()) {
+            throw std::runtime_error("Error: EDGE_WEIGHT_SECTION has too many values");
+        }
+        matrix[row + 1][col + 1] = value;
+        if (format != EdgeWeightFormat::FullMatrix) {
+            matrix[col + 1][row + 1] = value;
+        }
+        advance();
+    }
+
+private:
+    std::vector<std::vector<double>>& matrix;
+    int n;
+    EdgeWeightFormat format;
+    int row {0};
+    int col {0};
+
+    void advance() {
+        ++col;
+        switch (format) {
+        case EdgeWeightFormat::FullMatrix:
+        case EdgeWeightFormat::UpperDiagRow:
+        case EdgeWeightFormat::UpperRow:
+            if (col >= n) {
+                ++row;
+                col = format == EdgeWeightFormat::FullMatrix ? 0
+                    : format == EdgeWeightFormat::UpperDiagRow ? row : row + 1;
+            }
+            break;
+        case EdgeWeightFormat::LowerRow:
+            if (col >= row) { ++row; col = 0; }
+            break;
+        case EdgeWeightFormat::LowerDiagRow:
+            if (col > row) { ++row; col = 0; }
+            break;
+        }
+    }
+};
+
+// Unknown types are read as EUC_2D, as the original reader (which ignored
+// the field) did
+EdgeWeightType parseWeightType(std::string_view value) {
+    if (value == "CEIL_2D") return EdgeWeightType::Ceil2D;
+    if (value == "ATT") return EdgeWeightType::Att;
+    if (value == "GEO") return EdgeWeightType::Geo;
+    if (value == "EXPLICIT") return EdgeWeightType::Explicit;
+    return EdgeWeightType::Euc2D;
+}
+
+EdgeWeightFormat parseWeightFormat(std::string_view value) {
+    if (value == "FULL_MATRIX") return EdgeWeightFormat::FullMatrix;
+    if (value == "UPPER_ROW") return EdgeWeightFormat::UpperRow;
+    if (value == "LOWER_ROW") return EdgeWeightFormat::LowerRow;
+    if (value == "UPPER_DIAG_ROW") return EdgeWeightFormat::UpperDiagRow;
+    if (value == "LOWER_DIAG_ROW") return EdgeWeightFormat::LowerDiagRow;
+    throw std::runtime_error("Error: Unsupported EDGE_WEIGHT_FORMAT " + std::string(value));
+}
+
+// TSPLIB GEO: DDD.MM coordinates to radians
+double geoRadians(double value) {
+    const double PI = 3.141592;
+    double degrees = std::trunc(value);
+    double minutes = value - degrees;
+    return PI * (degrees + 5.0 * minutes / 3.0) / 180.0;
+}
+
+// Column tile of the coordinate matrix fill: the x/y slices of a tile
+// (2 x 8 KB) stay in L1 while every row of the block streams over them
+const std::size_t DISTANCE_TILE = 1024;
+
+// Below this many matrix entries a single thread is faster than starting more
+const std::size_t ENTRIES_PER_THREAD = std::size_t(1) << 22;
+
+// --- Binary cache (.cvrpbin) ---
+//
+// Layout, in native byte order; every array starts at a multiple of 8:
+//   CacheHeader
+//   int32  node IDs [nodeCount]
+//   double node x [nodeCount], node y [nodeCount]
+//   int32  demands [demandCount]
+//   double distance matrix [matrixRows^2], row-major by node ID
+//   int32  nearest neighbors [matrixRows * neighborCount], row by node ID
+//   char   name [nameLength]
+// CACHE_VERSION must change whenever the layout or the meaning of a field
+// (e.g. how distances are computed) changes.
+const char CACHE_MAGIC[8] = {'C', 'V', 'R', 'P', 'B', 'I', 'N', '\0'};
+const std::uint32_t CACHE_VERSION = 1;
+
+// Neighbors stored per node, enough for the granular neighborhoods
+const int CACHED_NEIGHBORS = 20;
+
+struct CacheHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t headerSize;
+    std::uint64_t sourceHash;
+    std::uint64_t sourceSize;
+    std::int32_t dimension;
+    std::int32_t capacity;
+    std::int32_t numVehicles;
+    std::int32_t depotId;
+    std::int32_t edgeWeightType;
+    std::int32_t nodeCount;
+    std::int32_t demandCount;
+    std::int32_t matrixRows;
+    std::int32_t neighborCount;
+    std::int32_t nameLength;
+};
+
+// Offsets of each array, derived from the counts in the header
+struct CacheLayout {
+    std::size_t ids, xs, ys, demands, matrix, neighbors, name, total;
+
+    explicit CacheLayout(const CacheHeader& h) {
+        auto align = [](std::size_t offset) { return (offset + 7) & ~std::size_t(7); };
+        std::size_t rows = static_cast<std::size_t>(h.matrixRows);
+        ids = align(sizeof(CacheHeader));
+        xs = align(ids + sizeof(std::int32_t) * h.nodeCount);
+        ys = xs + sizeof(double) * h.nodeCount;
+        demands = align(ys + sizeof(double) * h.nodeCount);
+        matrix = align(demands + sizeof(std::int32_t) * h.demandCount);
+        neighbors = matrix + sizeof(double) * rows * rows;
+        name = align(neighbors + sizeof(std::int32_t) * rows * h.neighborCount);
+        total = name + h.nameLength;
+    }
+};
+
+// FNV-1a over the whole VRPLIB file
+std::uint64_t hashBytes(const char* data, std::size_t size) {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::string cacheFilePath(const std::string& cacheDir, const std::string& filePath, std::uint64_t hash) {
+    std::string stem = filePath.substr(filePath.find_last_of('/') + 1);
+    char hex[17];
+    std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+    return cacheDir + "/" + stem + "-" + hex + ".cvrpbin";
+}
+
+} // namespace
 
 // Constructor: Initializes the reader and starts the parsing process.
 VRPLIBReader::VRPLIBReader(const std::string& filePath) {
-    parse(filePath);
+    MappedFile file(filePath);
+    parse(file.data(), file.data() + file.size(), filePath);
 }
 
-// Main parsing method
-void VRPLIBReader::parse(const std::string& filePath) {
-    std::ifstream file(filePath);
-    if (!file.is_open()) {
-        throw std::runtime_error("Error: Could not open file " + filePath);
+VRPLIBReader::VRPLIBReader(const std::string& filePath, DistanceStorage storage) : storage(storage) {
+    MappedFile file(filePath);
+    parse(file.data(), file.data() + file.size(), filePath);
+}
+
+VRPLIBReader::VRPLIBReader(const std::string& filePath, const std::string& cacheDir) {
+    MappedFile file(filePath);
+    std::uint64_t hash = hashBytes(file.data(), file.size());
+    std::string cachePath = cacheFilePath(cacheDir, filePath, hash);
+    if (loadCache(cachePath, hash, file.size())) {
+        fromCache = true;
+        return;
     }
+    parse(file.data(), file.data() + file.size(), filePath);
+    computeNearestNeighbors();
+    mkdir(cacheDir.c_str(), 0755); // Fails harmlessly if it already exists
+    writeCache(cachePath, hash, file.size());
+}
+
+// Main parsing method: a single pass over the memory-mapped file
+void VRPLIBReader::parse(const char* begin, const char* end, const std::string& filePath) {
+    Scanner scanner(begin, end);
+    Section section = Section::None;
+    bool displayOnly = false;
+    std::unique_ptr<WeightCursor> weights;
 
-    std::string line;
-    std::string current_section;
+    for (; !scanner.atEnd(); scanner.nextLine()) {
+        scanner.skipBlanks();
+        if (scanner.atLineEnd()) continue;
 
-    while (getline(file, line)) {
-        std::istringstream iss(line);
-        std::string keyword;
-        iss >> keyword;
+        char first = scanner.peek();
+        if (section == Section::EdgeWeight && first != '-' &&
+            (std::isdigit(static_cast<unsigned char>(first)) || first == '.')) {
+            // Matrix values run across lines, without node IDs
+            double value;
+            while (scanner.number(value)) {
+                weights->put(value);
+            }
+            continue;
+        }
+        if (std::isdigit(static_cast<unsigned char>(first)) || first == '-') {
+            // Data lines start with a number (the node ID)
+            int id;
+            if (!scanner.number(id)) continue;
+            if (section == Section::NodeCoord && !displayOnly) {
+                Node node {id, 0.0, 0.0};
+                if (scanner.number(node.x) && scanner.number(node.y)) {
+                    nodes.push_back(node);
+                }
+            } else if (section == Section::Demand) {
+                int demand;
+                if (scanner.number(demand) && id >= 1 && id <= dimension) {
+                    demands[id] = demand;
+                }
+            } else if (section == Section::Depot) {
+                if (id != -1) {
+                    depotId = id;
+                } else {
+                    section = Section::None; // End of depot section
+                }
+            }
+            continue;
+        }
 
+        std::string_view keyword = scanner.word();
         if (keyword == "NAME") {
-            iss.ignore(2); // Ignore the space and ':'
-            std::getline(iss, name);
+            scanner.skipSeparator();
+            name = std::string(scanner.rest());
         } else if (keyword == "DIMENSION") {
-            iss.ignore(2);
-            iss >> dimension;
+            scanner.skipSeparator();
+            scanner.number(dimension);
         } else if (keyword == "CAPACITY") {
-            iss.ignore(2);
-            iss >> capacity;
+            scanner.skipSeparator();
+            scanner.number(capacity);
         } else if (keyword == "VEHICLES") { // Optional tag
-            iss.ignore(2);
-            iss >> numVehicles;
-        } else if (keyword == "NODE_COORD_SECTION") {
-            current_section = "NODE_COORD_SECTION";
+            scanner.skipSeparator();
+            scanner.number(numVehicles);
+        } else if (keyword == "EDGE_WEIGHT_TYPE") {
+            scanner.skipSeparator();
+            edgeWeightType = parseWeightType(scanner.word());
+        } else if (keyword == "EDGE_WEIGHT_FORMAT") {
+            scanner.skipSeparator();
+            edgeWeightFormat = parseWeightFormat(scanner.word());
+        } else if (keyword == "NODE_COORD_SECTION" || keyword == "DISPLAY_DATA_SECTION") {
+            // Display coordinates only stand in for missing node coordinates
+            section = Section::NodeCoord;
+            displayOnly = keyword == "DISPLAY_DATA_SECTION" && !nodes.empty();
             nodes.reserve(dimension);
+        } else if (keyword == "EDGE_WEIGHT_SECTION") {
+            section = Section::EdgeWeight;
+            distanceMatrix.assign(dimension + 1, std::vector<double>(dimension + 1, 0.0));
+            weights = std::make_unique<WeightCursor>(distanceMatrix, dimension, edgeWeightFormat);
         } else if (keyword == "DEMAND_SECTION") {
-            current_section = "DEMAND_SECTION";
+            section = Section::Demand;
             demands.resize(dimension + 1, 0); // Nodes are 1-indexed
         } else if (keyword == "DEPOT_SECTION") {
-            current_section = "DEPOT_SECTION";
+            section = Section::Depot;
         } else if (keyword == "EOF") {
             break;
-        } else if (!keyword.empty() && std::isdigit(keyword[0])) {
-            // Data lines start with a number (the node ID)
-            std::istringstream data_line_stream(line);
-            if (current_section == "NODE_COORD_SECTION") {
-                int id;
-                double x, y;
-                data_line_stream >> id >> x >> y;
-                nodes.push_back({id, x, y});
-            } else if (current_section == "DEMAND_SECTION") {
-                int id, demand;
-                data_line_stream >> id >> demand;
-                if (id >= 1 && id <= dimension) {
-                    demands[id] = demand;
-                }
-            } else if (current_section == "DEPOT_SECTION") {
-                int id;
-                data_line_stream >> id;
-                if (id != -1) {
-                    depotId = id;
-                } else {
-                    current_section = ""; // End of depot section
-                }
+        }
+    }
+
+    if (edgeWeightType == EdgeWeightType::Explicit) {
+        if (!weights || !weights->complete()) {
+            throw std::runtime_error("Error: EDGE_WEIGHT_SECTION is missing or incomplete in " + filePath);
+        }
+        // Without coordinates the nodes are just the IDs 1..dimension
+        if (nodes.empty()) {
+            for (int id = 1; id <= dimension; ++id) {
+                nodes.push_back({id, 0.0, 0.0});
             }
         }
     }
-    file.close();
 
     // If numVehicles was not in the file, provide a default upper bound.
     if (numVehicles == 0) {
@@ -82,9 +370,14 @@ void VRPLIBReader::parse(const std::string& filePath) {
     computeDistanceMatrix();
 }
 
-// Computes the Euclidean distance matrix.
+// Computes the distance matrix from the node coordinates.
 void VRPLIBReader::computeDistanceMatrix() {
-    if (nodes.empty()) return;
+    // EXPLICIT matrices were filled by the parser
+    if (nodes.empty() || edgeWeightType == EdgeWeightType::Explicit) return;
+    if (storage == DistanceStorage::OnDemand &&
+        (edgeWeightType == EdgeWeightType::Euc2D || edgeWeightType == EdgeWeightType::Ceil2D)) {
+        return;
+    }
 
     // Ensure nodes are sorted by ID for consistent matrix access if they weren't in order
     // std::sort(nodes.begin(), nodes.end(), [](const Node& a, const Node& b){ return a.id < b.id; });
@@ -93,10 +386,41 @@ void VRPLIBReader::computeDistanceMatrix() {
 
     distanceMatrix.resize(dimension + 1, std::vector<double>(dimension + 1, 0.0));
 
+    if ((edgeWeightType == EdgeWeightType::Euc2D || edgeWeightType == EdgeWeightType::Ceil2D) &&
+        fillEuclideanMatrix()) {
+        return;
+    }
+
+    auto distance = [this](const Node& a, const Node& b) {
+        double euclidean = std::sqrt(std::pow(a.x - b.x, 2) + std::pow(a.y - b.y, 2));
+        switch (edgeWeightType) {
+        case EdgeWeightType::Ceil2D:
+            return std::ceil(euclidean);
+        case EdgeWeightType::Att: {
+            // Pseudo-Euclidean distance, rounded up
+            double r = std::sqrt((std::pow(a.x - b.x, 2) + std::pow(a.y - b.y, 2)) / 10.0);
+            double t = std::nearbyint(r);
+            return t < r ? t + 1 : t;
+        }
+        case EdgeWeightType::Geo: {
+            // Great-circle distance in km on the TSPLIB idealized sphere
+            const double RRR = 6378.388;
+            double latA = geoRadians(a.x), lonA = geoRadians(a.y);
+            double latB = geoRadians(b.x), lonB = geoRadians(b.y);
+            double q1 = std::cos(lonA - lonB);
+            double q2 = std::cos(latA - latB);
+            double q3 = std::cos(latA + latB);
+            return std::trunc(RRR * std::acos(0.5 * ((1.0 + q1) * q2 - (1.0 - q1) * q3)) + 1.0);
+        }
+        default:
+            return euclidean;
+        }
+    };
+
     for (size_t i = 0; i < nodes.size(); ++i) {
         for (size_t j = i; j < nodes.size(); ++j) {
-            double dist = std::sqrt(std::pow(nodes[i].x - nodes[j].x, 2) +
-                                    std::pow(nodes[i].y - nodes[j].y, 2));
+            // GEO distances of a node to itself come out as 1; keep them at 0
+            double dist = i == j ? 0.0 : distance(nodes[i], nodes[j]);
             // Assumes node IDs are 1-based and contiguous from 1 to dimension.
             distanceMatrix[nodes[i].id][nodes[j].id] = dist;
             distanceMatrix[nodes[j].id][nodes[i].id] = dist;
@@ -104,6 +428,175 @@ void VRPLIBReader::computeDistanceMatrix() {
     }
 }
 
+// Fast path for EUC_2D and CEIL_2D: coordinates in a structure-of-arrays
+// layout indexed by ID and whole rows filled by the SIMD row kernel, tile
+// by tile, with row blocks split across threads for large instances. Rows
+// are independent, so nothing is scattered across triangles. Returns false
+// (and leaves the matrix alone) if the IDs are not exactly 1..dimension.
+bool VRPLIBReader::fillEuclideanMatrix() {
+    const std::size_t size = static_cast<std::size_t>(dimension) + 1;
+    if (nodes.size() != size - 1) return false;
+    std::vector<double> xs(size, 0.0), ys(size, 0.0);
+    std::vector<char> seen(size, 0);
+    for (const Node& node : nodes) {
+        if (node.id < 1 || node.id > dimension || seen[node.id]) return false;
+        seen[node.id] = 1;
+        xs[node.id] = node.x;
+        ys[node.id] = node.y;
+    }
+
+    const EuclideanRowKernel kernel = selectEuclideanRowKernel();
+    const bool ceiling = edgeWeightType == EdgeWeightType::Ceil2D;
+    auto fillRows = [&](std::size_t firstRow, std::size_t lastRow) {
+        for (std::size_t tile = 1; tile < size; tile += DISTANCE_TILE) {
+            std::size_t width = std::min(DISTANCE_TILE, size - tile);
+            for (std::size_t i = firstRow; i < lastRow; ++i) {
+                double* out = distanceMatrix[i].data() + tile;
+                kernel(xs[i], ys[i], xs.data() + tile, ys.data() + tile, out, width);
+                if (ceiling) {
+                    for (std::size_t j = 0; j < width; ++j) out[j] = std::ceil(out[j]);
+                }
+            }
+        }
+    };
+
+    std::size_t rows = size - 1;
+    std::size_t threads = std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                                rows * rows / ENTRIES_PER_THREAD);
+    if (threads <= 1) {
+        fillRows(1, size);
+        return true;
+    }
+    std::vector<std::thread> workers;
+    std::size_t perThread = (rows + threads - 1) / threads;
+    for (std::size_t first = 1; first < size; first += perThread) {
+        workers.emplace_back(fillRows, first, std::min(size, first + perThread));
+    }
+    for (std::thread& worker : workers) worker.join();
+    return true;
+}
+
+// Nearest neighbors by node ID, ties broken by ID so the lists are
+// deterministic (as in ListaVecinos)
+void VRPLIBReader::computeNearestNeighbors() {
+    neighborCount = std::min<int>(CACHED_NEIGHBORS, static_cast<int>(nodes.size()) - 1);
+    if (neighborCount <= 0 || distanceMatrix.empty()) {
+        neighborCount = 0;
+        return;
+    }
+    nearestNeighbors.assign(distanceMatrix.size() * neighborCount, 0);
+    std::vector<int> order;
+    for (const Node& node : nodes) {
+        const std::vector<double>& row = distanceMatrix[node.id];
+        order.clear();
+        for (const Node& other : nodes) {
+            if (other.id != node.id) order.push_back(other.id);
+        }
+        std::partial_sort(order.begin(), order.begin() + neighborCount, order.end(),
+                          [&row](int a, int b) { return row[a] < row[b] || (row[a] == row[b] && a < b); });
+        std::copy(order.begin(), order.begin() + neighborCount,
+                  nearestNeighbors.begin() + static_cast<std::size_t>(node.id) * neighborCount);
+    }
+}
+
+bool VRPLIBReader::loadCache(const std::string& cachePath, std::uint64_t sourceHash, std::uint64_t sourceSize) {
+    if (access(cachePath.c_str(), R_OK) != 0) return false;
+    // Distances are looked up in any order, so no sequential readahead
+    auto cache = std::make_shared<const MappedFile>(cachePath, false);
+    if (cache->size() < sizeof(CacheHeader)) return false;
+    CacheHeader header;
+    std::memcpy(&header, cache->data(), sizeof(header));
+    if (std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 ||
+        header.version != CACHE_VERSION || header.headerSize != sizeof(CacheHeader) ||
+        header.sourceHash != sourceHash || header.sourceSize != sourceSize) {
+        return false;
+    }
+    CacheLayout layout(header);
+    if (cache->size() != layout.total) return false;
+
+    const char* base = cache->data();
+    name.assign(base + layout.name, header.nameLength);
+    dimension = header.dimension;
+    capacity = header.capacity;
+    numVehicles = header.numVehicles;
+    depotId = header.depotId;
+    edgeWeightType = static_cast<EdgeWeightType>(header.edgeWeightType);
+
+    nodes.resize(header.nodeCount);
+    for (int i = 0; i < header.nodeCount; ++i) {
+        std::int32_t id;
+        std::memcpy(&id, base + layout.ids + sizeof(id) * i, sizeof(id));
+        nodes[i].id = id;
+        std::memcpy(&nodes[i].x, base + layout.xs + sizeof(double) * i, sizeof(double));
+        std::memcpy(&nodes[i].y, base + layout.ys + sizeof(double) * i, sizeof(double));
+    }
+    demands.resize(header.demandCount);
+    std::memcpy(demands.data(), base + layout.demands, sizeof(std::int32_t) * header.demandCount);
+
+    // The matrix stays in the mapping (the layout keeps it 8-byte aligned)
+    std::size_t rows = static_cast<std::size_t>(header.matrixRows);
+    cacheFile = cache;
+    mappedDistances = reinterpret_cast<const double*>(base + layout.matrix);
+    mappedRows = rows;
+    neighborCount = header.neighborCount;
+    nearestNeighbors.resize(rows * neighborCount);
+    std::memcpy(nearestNeighbors.data(), base + layout.neighbors, sizeof(std::int32_t) * nearestNeighbors.size());
+    return true;
+}
+
+void VRPLIBReader::writeCache(const std::string& cachePath, std::uint64_t sourceHash, std::uint64_t sourceSize) const {
+    CacheHeader header {};
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version = CACHE_VERSION;
+    header.headerSize = sizeof(CacheHeader);
+    header.sourceHash = sourceHash;
+    header.sourceSize = sourceSize;
+    header.dimension = dimension;
+    header.capacity = capacity;
+    header.numVehicles = numVehicles;
+    header.depotId = depotId;
+    header.edgeWeightType = static_cast<std::int32_t>(edgeWeightType);
+    header.nodeCount = static_cast<std::int32_t>(nodes.size());
+    header.demandCount = static_cast<std::int32_t>(demands.size());
+    header.matrixRows = static_cast<std::int32_t>(distanceMatrix.size());
+    header.neighborCount = neighborCount;
+    header.nameLength = static_cast<std::int32_t>(name.size());
+    CacheLayout layout(header);
+
+    // Written under a temporary name and renamed, so a process reading the
+    // cache never sees a partial file
+    std::string tmpPath = cachePath + ".tmp" + std::to_string(getpid());
+    std::ofstream out(tmpPath, std::ios::binary);
+    if (!out) return;
+    auto padTo = [&out](std::size_t offset) {
+        static const char zeros[8] = {};
+        std::size_t at = static_cast<std::size_t>(out.tellp());
+        if (offset > at) out.write(zeros, offset - at);
+    };
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    padTo(layout.ids);
+    for (const Node& node : nodes) {
+        std::int32_t id = node.id;
+        out.write(reinterpret_cast<const char*>(&id), sizeof(id));
+    }
+    padTo(layout.xs);
+    for (const Node& node : nodes) out.write(reinterpret_cast<const char*>(&node.x), sizeof(double));
+    for (const Node& node : nodes) out.write(reinterpret_cast<const char*>(&node.y), sizeof(double));
+    padTo(layout.demands);
+    out.write(reinterpret_cast<const char*>(demands.data()), sizeof(std::int32_t) * demands.size());
+    padTo(layout.matrix);
+    for (const std::vector<double>& row : distanceMatrix) {
+        out.write(reinterpret_cast<const char*>(row.data()), sizeof(double) * row.size());
+    }
+    out.write(reinterpret_cast<const char*>(nearestNeighbors.data()), sizeof(std::int32_t) * nearestNeighbors.size());
+    padTo(layout.name);
+    out.write(name.data(), name.size());
+    out.close();
+    if (!out || std::rename(tmpPath.c_str(), cachePath.c_str()) != 0) {
+        std::remove(tmpPath.c_str());
+    }
+}
+
 // --- Getter Implementations ---
 
 const std::string& VRPLIBReader::getName() const { return name; }
@@ -113,4 +606,27 @@ int VRPLIBReader::getNumVehicles() const { return numVehicles; }
 const std::vector<Node>& VRPLIBReader::getNodes() const { return nodes; }
 const std::vector<int>& VRPLIBReader::getDemands() const { return demands; }
 int VRPLIBReader::getDepotId() const { return depotId; }
-const std::vector<std::vector<double>>& VRPLIBReader::getDistanceMatrix() const { return distanceMatrix; }
\ No newline at end of file
+const std::vector<std::vector<double>>& VRPLIBReader::getDistanceMatrix() const {
+    if (distanceMatrix.empty() && mappedDistances) {
+        distanceMatrix.assign(mappedRows, std::vector<double>(mappedRows));
+        for (std::size_t i = 0; i < mappedRows; ++i) {
+            std::memcpy(distanceMatrix[i].data(), mappedDistances + mappedRows * i, sizeof(double) * mappedRows);
+        }
+    }
+    return distanceMatrix;
+}
+bool VRPLIBReader::hasDistanceMatrix() const { return !distanceMatrix.empty() || mappedDistances; }
+std::shared_ptr<const double> VRPLIBReader::getMappedDistances() const {
+    if (!cacheFile) return {};
+    return std::shared_ptr<const double>(cacheFile, mappedDistances);
+}
+void VRPLIBReader::releaseDistanceMatrix() {
+    std::vector<std::vector<double>>().swap(distanceMatrix);
+    cacheFile.reset();
+    mappedDistances = nullptr;
+    mappedRows = 0;
+}
+EdgeWeightType VRPLIBReader::getEdgeWeightType() const { return edgeWeightType; }
+const std::vector<int>& VRPLIBReader::getNearestNeighbors() const { return nearestNeighbors; }
+int VRPLIBReader::getNeighborCount() const { return neighborCount; }
+bool VRPLIBReader::isFromCache() const { return fromCache; }
\ No newline at end of file
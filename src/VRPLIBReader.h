@@ -1,9 +1,13 @@
 #ifndef VRPLIB_READER_H
 #define VRPLIB_READER_H
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
+class MappedFile;
+
 // A structure to represent a node (customer or depot)
 struct Node {
     int id;
@@ -11,10 +15,32 @@ struct Node {
     double y;
 };
 
+// How the distances are given (EDGE_WEIGHT_TYPE). Coordinate types follow
+// TSPLIB, except EUC_2D, which keeps the real (unrounded) distance.
+enum class EdgeWeightType { Euc2D, Ceil2D, Att, Geo, Explicit };
+
+// Layout of an EXPLICIT EDGE_WEIGHT_SECTION (EDGE_WEIGHT_FORMAT)
+enum class EdgeWeightFormat { FullMatrix, UpperRow, LowerRow, UpperDiagRow, LowerDiagRow };
+
+// Whether the reader builds the (dimension + 1)^2 distance matrix. With
+// OnDemand, EUC_2D and CEIL_2D instances keep only the coordinates, for
+// solvers that compute distances on the fly; other types are still dense.
+enum class DistanceStorage { Dense, OnDemand };
+
 class VRPLIBReader {
 public:
     // Constructor that takes the path to the VRPLIB file
     explicit VRPLIBReader(const std::string& filePath);
+    VRPLIBReader(const std::string& filePath, DistanceStorage storage);
+
+    // Same, backed by a binary cache in cacheDir (created if needed). The
+    // cache file is keyed by a hash of the VRPLIB file, so an edited file
+    // gets a new entry. It holds the parsed data, the distance matrix and
+    // the nearest neighbor lists; loading it skips parsing and the O(n^2)
+    // matrix computation, and the matrix is not copied: it is served from
+    // the mapped cache file (getMappedDistances). Cache write errors are
+    // ignored.
+    VRPLIBReader(const std::string& filePath, const std::string& cacheDir);
 
     // --- Getter methods to access the parsed data ---
 
@@ -25,7 +51,28 @@ public:
     const std::vector<Node>& getNodes() const;
     const std::vector<int>& getDemands() const;
     int getDepotId() const;
+    // Empty when the instance was read with DistanceStorage::OnDemand and
+    // its distances come from coordinates. After a cache hit it is copied
+    // out of the mapping on the first call, so callers that can take a flat
+    // block should use getMappedDistances() instead.
     const std::vector<std::vector<double>>& getDistanceMatrix() const;
+    bool hasDistanceMatrix() const;
+    // After a cache hit: the same ID-indexed matrix, row by row,
+    // (getDimension() + 1)^2 values read straight from the mapped cache
+    // file. The file stays mapped while the pointer lives. Empty otherwise.
+    std::shared_ptr<const double> getMappedDistances() const;
+    // Frees the matrix (or drops the reader's hold on the mapped one) once
+    // it was copied into a compact format; afterwards hasDistanceMatrix()
+    // is false
+    void releaseDistanceMatrix();
+    EdgeWeightType getEdgeWeightType() const;
+
+    // Nearest neighbors of each node ID (excluding itself), closest first:
+    // row id holds getNeighborCount() IDs. Only filled when a cache is used.
+    const std::vector<int>& getNearestNeighbors() const;
+    int getNeighborCount() const;
+    // True if the data came from an existing cache file
+    bool isFromCache() const;
 
 private:
     // --- Member variables to store instance data ---
@@ -35,17 +82,36 @@ private:
     int capacity {0};
     int numVehicles {0}; // Note: Some instances might not specify this
     int depotId {0};
+    EdgeWeightType edgeWeightType {EdgeWeightType::Euc2D};
+    EdgeWeightFormat edgeWeightFormat {EdgeWeightFormat::FullMatrix};
+    DistanceStorage storage {DistanceStorage::Dense};
     std::vector<Node> nodes;
     std::vector<int> demands;
-    std::vector<std::vector<double>> distanceMatrix;
+    // Mutable: after a cache hit it is only filled (from the mapping) when
+    // someone asks for it
+    mutable std::vector<std::vector<double>> distanceMatrix;
+    std::shared_ptr<const MappedFile> cacheFile;
+    const double* mappedDistances {nullptr};
+    std::size_t mappedRows {0};
+    std::vector<int> nearestNeighbors;
+    int neighborCount {0};
+    bool fromCache {false};
 
     // --- Private helper methods for parsing and computation ---
 
-    // Main parsing method, called by the constructor
-    void parse(const std::string& filePath);
+    // Main parsing method, called by the constructors on the mapped file.
+    // It tokenizes the buffer in place, parsing numbers with std::from_chars.
+    void parse(const char* begin, const char* end, const std::string& filePath);
+
+    // Binary cache (.cvrpbin); see the format in VRPLIBReader.cpp
+    bool loadCache(const std::string& cachePath, std::uint64_t sourceHash, std::uint64_t sourceSize);
+    void writeCache(const std::string& cachePath, std::uint64_t sourceHash, std::uint64_t sourceSize) const;
+    void computeNearestNeighbors();
 
-    // Computes the Euclidean distance matrix after parsing node coordinates
+    // Computes the distance matrix from the node coordinates, according to
+    // the edge weight type. EXPLICIT matrices are filled while parsing.
     void computeDistanceMatrix();
+    bool fillEuclideanMatrix();
 };
 
 #endif // VRPLIB_READER_H
\ No newline at end of file
@@ -1,15 +1,23 @@
 #include "Cliente.h"
 #include "HeuristicaClarkeWright.h"
 #include "HeuristicaInsercionCercana.h"
+#include "InstanciaCompacta.h"
+#include "CriterioParada.h"
 #include "GRASP.h"
+#include "GeneradorAleatorio.h"
 #include "OperadorRelocate.h"
 #include "OperadorSwap.h"
+#include "Portafolio.h"
+#include "SimulatedAnnealing.h"
+#include "TabuSearch.h"
 #include "Ruta.h"
 #include "Solucion.h"
 #include "VRPLIBReader.h"
 
 #include <chrono>
+#include <cstdint>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -34,12 +42,46 @@ void printRoutesIfDesired(const Solucion &sol) {
     }
 }
 
+// La matriz del lector está indexada por id; las heurísticas con id2pos la
+// esperan indexada por posición (depósito 0, clientes[i] en i+1)
+vector<vector<double>> matrizPorPosicion(const vector<Cliente>& clientes,
+                                         const vector<vector<double>>& dist,
+                                         int depot) {
+    size_t n = clientes.size() + 1;
+    vector<vector<double>> distPos(n, vector<double>(n, 0.0));
+    for (size_t i = 0; i < n; ++i) {
+        int idI = (i == 0) ? depot : clientes[i-1].getId();
+        for (size_t j = 0; j < n; ++j) {
+            int idJ = (j == 0) ? depot : clientes[j-1].getId();
+            distPos[i][j] = dist[idI][idJ];
+        }
+    }
+    return distPos;
+}
+
+// Instancia por posición para las metaheurísticas: la matriz por posición
+// es la única copia; las distancias por ID son las del lector, sin copiar
+shared_ptr<const InstanciaCompacta> instanciaPorPosicion(const vector<Cliente>& clientes,
+                                                         const vector<vector<double>>& dist,
+                                                         int cap, int depot, int numVeh) {
+    unordered_map<int,int> id2pos;
+    id2pos[depot] = 0;
+    for (size_t i = 0; i < clientes.size(); ++i)
+        id2pos[clientes[i].getId()] = i+1;
+    auto distPos = make_shared<const vector<vector<double>>>(
+        matrizPorPosicion(clientes, dist, depot));
+    return make_shared<const InstanciaCompacta>(
+        clientes, make_shared<const ProveedorDistancias>(distPos),
+        make_shared<const ProveedorDistancias>(dist), id2pos, cap, depot, numVeh);
+}
+
 // Corre Clarke & Wright y devuelve la solución, imprimiendo costo, rutas y tiempo
 Solucion runClarkeWright(const vector<Cliente>& clientes,
                          const vector<vector<double>>& dist,
                          int cap, int depot, int numVeh) {
     auto t0 = Clock::now();
-    HeuristicaClarkeWright hw(clientes, dist, cap, depot, numVeh);
+    HeuristicaClarkeWright hw(clientes, make_shared<const ProveedorDistancias>(dist),
+                              cap, depot, numVeh);
     Solucion sol = hw.resolver();
     double dt = chrono::duration<double>(Clock::now() - t0).count();
     if(sol.esFactible() && sol.vistoTodos()){
@@ -58,12 +100,8 @@ Solucion runNearestInsertion(const vector<Cliente>& clientes,
                              const vector<vector<double>>& dist,
                              int cap, int depot, int numVeh) {
     auto t0 = Clock::now();
-    unordered_map<int,int> id2pos;
-    id2pos[depot] = 0;
-    for (size_t i = 0; i < clientes.size(); ++i)
-        id2pos[clientes[i].getId()] = i+1;
-
-    HeuristicaInsercionCercana hic(clientes, dist, id2pos, cap, depot, numVeh);
+    HeuristicaInsercionCercana hic(clientes, make_shared<const ProveedorDistancias>(dist),
+                                   cap, depot, numVeh);
     Solucion sol = hic.resolver();
     double dt = chrono::duration<double>(Clock::now() - t0).count();
     if(sol.esFactible() && sol.vistoTodos()){
@@ -80,22 +118,31 @@ Solucion runNearestInsertion(const vector<Cliente>& clientes,
 // Corre GRASP
 Solucion runGRASP(const vector<Cliente>& clientes,
                   const vector<vector<double>>& dist,
-                  int cap, int depot, int numVeh) {
+                  int cap, int depot, int numVeh, uint64_t semilla, int hilos) {
     cout << "Ingrese número de iteraciones GRASP: "; int it; cin >> it;
-    cout << "Ingrese tamaño RCL (k): ";             int k;  cin >> k;
-    unordered_map<int,int> id2pos;
-    id2pos[depot] = 0;
-    for (size_t i = 0; i < clientes.size(); ++i)
-        id2pos[clientes[i].getId()] = i+1;
+    cout << "Ingrese tamaño RCL (k, 0 = reactivo): "; int k;  cin >> k;
+    cout << "Límite de tiempo en segundos (0 = sin límite): ";
+    CriterioParada criterio;
+    cin >> criterio.limiteTiempo;
+    shared_ptr<const InstanciaCompacta> inst =
+        instanciaPorPosicion(clientes, dist, cap, depot, numVeh);
 
     auto t0 = Clock::now();
-    GRASP g(clientes, dist, id2pos, cap, depot, numVeh, it, k);
+    GRASP g(inst, nullptr, it, k, semilla);
+    g.setNumHilos(hilos);
+    g.setCriterioParada(criterio);
+    g.setDetectarDuplicados(true);
+    if (k <= 0)
+        g.setReactivo({1, 2, 3, 5, 8});
     Solucion sol = g.resolver();
     double dt = chrono::duration<double>(Clock::now() - t0).count();
     if(sol.esFactible() && sol.vistoTodos()){
       cout << "[GRASP] Costo=" << sol.getCostoTotal()
            << "  Rutas=" << sol.getRutas().size()
-           << "  Tiempo=" << dt << "s\n";
+           << "  Tiempo=" << dt << "s"
+           << "  Iteraciones=" << g.getIteracionesRealizadas()
+           << "  Repetidas=" << g.getIteracionesOmitidas()
+           << "  Semilla=" << semilla << "\n";
     }
     else{
       cout << "La meta-heuristica no encontro una solución factible. Por favor intentar con otra heuristica." << endl;
@@ -103,6 +150,102 @@ Solucion runGRASP(const vector<Cliente>& clientes,
     return sol;
 }
 
+// Corre recocido simulado
+Solucion runSimulatedAnnealing(const vector<Cliente>& clientes,
+                               const vector<vector<double>>& dist,
+                               int cap, int depot, int numVeh, uint64_t semilla) {
+    cout << "Límite de tiempo en segundos (0 = un ciclo de enfriamiento): ";
+    CriterioParada criterio;
+    cin >> criterio.limiteTiempo;
+    shared_ptr<const InstanciaCompacta> inst =
+        instanciaPorPosicion(clientes, dist, cap, depot, numVeh);
+
+    auto t0 = Clock::now();
+    SimulatedAnnealing sa(inst, semilla);
+    sa.setCriterioParada(criterio);
+    Solucion sol = sa.resolver();
+    double dt = chrono::duration<double>(Clock::now() - t0).count();
+    if(sol.esFactible() && sol.vistoTodos()){
+      cout << "[Recocido simulado] Costo=" << sol.getCostoTotal()
+           << "  Rutas=" << sol.getRutas().size()
+           << "  Tiempo=" << dt << "s"
+           << "  Movimientos=" << sa.getMovimientosRealizados()
+           << "  Semilla=" << semilla << "\n";
+    }
+    else{
+      cout << "El recocido simulado no encontro una solución factible. Por favor intentar con otra heuristica." << endl;
+    }
+    return sol;
+}
+
+// Corre búsqueda tabú
+Solucion runTabuSearch(const vector<Cliente>& clientes,
+                       const vector<vector<double>>& dist,
+                       int cap, int depot, int numVeh, uint64_t semilla) {
+    cout << "Límite de tiempo en segundos (0 = hasta estancarse): ";
+    CriterioParada criterio;
+    cin >> criterio.limiteTiempo;
+    shared_ptr<const InstanciaCompacta> inst =
+        instanciaPorPosicion(clientes, dist, cap, depot, numVeh);
+
+    auto t0 = Clock::now();
+    TabuSearch ts(inst, semilla);
+    ts.setCriterioParada(criterio);
+    Solucion sol = ts.resolver();
+    double dt = chrono::duration<double>(Clock::now() - t0).count();
+    if(sol.esFactible() && sol.vistoTodos()){
+      cout << "[Tabú] Costo=" << sol.getCostoTotal()
+           << "  Rutas=" << sol.getRutas().size()
+           << "  Tiempo=" << dt << "s"
+           << "  Iteraciones=" << ts.getIteracionesRealizadas()
+           << "  It/s=" << ts.getIteracionesPorSegundo()
+           << "  Semilla=" << semilla << "\n";
+    }
+    else{
+      cout << "La búsqueda tabú no encontro una solución factible. Por favor intentar con otra heuristica." << endl;
+    }
+    return sol;
+}
+
+// Corre C&W, Inserción Más Cercana y GRASP a la vez, hasta el objetivo o
+// el límite de tiempo
+Solucion runPortfolio(const vector<Cliente>& clientes,
+                      const vector<vector<double>>& dist,
+                      int cap, int depot, int numVeh, uint64_t semilla, int hilos) {
+    CriterioParada criterio;
+    cout << "Límite de tiempo en segundos (0 = sin límite): ";
+    cin >> criterio.limiteTiempo;
+    cout << "Costo objetivo (-1 = sin objetivo): ";
+    cin >> criterio.costoObjetivo;
+    shared_ptr<const InstanciaCompacta> inst =
+        instanciaPorPosicion(clientes, dist, cap, depot, numVeh);
+
+    auto t0 = Clock::now();
+    Portafolio p(inst, semilla);
+    p.setNumHilos(hilos);
+    p.setCriterioParada(criterio);
+    Solucion sol = p.resolver();
+    double dt = chrono::duration<double>(Clock::now() - t0).count();
+    for (const Portafolio::Resultado& r : p.getResultados()) {
+        cout << "  " << r.nombre << ": ";
+        if (r.costo >= 0) cout << "Costo=" << r.costo;
+        else              cout << "sin solución";
+        cout << "  Tiempo=" << r.segundos << "s"
+             << (r.cancelado ? "  (cancelada)" : "") << "\n";
+    }
+    if(sol.esFactible() && sol.vistoTodos()){
+      cout << "[Portafolio] Costo=" << sol.getCostoTotal()
+           << "  Rutas=" << sol.getRutas().size()
+           << "  Tiempo=" << dt << "s"
+           << "  Ganadora=" << p.getGanador()
+           << "  Semilla=" << semilla << "\n";
+    }
+    else{
+      cout << "Ninguna heuristica del portafolio encontro una solución factible." << endl;
+    }
+    return sol;
+}
+
 // Menú de operadores de búsqueda local
 void localSearchMenu(const Solucion &baseSol, const string &nombre) {
     double origCost = baseSol.getCostoTotal();
@@ -164,9 +307,21 @@ void localSearchMenu(const Solucion &baseSol, const string &nombre) {
 }
 
 int main(int argc, char* argv[]) {
+  // Argumentos: [ruta] [--seed N] [--threads N]
   string path;
-  if (argc > 1) {
-      path = argv[1];
+  uint64_t semilla = GeneradorAleatorio::semillaAleatoria();
+  int hilos = 0;  // 0: todos los núcleos
+  for (int i = 1; i < argc; ++i) {
+      string arg = argv[i];
+      if (arg == "--seed" && i + 1 < argc) {
+          semilla = stoull(argv[++i]);
+      } else if (arg == "--threads" && i + 1 < argc) {
+          hilos = stoi(argv[++i]);
+      } else {
+          path = arg;
+      }
+  }
+  if (!path.empty()) {
       cout << "Usando archivo de instancia: " << path << endl;
   } else {
       cout << "Ingrese ruta al archivo VRP: ";
@@ -184,7 +339,7 @@ int main(int argc, char* argv[]) {
           clientes.emplace_back(n.id, reader.getDemands()[n.id]);
       }
 
-      auto dist    = reader.getDistanceMatrix();
+      const auto &dist = reader.getDistanceMatrix();
       int cap      = reader.getCapacity();
       int depot    = reader.getDepotId();
       int numVehic = reader.getNumVehicles();
@@ -195,28 +350,41 @@ int main(int argc, char* argv[]) {
              << "1. Clarke & Wright\n"
              << "2. Inserción Más Cercana\n"
              << "3. GRASP\n"
-             << "4. Salir\n"
+             << "4. Recocido simulado\n"
+             << "5. Búsqueda tabú\n"
+             << "6. Portafolio (todas en paralelo)\n"
+             << "7. Salir\n"
              << "Seleccione: ";
         int h; cin >> h;
         cin.ignore();
 
-        if (h == 4) {
+        if (h == 7) {
           terminar = true;
           continue;
         }
 
+        // Como en el menú original, cualquier otra opción corre GRASP
         Solucion sol = (h==1)
           ? runClarkeWright     (clientes, dist, cap, depot, numVehic)
           : (h==2)
           ? runNearestInsertion (clientes, dist, cap, depot, numVehic)
+          : (h==4)
+          ? runSimulatedAnnealing(clientes, dist, cap, depot, numVehic, semilla)
+          : (h==5)
+          ? runTabuSearch       (clientes, dist, cap, depot, numVehic, semilla)
+          : (h==6)
+          ? runPortfolio        (clientes, dist, cap, depot, numVehic, semilla, hilos)
           : /* h==3 */
-            runGRASP            (clientes, dist, cap, depot, numVehic);
+            runGRASP            (clientes, dist, cap, depot, numVehic, semilla, hilos);
 
         // Only proceed if the solution is feasible and all clients are visited
         if (sol.esFactible() && sol.vistoTodos()) {
             printRoutesIfDesired(sol);
             string name = (h==1 ? "Clarke&Wright"
                          : h==2 ? "Inserción Cercana"
+                         : h==4 ? "Recocido simulado"
+                         : h==5 ? "Búsqueda tabú"
+                         : h==6 ? "Portafolio"
                                 : "GRASP");
             localSearchMenu(sol, name);
         } else {
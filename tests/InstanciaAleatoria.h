@@ -0,0 +1,38 @@
+#ifndef INSTANCIA_ALEATORIA_H
+#define INSTANCIA_ALEATORIA_H
+
+#include "../src/Cliente.h"
+#include "../src/GeneradorAleatorio.h"
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// n clientes al azar en un cuadrado de 100x100, depósito (ID 1) en el
+// centro, con demandas entre 1 y demandaMax. Las distancias son euclídeas
+// sin redondear e indexadas por posición: el depósito en 0 y el cliente
+// con ID i + 2 en i + 1.
+inline void instanciaAleatoria(vector<Cliente>& clientes,
+                               vector<vector<double>>& distMatrix,
+                               unordered_map<int,int>& id2pos,
+                               int n = 30, uint64_t semilla = 42, int demandaMax = 9) {
+    GeneradorAleatorio rng(semilla);
+    vector<pair<double,double>> coords = {{50, 50}};
+    for (int i = 0; i < n; ++i)
+        coords.push_back({rng.real01() * 100, rng.real01() * 100});
+    distMatrix.assign(n + 1, vector<double>(n + 1, 0.0));
+    for (int i = 0; i <= n; ++i)
+        for (int j = 0; j <= n; ++j)
+            distMatrix[i][j] = hypot(coords[i].first - coords[j].first,
+                                     coords[i].second - coords[j].second);
+    id2pos[1] = 0;
+    for (int i = 0; i < n; ++i) {
+        clientes.emplace_back(i + 2, 1 + rng.enteroEn(demandaMax));
+        id2pos[i + 2] = i + 1;
+    }
+}
+
+#endif
@@ -0,0 +1,92 @@
+#include "catch.hpp"
+#include "../src/ALNS.h"
+#include "../src/HeuristicaInsercionCercana.h"
+#include "../src/GeneradorAleatorio.h"
+#include "../src/Cliente.h"
+#include "../src/Solucion.h"
+#include "InstanciaAleatoria.h"
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+using namespace std;
+
+TEST_CASE("ALNS: factible y mejor que la inserción cercana", "[ALNS]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    HeuristicaInsercionCercana ni(clientes, distMatrix, id2pos, 40, 1, 8);
+    Solucion inicial = ni.resolver();
+
+    ALNS alns(clientes, distMatrix, id2pos, 40, 1, 8, 5);
+    Solucion sol = alns.resolver();
+    REQUIRE(alns.getIteracionesRealizadas() == 100 * 30);
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(sol.esFactible());
+    REQUIRE(sol.getRutas().size() <= 8);
+    REQUIRE(sol.getCostoTotal() < inicial.getCostoTotal());
+    REQUIRE(sol.getCostoTotal() == Approx(alns.getMejorCosto()));
+
+    REQUIRE(alns.getNombresDestruccion() ==
+            vector<string>({"aleatoria", "peor-costo", "relacionada", "ruta"}));
+    REQUIRE(alns.getNombresReparacion() ==
+            vector<string>({"greedy", "regret-2", "regret-3", "cercana"}));
+    for (double peso : alns.getPesosDestruccion()) REQUIRE(peso > 0);
+    for (double peso : alns.getPesosReparacion()) REQUIRE(peso > 0);
+}
+
+TEST_CASE("ALNS: misma semilla, misma solución", "[ALNS]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    ALNS x(clientes, distMatrix, id2pos, 40, 1, 8, 23);
+    ALNS y(clientes, distMatrix, id2pos, 40, 1, 8, 23);
+    x.setMaxIteraciones(800);
+    y.setMaxIteraciones(800);
+    x.setSegmento(50, 0.2);
+    y.setSegmento(50, 0.2);
+    Solucion sx = x.resolver();
+    Solucion sy = y.resolver();
+    REQUIRE(sx.esFactible());
+    REQUIRE(sx.getCostoTotal() == sy.getCostoTotal());
+    REQUIRE(x.getPesosDestruccion() == y.getPesosDestruccion());
+    REQUIRE(x.getPesosReparacion() == y.getPesosReparacion());
+}
+
+TEST_CASE("ALNS: operadores propios", "[ALNS]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    ALNS alns(clientes, distMatrix, id2pos, 40, 1, 8, 2);
+    alns.quitarOperadores();
+    REQUIRE_THROWS_AS(alns.resolver(), logic_error);
+
+    // Quita los primeros clientes de la primera ruta no vacía y no repara:
+    // el marco los ubica igual
+    long llamadas = 0;
+    alns.agregarDestruccion("prefijo", [&](EdicionSolucion& ed, int cantidad, GeneradorAleatorio&) {
+        llamadas++;
+        const SolucionCompacta& sol = ed.getSolucion();
+        for (int r = 0; r < sol.getCantRutas(); ++r) {
+            while (!sol.getRuta(r).empty() && static_cast<int>(ed.getQuitados().size()) < cantidad)
+                ed.quitar(sol.getRuta(r).front());
+            if (static_cast<int>(ed.getQuitados().size()) >= cantidad) break;
+        }
+    });
+    REQUIRE(alns.agregarReparacion("nada", [](EdicionSolucion&, GeneradorAleatorio&) {}) == 0);
+    alns.setCantidadQuitada(2, 5);
+    alns.setMaxIteraciones(300);
+    Solucion sol = alns.resolver();
+    REQUIRE(llamadas == 300);
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(sol.esFactible());
+    REQUIRE(alns.getNombresDestruccion() == vector<string>({"prefijo"}));
+}
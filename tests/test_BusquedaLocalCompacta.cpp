@@ -0,0 +1,92 @@
+#include "catch.hpp"
+#include "../src/BusquedaLocalCompacta.h"
+#include "../src/InstanciaCompacta.h"
+#include "../src/SolucionCompacta.h"
+#include "../src/ListaVecinos.h"
+#include "../src/Cliente.h"
+#include "InstanciaAleatoria.h"
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+// Rutas en el orden de los índices, de a 5 clientes
+static vector<vector<int>> rutasEnOrden(int n) {
+    vector<vector<int>> rutas;
+    for (int pos = 1; pos <= n; ++pos) {
+        if ((pos - 1) % 5 == 0) rutas.emplace_back();
+        rutas.back().push_back(pos);
+    }
+    return rutas;
+}
+
+TEST_CASE("BusquedaLocalCompacta: llega a un óptimo local factible", "[BusquedaLocalCompacta]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos, 25, 17, 5);
+    InstanciaCompacta inst(clientes, distMatrix, id2pos, 20, 1, 6);
+    ListaVecinos vecinos(distMatrix, inst.getCantPos());  // listas completas
+
+    SolucionCompacta sol(inst, rutasEnOrden(25));
+    sol.completar();
+    double antes = sol.getCosto();
+    BusquedaLocalCompacta bl(inst, vecinos);
+    bl.mejorar(sol);
+
+    REQUIRE(sol.getCosto() < antes);
+    REQUIRE(sol.esFactible());
+    REQUIRE(bl.getMovimientosAplicados() > 0);
+    SolucionCompacta recalculada(inst, sol.getRutas());
+    REQUIRE(sol.getCosto() == Approx(recalculada.getCosto()));
+
+    // Con vecindarios completos no queda ningún 2-opt ni intercambio que mejore
+    for (int r1 = 0; r1 < sol.getCantRutas(); ++r1) {
+        int largo1 = static_cast<int>(sol.getRuta(r1).size());
+        for (int i = 0; i < largo1; ++i) {
+            for (int j = i + 1; j < largo1; ++j)
+                REQUIRE(sol.deltaInvertir(r1, i, j) > -1e-6);
+            for (int r2 = r1 + 1; r2 < sol.getCantRutas(); ++r2) {
+                for (int k = 0; k < static_cast<int>(sol.getRuta(r2).size()); ++k) {
+                    int a = sol.getRuta(r1)[i], b = sol.getRuta(r2)[k];
+                    int diferencia = inst.getDemanda(b) - inst.getDemanda(a);
+                    if (sol.getCarga(r1) + diferencia > 20 || sol.getCarga(r2) - diferencia > 20)
+                        continue;
+                    REQUIRE(sol.deltaIntercambiar(r1, i, r2, k) > -1e-6);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("BusquedaLocalCompacta: revisar sólo rutas tocadas", "[BusquedaLocalCompacta]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos, 25, 17, 5);
+    InstanciaCompacta inst(clientes, distMatrix, id2pos, 20, 1, 6);
+    ListaVecinos vecinos(distMatrix, inst.getCantPos(), 10);
+    BusquedaLocalCompacta bl(inst, vecinos);
+
+    SolucionCompacta sol(inst, rutasEnOrden(25));
+    sol.completar();
+    bl.mejorar(sol);
+    double optimo = sol.getCosto();
+
+    // Sin rutas tocadas no se hace nada
+    bl.mejorar(sol, {});
+    REQUIRE(sol.getCosto() == optimo);
+
+    // Desordenar una ruta y revisar sólo esa: vuelve a ser a lo sumo tan cara
+    int r = sol.getRutaDe(inst.getPosClientes()[0]);
+    vector<int> ruta = sol.getRuta(r);
+    reverse(ruta.begin(), ruta.end() - 1);
+    sol.reemplazarRuta(r, ruta);
+    bl.mejorar(sol, {r});
+    REQUIRE(sol.esFactible());
+    SolucionCompacta recalculada(inst, sol.getRutas());
+    REQUIRE(sol.getCosto() == Approx(recalculada.getCosto()));
+    REQUIRE(sol.getCosto() <= optimo + 1e-6);
+}
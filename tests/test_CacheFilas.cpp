@@ -0,0 +1,30 @@
+#include "catch.hpp"
+#include "../src/CacheFilas.h"
+#include <vector>
+
+using namespace std;
+
+TEST_CASE("CacheFilas: desaloja la fila usada hace más tiempo", "[CacheFilas]") {
+    ProveedorDistancias coordenadas({0, 1, 2, 3}, {0, 0, 0, 0});
+    CacheFilas cache(coordenadas, 2);
+
+    REQUIRE(cache.fila(0)[3] == 3);
+    REQUIRE(cache.fila(1)[3] == 2);
+    REQUIRE(cache.fila(0)[1] == 1);  // acierto: la 1 pasa a ser la más vieja
+    REQUIRE(cache.getAciertos() == 1);
+    REQUIRE(cache.getFallos() == 2);
+
+    REQUIRE(cache.fila(2)[0] == 2);  // desaloja la 1
+    REQUIRE(cache.fila(0)[2] == 2);
+    REQUIRE(cache.getAciertos() == 2);
+    REQUIRE(cache.fila(1)[0] == 1);  // vuelve a calcularse
+    REQUIRE(cache.getFallos() == 4);
+}
+
+TEST_CASE("CacheFilas: con un proveedor denso devuelve la fila de la matriz", "[CacheFilas]") {
+    vector<vector<double>> matriz = {{0, 2}, {2, 0}};
+    ProveedorDistancias densa(matriz);
+    CacheFilas cache(densa, 1);
+    REQUIRE(cache.fila(1) == matriz[1].data());
+    REQUIRE(cache.getFallos() == 0);
+}
@@ -0,0 +1,76 @@
+#include "catch.hpp"
+#include "../src/ColaAcotada.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+TEST_CASE("ColaAcotada: FIFO y límites", "[ColaAcotada]") {
+    ColaAcotada<int> cola(3);
+    REQUIRE(cola.getCapacidad() == 4);
+    int v = 0;
+    REQUIRE_FALSE(cola.intentarDesencolar(v));
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(cola.intentarEncolar(int(i)));
+    }
+    REQUIRE_FALSE(cola.intentarEncolar(99));
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(cola.intentarDesencolar(v));
+        REQUIRE(v == i);
+    }
+    REQUIRE_FALSE(cola.intentarDesencolar(v));
+    // Después de dar la vuelta sigue funcionando
+    REQUIRE(cola.intentarEncolar(7));
+    REQUIRE(cola.intentarDesencolar(v));
+    REQUIRE(v == 7);
+}
+
+TEST_CASE("ColaAcotada: varios productores y consumidores", "[ColaAcotada]") {
+    const int PRODUCTORES = 3, CONSUMIDORES = 3, POR_PRODUCTOR = 20000;
+    ColaAcotada<int> cola(16);
+    atomic<int> productoresActivos(PRODUCTORES);
+    vector<long long> sumas(CONSUMIDORES, 0);
+    vector<int> cantidades(CONSUMIDORES, 0);
+
+    vector<thread> hilos;
+    for (int p = 0; p < PRODUCTORES; ++p) {
+        hilos.emplace_back([&, p]() {
+            for (int i = 0; i < POR_PRODUCTOR; ++i) {
+                int valor = p * POR_PRODUCTOR + i;
+                while (!cola.intentarEncolar(move(valor)))
+                    this_thread::yield();
+            }
+            productoresActivos--;
+        });
+    }
+    for (int c = 0; c < CONSUMIDORES; ++c) {
+        hilos.emplace_back([&, c]() {
+            int v;
+            while (true) {
+                if (cola.intentarDesencolar(v)) {
+                    sumas[c] += v;
+                    cantidades[c]++;
+                } else if (productoresActivos.load() == 0) {
+                    if (!cola.intentarDesencolar(v))
+                        break;
+                    sumas[c] += v;
+                    cantidades[c]++;
+                } else {
+                    this_thread::yield();
+                }
+            }
+        });
+    }
+    for (thread& t : hilos) t.join();
+
+    long long total = 0;
+    int cantidad = 0;
+    for (int c = 0; c < CONSUMIDORES; ++c) {
+        total += sumas[c];
+        cantidad += cantidades[c];
+    }
+    long long n = static_cast<long long>(PRODUCTORES) * POR_PRODUCTOR;
+    REQUIRE(cantidad == n);
+    REQUIRE(total == n * (n - 1) / 2);
+}
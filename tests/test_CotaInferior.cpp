@@ -0,0 +1,122 @@
+#include "catch.hpp"
+#include "../src/CotaInferior.h"
+#include "../src/ParticionConjuntos.h"
+#include "../src/PoolRutas.h"
+#include "../src/OptimizadorRuta.h"
+#include "../src/InstanciaCompacta.h"
+#include "../src/GRASP.h"
+#include "../src/Cliente.h"
+#include "InstanciaAleatoria.h"
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+
+// Óptimo exacto: todas las rutas factibles en orden óptimo y partición de
+// conjuntos sobre ellas (-1 si la flota no alcanza)
+static double optimo(const InstanciaCompacta& inst) {
+    const vector<int>& pos = inst.getPosClientes();
+    const int n = static_cast<int>(pos.size());
+    OptimizadorRuta optimizador(inst);
+    PoolRutas pool(inst, 1 << n);
+    for (int mascara = 1; mascara < (1 << n); ++mascara) {
+        vector<int> ruta;
+        int carga = 0;
+        for (int i = 0; i < n; ++i) {
+            if (mascara & (1 << i)) {
+                ruta.push_back(pos[i]);
+                carga += inst.getDemanda(pos[i]);
+            }
+        }
+        if (carga > inst.getCapacidad())
+            continue;
+        optimizador.optimizar(ruta);
+        pool.agregar(ruta);
+    }
+    ParticionConjuntos particion(inst);
+    particion.setMaxNodos(100000000);
+    vector<vector<int>> rutas;
+    bool encontrada = particion.resolver(pool, numeric_limits<double>::max(), rutas);
+    REQUIRE(particion.fueCompleta());
+    if (!encontrada)
+        return -1;
+    double costo = 0;
+    for (const vector<int>& ruta : rutas) {
+        int prev = inst.getPosDeposito();
+        for (int p : ruta) {
+            costo += inst.dist(prev, p);
+            prev = p;
+        }
+        costo += inst.dist(prev, inst.getPosDeposito());
+    }
+    return costo;
+}
+
+TEST_CASE("CotaInferior: vehículos por bin packing", "[CotaInferior]") {
+    vector<vector<double>> distMatrix(4, vector<double>(4, 1.0));
+    unordered_map<int,int> id2pos = {{1, 0}, {2, 1}, {3, 2}, {4, 3}};
+    // Tres demandas de 6 con capacidad 10: la suma pide 2, pero no entran
+    // dos en un mismo vehículo
+    vector<Cliente> clientes = {Cliente(2, 6), Cliente(3, 6), Cliente(4, 6)};
+    InstanciaCompacta inst(clientes, distMatrix, id2pos, 10, 1, 3);
+    CotaInferior cota(inst);
+    cota.calcular();
+    REQUIRE(cota.getVehiculosMinimos() == 3);
+
+    vector<Cliente> chicos = {Cliente(2, 3), Cliente(3, 3), Cliente(4, 3)};
+    InstanciaCompacta instChicos(chicos, distMatrix, id2pos, 10, 1, 3);
+    CotaInferior cotaChicos(instChicos);
+    cotaChicos.calcular();
+    REQUIRE(cotaChicos.getVehiculosMinimos() == 1);
+}
+
+TEST_CASE("CotaInferior: nunca supera al óptimo", "[CotaInferior]") {
+    for (uint64_t semilla = 1; semilla <= 6; ++semilla) {
+        vector<Cliente> clientes;
+        vector<vector<double>> distMatrix;
+        unordered_map<int,int> id2pos;
+        instanciaAleatoria(clientes, distMatrix, id2pos, 9, semilla);
+        for (int capacidad : {15, 25, 100}) {
+            InstanciaCompacta inst(clientes, distMatrix, id2pos, capacidad, 1, 9);
+            CotaInferior cota(inst);
+            cota.calcular();
+            double opt = optimo(inst);
+            REQUIRE(cota.getCotaCosto() > 0);
+            REQUIRE(cota.getCotaCosto() <= opt + 1e-6);
+            REQUIRE(cota.brecha(opt) >= -1e-6);
+
+            // Con la flota justa el grado del depósito es exacto
+            InstanciaCompacta justa(clientes, distMatrix, id2pos, capacidad, 1,
+                                    cota.getVehiculosMinimos());
+            CotaInferior cotaJusta(justa);
+            cotaJusta.calcular();
+            double optJusta = optimo(justa);
+            if (optJusta >= 0)
+                REQUIRE(cotaJusta.getCotaCosto() <= optJusta + 1e-6);
+        }
+    }
+}
+
+TEST_CASE("CotaInferior: la brecha objetivo corta la búsqueda", "[CotaInferior]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos, 30, 42);
+    InstanciaCompacta inst(clientes, distMatrix, id2pos, 40, 1, 10);
+    CotaInferior cota(inst);
+    cota.calcular();
+
+    // Con una brecha enorme cualquier solución factible alcanza
+    CriterioParada criterio;
+    criterio.cotaInferior = cota.getCotaCosto();
+    criterio.brechaObjetivo = 1000;
+    REQUIRE(criterio.tieneLimite());
+    GRASP g(clientes, distMatrix, id2pos, 40, 1, 10, 1000, 3, 1);
+    g.setCriterioParada(criterio);
+    Solucion sol = g.resolver();
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(g.getIteracionesRealizadas() < 1000);
+    REQUIRE(cota.brecha(sol.getCostoTotal()) <= 1000);
+}
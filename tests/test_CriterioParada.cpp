@@ -0,0 +1,54 @@
+#include "catch.hpp"
+#include "../src/CriterioParada.h"
+
+using namespace std;
+
+TEST_CASE("CriterioParada: por defecto no corta", "[CriterioParada]") {
+    CriterioParada criterio;
+    REQUIRE_FALSE(criterio.tieneLimite());
+    ControlParada control(criterio);
+    REQUIRE_FALSE(control.debeDetenerse());
+    REQUIRE_FALSE(control.objetivoAlcanzado(0.0));
+    REQUIRE_FALSE(control.sinMejoraAgotado(1000000));
+}
+
+TEST_CASE("CriterioParada: costo objetivo e iteraciones sin mejora", "[CriterioParada]") {
+    CriterioParada criterio;
+    criterio.costoObjetivo = 100;
+    criterio.iteracionesSinMejora = 10;
+    ControlParada control(criterio);
+    REQUIRE(control.objetivoAlcanzado(100));
+    REQUIRE_FALSE(control.objetivoAlcanzado(100.5));
+    REQUIRE_FALSE(control.sinMejoraAgotado(9));
+    REQUIRE(control.sinMejoraAgotado(10));
+}
+
+TEST_CASE("CriterioParada: detener y reiniciar", "[CriterioParada]") {
+    ControlParada control;
+    control.detener();
+    REQUIRE(control.debeDetenerse());
+    control.reiniciar();
+    REQUIRE_FALSE(control.debeDetenerse());
+}
+
+TEST_CASE("CriterioParada: el control externo sobrevive a reiniciar", "[CriterioParada]") {
+    ControlParada externo;
+    ControlParada control;
+    control.setExterno(&externo);
+    REQUIRE_FALSE(control.debeDetenerse());
+    externo.detener();
+    REQUIRE(control.detenido());
+    control.reiniciar();
+    REQUIRE(control.debeDetenerse());
+    externo.reiniciar();
+    REQUIRE_FALSE(control.debeDetenerse());
+}
+
+TEST_CASE("CriterioParada: límite de tiempo vencido", "[CriterioParada]") {
+    CriterioParada criterio;
+    criterio.limiteTiempo = 1e-9;
+    ControlParada control(criterio);
+    while (control.segundos() < 1e-6) {}
+    REQUIRE(control.tiempoAgotado());
+    REQUIRE(control.debeDetenerse());
+}
@@ -0,0 +1,103 @@
+#include "catch.hpp"
+#include "../src/DistanceKernels.h"
+#include "../src/GeneradorAleatorio.h"
+#include "../src/VRPLIBReader.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace std;
+
+// Compara bit a bit: los kernels deben dar exactamente lo mismo que el escalar
+static bool igualesBitABit(const vector<double>& a, const vector<double>& b) {
+    return a.size() == b.size() && memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0;
+}
+
+static double realEn(GeneradorAleatorio& rng, double desde, double hasta) {
+    return desde + (hasta - desde) * rng.real01();
+}
+
+TEST_CASE("DistanceKernels: todos los kernels coinciden con el escalar", "[DistanceKernels]") {
+    GeneradorAleatorio rng(7);
+    vector<EuclideanRowKernel> kernels = {selectEuclideanRowKernel()};
+#ifdef DISTANCE_KERNELS_X86
+    kernels.push_back(euclideanRowSSE2);
+    if (__builtin_cpu_supports("avx2"))
+        kernels.push_back(euclideanRowAVX2);
+#endif
+    // Largos que no son múltiplo del ancho del vector para cubrir las colas
+    for (size_t n : {size_t(0), size_t(1), size_t(3), size_t(7), size_t(8), size_t(33), size_t(1027)}) {
+        vector<double> xs(n), ys(n);
+        for (size_t j = 0; j < n; ++j) {
+            xs[j] = realEn(rng, -1000, 1000);
+            ys[j] = realEn(rng, -1000, 1000);
+        }
+        double x = realEn(rng, -1000, 1000), y = realEn(rng, -1000, 1000);
+        vector<double> esperado(n), obtenido(n);
+        euclideanRowScalar(x, y, xs.data(), ys.data(), esperado.data(), n);
+        for (size_t j = 0; j < n; ++j)
+            REQUIRE(esperado[j] == sqrt(pow(x - xs[j], 2) + pow(y - ys[j], 2)));
+        for (EuclideanRowKernel kernel : kernels) {
+            fill(obtenido.begin(), obtenido.end(), -1.0);
+            kernel(x, y, xs.data(), ys.data(), obtenido.data(), n);
+            REQUIRE(igualesBitABit(esperado, obtenido));
+        }
+    }
+    REQUIRE(string(euclideanRowKernelName()).size() > 0);
+}
+
+TEST_CASE("DistanceKernels: la matriz EUC_2D y CEIL_2D sigue la fórmula", "[DistanceKernels]") {
+    GeneradorAleatorio rng(11);
+    const int n = 1500;
+    vector<double> xs(n + 1), ys(n + 1);
+    for (const char* tipo : {"EUC_2D", "CEIL_2D"}) {
+        ostringstream texto;
+        texto << "NAME : azar\nTYPE : CVRP\nDIMENSION : " << n << "\nEDGE_WEIGHT_TYPE : " << tipo
+              << "\nCAPACITY : 100\nNODE_COORD_SECTION\n";
+        // IDs en orden inverso: la matriz se indexa por ID, no por orden de lectura
+        for (int id = n; id >= 1; --id) {
+            xs[id] = realEn(rng, 0, 1000);
+            ys[id] = realEn(rng, 0, 1000);
+            char linea[96];
+            snprintf(linea, sizeof(linea), "%d %.6f %.6f\n", id, xs[id], ys[id]);
+            texto << linea;
+        }
+        texto << "DEMAND_SECTION\n";
+        for (int id = 1; id <= n; ++id)
+            texto << id << " " << (id == 1 ? 0 : 1) << "\n";
+        texto << "DEPOT_SECTION\n1\n-1\nEOF\n";
+
+        char ruta[] = "/tmp/kernelsXXXXXX";
+        int fd = mkstemp(ruta);
+        REQUIRE(fd >= 0);
+        close(fd);
+        ofstream(ruta, ios::binary) << texto.str();
+        VRPLIBReader reader(ruta);
+        remove(ruta);
+
+        // Las coordenadas leídas son las del archivo, redondeadas a 6 decimales
+        const vector<vector<double>>& m = reader.getDistanceMatrix();
+        vector<double> lx(n + 1), ly(n + 1);
+        for (const Node& nodo : reader.getNodes()) {
+            lx[nodo.id] = nodo.x;
+            ly[nodo.id] = nodo.y;
+        }
+        bool ceil2d = string(tipo) == "CEIL_2D";
+        for (int i = 1; i <= n; i += 37) {
+            REQUIRE(m[i][i] == 0);
+            REQUIRE(m[i][0] == 0);
+            for (int j = 1; j <= n; ++j) {
+                if (i == j)
+                    continue;
+                double d = sqrt(pow(lx[i] - lx[j], 2) + pow(ly[i] - ly[j], 2));
+                REQUIRE(m[i][j] == (ceil2d ? ceil(d) : d));
+            }
+        }
+    }
+}
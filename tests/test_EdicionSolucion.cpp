@@ -0,0 +1,83 @@
+#include "catch.hpp"
+#include "../src/InstanciaCompacta.h"
+#include "../src/SolucionCompacta.h"
+#include "../src/EdicionSolucion.h"
+#include "../src/Cliente.h"
+#include <vector>
+#include <unordered_map>
+
+using namespace std;
+
+// Depósito (ID 1, pos 0) y clientes 2..7 en las posiciones 1..6, sobre una recta
+static vector<vector<double>> matrizRecta() {
+    vector<vector<double>> d(7, vector<double>(7));
+    for (int i = 0; i < 7; ++i)
+        for (int j = 0; j < 7; ++j)
+            d[i][j] = i > j ? i - j : j - i;
+    return d;
+}
+
+TEST_CASE("EdicionSolucion: deshacer restaura rutas, costos y ubicaciones", "[EdicionSolucion]") {
+    vector<Cliente> clientes;
+    unordered_map<int,int> id2pos = {{1, 0}};
+    for (int i = 0; i < 6; ++i) {
+        clientes.emplace_back(i + 2, 2);
+        id2pos[i + 2] = i + 1;
+    }
+    vector<vector<double>> dist = matrizRecta();
+    InstanciaCompacta inst(clientes, dist, id2pos, 6, 1, 3);
+
+    SolucionCompacta sol(inst, {{1, 2, 3}, {4, 5, 6}, {}});
+    vector<vector<int>> rutasAntes = sol.getRutas();
+    double costoAntes = sol.getCosto();
+
+    EdicionSolucion edicion(sol);
+    edicion.comenzar();
+    edicion.quitar(2);
+    edicion.quitar(5);
+    REQUIRE(edicion.getQuitados() == vector<int>({2, 5}));
+    edicion.insertar(2, 0, 5);
+    edicion.insertar(0, 0, 2);
+    int nueva = edicion.abrirRuta();
+    edicion.quitar(6);
+    edicion.insertar(nueva, 0, 6);
+    REQUIRE(edicion.getQuitados().empty());
+    REQUIRE(sol.getCantRutas() == 4);
+
+    edicion.deshacer();
+    REQUIRE(sol.getCantRutas() == 3);
+    REQUIRE(sol.getRutas() == rutasAntes);
+    REQUIRE(sol.getCosto() == Approx(costoAntes));
+    for (int r = 0; r < sol.getCantRutas(); ++r) {
+        for (int i = 0; i < static_cast<int>(sol.getRuta(r).size()); ++i) {
+            REQUIRE(sol.getRutaDe(sol.getRuta(r)[i]) == r);
+            REQUIRE(sol.getIndiceEn(sol.getRuta(r)[i]) == i);
+        }
+    }
+    REQUIRE(edicion.getQuitados().empty());
+}
+
+TEST_CASE("EdicionSolucion: sin deshacer los cambios quedan", "[EdicionSolucion]") {
+    vector<Cliente> clientes;
+    unordered_map<int,int> id2pos = {{1, 0}};
+    for (int i = 0; i < 6; ++i) {
+        clientes.emplace_back(i + 2, 2);
+        id2pos[i + 2] = i + 1;
+    }
+    vector<vector<double>> dist = matrizRecta();
+    InstanciaCompacta inst(clientes, dist, id2pos, 6, 1, 3);
+    SolucionCompacta sol(inst, {{1, 2, 3}, {4, 5, 6}});
+
+    EdicionSolucion edicion(sol);
+    edicion.comenzar();
+    edicion.quitar(3);
+    edicion.insertar(1, 0, 3);
+    vector<vector<int>> rutasDespues = sol.getRutas();
+
+    // Una edición nueva parte del estado aceptado
+    edicion.comenzar();
+    edicion.quitar(1);
+    edicion.deshacer();
+    REQUIRE(sol.getRutas() == rutasDespues);
+    REQUIRE(sol.getRuta(1) == vector<int>({3, 4, 5, 6}));
+}
@@ -0,0 +1,285 @@
+#include "catch.hpp"
+#include "../src/GRASP.h"
+#include "../src/Cliente.h"
+#include "../src/Solucion.h"
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+
+using namespace std;
+
+// Instancia chica: depósito en el centro y 8 clientes en un círculo
+static void instanciaCircular(vector<Cliente>& clientes,
+                              vector<vector<double>>& distMatrix,
+                              unordered_map<int,int>& id2pos) {
+    const int n = 8;
+    vector<pair<double,double>> coords = {{0, 0}};
+    for (int i = 0; i < n; ++i) {
+        double ang = 2 * M_PI * i / n;
+        coords.push_back({10 * cos(ang), 10 * sin(ang)});
+    }
+    distMatrix.assign(n + 1, vector<double>(n + 1, 0.0));
+    for (int i = 0; i <= n; ++i)
+        for (int j = 0; j <= n; ++j)
+            distMatrix[i][j] = hypot(coords[i].first - coords[j].first,
+                                     coords[i].second - coords[j].second);
+    id2pos[1] = 0;
+    for (int i = 0; i < n; ++i) {
+        clientes.emplace_back(i + 2, 3);
+        id2pos[i + 2] = i + 1;
+    }
+}
+
+TEST_CASE("GRASP: solución factible que visita a todos", "[GRASP]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaCircular(clientes, distMatrix, id2pos);
+
+    GRASP g(clientes, distMatrix, id2pos, 10, 1, 4, 20, 3, 1);
+    Solucion sol = g.resolver();
+    REQUIRE(sol.esFactible());
+    REQUIRE(sol.vistoTodos());
+    for (const auto& r : sol.getRutas())
+        REQUIRE(r.getDemandaActual() <= 10);
+}
+
+TEST_CASE("GRASP: misma semilla, misma solución", "[GRASP]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaCircular(clientes, distMatrix, id2pos);
+
+    GRASP g1(clientes, distMatrix, id2pos, 10, 1, 4, 10, 4, 99);
+    GRASP g2(clientes, distMatrix, id2pos, 10, 1, 4, 10, 4, 99);
+    Solucion s1 = g1.resolver();
+    Solucion s2 = g2.resolver();
+    REQUIRE(s1.getCostoTotal() == s2.getCostoTotal());
+    REQUIRE(s1.getRutas().size() == s2.getRutas().size());
+    for (size_t i = 0; i < s1.getRutas().size(); ++i)
+        REQUIRE(s1.getRutas()[i].getClientes() == s2.getRutas()[i].getClientes());
+}
+
+TEST_CASE("GRASP: el resultado no depende de la cantidad de hilos", "[GRASP]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaCircular(clientes, distMatrix, id2pos);
+
+    GRASP g1(clientes, distMatrix, id2pos, 10, 1, 4, 30, 4, 7);
+    GRASP g4(clientes, distMatrix, id2pos, 10, 1, 4, 30, 4, 7);
+    g4.setNumHilos(4);
+    Solucion s1 = g1.resolver();
+    Solucion s4 = g4.resolver();
+    REQUIRE(s4.vistoTodos());
+    REQUIRE(s1.getCostoTotal() == s4.getCostoTotal());
+    for (size_t i = 0; i < s1.getRutas().size(); ++i)
+        REQUIRE(s1.getRutas()[i].getClientes() == s4.getRutas()[i].getClientes());
+}
+
+TEST_CASE("GRASP: corta al alcanzar el costo objetivo", "[GRASP]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaCircular(clientes, distMatrix, id2pos);
+
+    GRASP g(clientes, distMatrix, id2pos, 10, 1, 4, 1000, 3, 1);
+    CriterioParada criterio;
+    criterio.costoObjetivo = 1e9;  // cualquier solución factible alcanza
+    g.setCriterioParada(criterio);
+    Solucion sol = g.resolver();
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(g.getIteracionesRealizadas() < 1000);
+}
+
+TEST_CASE("GRASP: sin límite de iteraciones corta por estancamiento", "[GRASP]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaCircular(clientes, distMatrix, id2pos);
+
+    GRASP g(clientes, distMatrix, id2pos, 10, 1, 4, 0, 3, 1);
+    CriterioParada criterio;
+    criterio.iteracionesSinMejora = 25;
+    criterio.limiteTiempo = 30;  // red de seguridad
+    g.setCriterioParada(criterio);
+
+    vector<double> mejoras;
+    g.setAlMejorar([&](const Solucion& s, double) { mejoras.push_back(s.getCostoTotal()); });
+    Solucion sol = g.resolver();
+
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(g.getIteracionesRealizadas() >= 25);
+    REQUIRE_FALSE(mejoras.empty());
+    for (size_t i = 1; i < mejoras.size(); ++i)
+        REQUIRE(mejoras[i] < mejoras[i - 1]);
+    REQUIRE(mejoras.back() == sol.getCostoTotal());
+    REQUIRE(g.getMejorCosto() == sol.getCostoTotal());
+}
+
+TEST_CASE("GRASP: una detención externa previa a resolver no se pierde", "[GRASP]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaCircular(clientes, distMatrix, id2pos);
+
+    // Como un portafolio que decide parar antes de que GRASP arranque:
+    // resolver() reinicia su propio control, no el externo
+    ControlParada externo;
+    externo.detener();
+    GRASP g(clientes, distMatrix, id2pos, 10, 1, 4, 1000000, 3, 1);
+    g.setControlExterno(&externo);
+    g.resolver();
+    REQUIRE(g.getIteracionesRealizadas() == 0);
+}
+
+TEST_CASE("GRASP: sin iteraciones ni criterio no hace nada", "[GRASP]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaCircular(clientes, distMatrix, id2pos);
+
+    GRASP g(clientes, distMatrix, id2pos, 10, 1, 4, 0, 3, 1);
+    Solucion sol = g.resolver();
+    REQUIRE(sol.getRutas().empty());
+    REQUIRE(g.getIteracionesRealizadas() == 0);
+}
+
+TEST_CASE("GRASP reactivo: probabilidades válidas y determinismo", "[GRASP]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaCircular(clientes, distMatrix, id2pos);
+
+    GRASP g1(clientes, distMatrix, id2pos, 10, 1, 4, 60, 3, 11);
+    GRASP g2(clientes, distMatrix, id2pos, 10, 1, 4, 60, 3, 11);
+    g1.setReactivo({1, 2, 4}, 10);
+    g2.setReactivo({1, 2, 4}, 10);
+    g2.setNumHilos(3);
+    Solucion s1 = g1.resolver();
+    Solucion s2 = g2.resolver();
+
+    REQUIRE(s1.vistoTodos());
+    REQUIRE(s1.getCostoTotal() == s2.getCostoTotal());
+    REQUIRE(g1.getValoresK() == vector<int>({1, 2, 4}));
+    double suma = 0;
+    for (size_t i = 0; i < g1.getProbabilidadesK().size(); ++i) {
+        REQUIRE(g1.getProbabilidadesK()[i] > 0);
+        REQUIRE(g1.getProbabilidadesK()[i] == Approx(g2.getProbabilidadesK()[i]));
+        suma += g1.getProbabilidadesK()[i];
+    }
+    REQUIRE(suma == Approx(1.0));
+}
+
+TEST_CASE("GRASP con path relinking: factible y determinístico", "[GRASP]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaCircular(clientes, distMatrix, id2pos);
+
+    GRASP g1(clientes, distMatrix, id2pos, 10, 1, 4, 80, 4, 3);
+    GRASP g2(clientes, distMatrix, id2pos, 10, 1, 4, 80, 4, 3);
+    g1.setPathRelinking(5);
+    g2.setPathRelinking(5);
+    g2.setNumHilos(2);
+    Solucion s1 = g1.resolver();
+    Solucion s2 = g2.resolver();
+    REQUIRE(s1.vistoTodos());
+    REQUIRE(s1.esFactible());
+    REQUIRE(s1.getCostoTotal() == s2.getCostoTotal());
+    REQUIRE(g1.getMejorasPorRelinking() == g2.getMejorasPorRelinking());
+}
+
+TEST_CASE("GRASP: construcciones repetidas se omiten sin cambiar el resultado", "[GRASP]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaCircular(clientes, distMatrix, id2pos);
+
+    // Con k = 1 la construcción es determinística: todas repiten la primera
+    GRASP g1(clientes, distMatrix, id2pos, 10, 1, 4, 50, 1, 9);
+    g1.setDetectarDuplicados(true);
+    Solucion s1 = g1.resolver();
+    REQUIRE(g1.getIteracionesRealizadas() == 50);
+    REQUIRE(g1.getIteracionesOmitidas() == 49);
+
+    // Sin activarla no se omite nada
+    GRASP g2(clientes, distMatrix, id2pos, 10, 1, 4, 50, 1, 9);
+    Solucion s2 = g2.resolver();
+    REQUIRE(g2.getIteracionesOmitidas() == 0);
+    REQUIRE(s1.getCostoTotal() == s2.getCostoTotal());
+
+    GRASP g3(clientes, distMatrix, id2pos, 10, 1, 4, 200, 3, 9);
+    g3.setNumHilos(3);
+    g3.setDetectarDuplicados(true);
+    GRASP g4(clientes, distMatrix, id2pos, 10, 1, 4, 200, 3, 9);
+    g4.setDetectarDuplicados(true);
+    g3.resolver();
+    g4.resolver();
+    REQUIRE(g3.getIteracionesOmitidas() == g4.getIteracionesOmitidas());
+    REQUIRE(g3.getMejorCosto() == g4.getMejorCosto());
+}
+
+TEST_CASE("GRASP: sobre una instancia compartida da lo mismo", "[GRASP]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaCircular(clientes, distMatrix, id2pos);
+
+    GRASP propio(clientes, distMatrix, id2pos, 10, 1, 4, 100, 3, 7);
+    double esperado = propio.resolver().getCostoTotal();
+
+    auto inst = make_shared<const InstanciaCompacta>(clientes, distMatrix, id2pos, 10, 1, 4);
+    GRASP a(inst, GRASP::crearVecinos(*inst, 3), 100, 3, 7);
+    GRASP b(inst, nullptr, 100, 3, 7);
+    REQUIRE(a.resolver().getCostoTotal() == esperado);
+    REQUIRE(b.resolver().getCostoTotal() == esperado);
+}
+
+TEST_CASE("GRASP en modo pipeline", "[GRASP]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaCircular(clientes, distMatrix, id2pos);
+
+    GRASP g(clientes, distMatrix, id2pos, 10, 1, 4, 300, 3, 21);
+    g.setNumHilos(4);
+    g.setPipeline(1);
+    Solucion s = g.resolver();
+    REQUIRE(s.vistoTodos());
+    REQUIRE(s.esFactible());
+    REQUIRE(g.getIteracionesRealizadas() == 300);
+    REQUIRE(g.getIteracionesFiltradas() == 0);
+
+    // Filtro 0%: sólo se mejoran construcciones que empatan o mejoran la mejor
+    GRASP f(clientes, distMatrix, id2pos, 10, 1, 4, 300, 3, 21);
+    f.setNumHilos(3);
+    f.setPipeline(2, 0);
+    Solucion sf = f.resolver();
+    REQUIRE(sf.esFactible());
+    REQUIRE(f.getIteracionesRealizadas() == 300);
+    REQUIRE(f.getIteracionesFiltradas() + f.getIteracionesOmitidas() < 300);
+}
+
+TEST_CASE("GRASP con recombinación: factible, no peor y determinístico", "[GRASP]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaCircular(clientes, distMatrix, id2pos);
+
+    GRASP base(clientes, distMatrix, id2pos, 10, 1, 4, 100, 4, 5);
+    GRASP g1(clientes, distMatrix, id2pos, 10, 1, 4, 100, 4, 5);
+    GRASP g2(clientes, distMatrix, id2pos, 10, 1, 4, 100, 4, 5);
+    g1.setRecombinacion(25);
+    g2.setRecombinacion(25);
+    g2.setNumHilos(2);
+    base.resolver();
+    Solucion s1 = g1.resolver();
+    Solucion s2 = g2.resolver();
+    REQUIRE(s1.vistoTodos());
+    REQUIRE(s1.esFactible());
+    REQUIRE(s1.getCostoTotal() <= base.getMejorCosto() + 1e-9);
+    REQUIRE(s1.getCostoTotal() == s2.getCostoTotal());
+    REQUIRE(g1.getMejorasPorRecombinacion() == g2.getMejorasPorRecombinacion());
+}
@@ -0,0 +1,49 @@
+#include "catch.hpp"
+#include "../src/GeneradorAleatorio.h"
+#include <vector>
+
+using namespace std;
+
+TEST_CASE("GeneradorAleatorio: misma semilla, misma secuencia", "[GeneradorAleatorio]") {
+    GeneradorAleatorio a(42);
+    GeneradorAleatorio b(42);
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(a() == b());
+    }
+}
+
+TEST_CASE("GeneradorAleatorio: resembrar reinicia la secuencia", "[GeneradorAleatorio]") {
+    GeneradorAleatorio a(7);
+    vector<uint64_t> primeros;
+    for (int i = 0; i < 10; ++i) primeros.push_back(a());
+    a.sembrar(7);
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE(a() == primeros[i]);
+    }
+}
+
+TEST_CASE("GeneradorAleatorio: semillas derivadas distintas por flujo", "[GeneradorAleatorio]") {
+    uint64_t s0 = GeneradorAleatorio::derivarSemilla(1, 0);
+    uint64_t s1 = GeneradorAleatorio::derivarSemilla(1, 1);
+    uint64_t s2 = GeneradorAleatorio::derivarSemilla(2, 0);
+    REQUIRE(s0 != s1);
+    REQUIRE(s0 != s2);
+    REQUIRE(s0 == GeneradorAleatorio::derivarSemilla(1, 0));
+}
+
+TEST_CASE("GeneradorAleatorio: rangos de enteroEn y real01", "[GeneradorAleatorio]") {
+    GeneradorAleatorio g(3);
+    vector<int> conteo(5, 0);
+    for (int i = 0; i < 5000; ++i) {
+        int x = g.enteroEn(5);
+        REQUIRE(x >= 0);
+        REQUIRE(x < 5);
+        conteo[x]++;
+        double r = g.real01();
+        REQUIRE(r >= 0.0);
+        REQUIRE(r < 1.0);
+    }
+    for (int c : conteo) {
+        REQUIRE(c > 800);
+    }
+}
@@ -0,0 +1,29 @@
+#include "catch.hpp"
+#include "../src/HashZobrist.h"
+#include <vector>
+
+using namespace std;
+
+TEST_CASE("HashZobrist: no depende del sentido ni del orden de las rutas", "[HashZobrist]") {
+    HashZobrist h(10, 7);
+    uint64_t base = h.hashRutas({{1, 2, 3}, {4, 5}}, 0);
+    REQUIRE(h.hashRutas({{5, 4}, {3, 2, 1}}, 0) == base);
+    REQUIRE(h.hashRutas({{1, 3, 2}, {4, 5}}, 0) != base);
+    REQUIRE(h.hashRutas({{1, 2}, {3, 4, 5}}, 0) != base);
+}
+
+TEST_CASE("HashZobrist: rutas de un cliente no se cancelan", "[HashZobrist]") {
+    HashZobrist h(10, 7);
+    REQUIRE(h.hashRuta({4}, 0) == 2 * h.clave(0, 4));
+    REQUIRE(h.hashRutas({{1}, {2}}, 0) != h.hashRutas({{1}, {3}}, 0));
+}
+
+TEST_CASE("HashZobrist: actualización incremental", "[HashZobrist]") {
+    HashZobrist h(10, 3);
+    // Mover el 3 al final de la otra ruta: quitar y agregar aristas
+    uint64_t antes = h.hashRutas({{1, 3, 2}, {4}}, 0);
+    uint64_t despues = antes
+        - h.clave(1, 3) - h.clave(3, 2) + h.clave(1, 2)
+        - h.clave(4, 0) + h.clave(4, 3) + h.clave(3, 0);
+    REQUIRE(despues == h.hashRutas({{1, 2}, {4, 3}}, 0));
+}
@@ -3,6 +3,8 @@
 #include "../src/Cliente.h"
 #include "../src/Ruta.h"
 #include "../src/Solucion.h"
+#include "../src/InstanciaCompacta.h"
+#include "InstanciaAleatoria.h"
 #include <vector>
 #include <random>
 #include <algorithm>
@@ -155,3 +157,19 @@ TEST_CASE("HeuristicaClarkeWright: Regresión/Aleatorio solución siempre factib
         REQUIRE(ruta.esFactible());
     }
 }
+
+TEST_CASE("HeuristicaClarkeWright: con un proveedor por ID da lo mismo que con la matriz", "[HeuristicaClarkeWright]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+    InstanciaCompacta inst(clientes, distMatrix, id2pos, 40, 1, 8);
+
+    HeuristicaClarkeWright conMatriz(clientes, inst.getIdDistMatrix(), 40, 1, 8);
+    HeuristicaClarkeWright conProveedor(clientes, inst.getIdDistancias(), 40, 1, 8);
+    Solucion a = conMatriz.resolver();
+    Solucion b = conProveedor.resolver();
+    REQUIRE(b.getRutas().size() == a.getRutas().size());
+    REQUIRE(b.getCostoTotal() == a.getCostoTotal());
+    REQUIRE(b.vistoTodos());
+}
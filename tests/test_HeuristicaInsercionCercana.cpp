@@ -3,11 +3,14 @@
 #include "../src/Cliente.h"
 #include "../src/Ruta.h"
 #include "../src/Solucion.h"
+#include "../src/InstanciaCompacta.h"
+#include "InstanciaAleatoria.h"
 
 #include <vector>
 #include <unordered_map>
 #include <random>
 #include <algorithm>
+#include <cmath>
 
 using namespace std;
 
@@ -176,3 +179,65 @@ TEST_CASE("Solución siempre factible (aleatorio)", "[HeuristicaInsercionCercana
         REQUIRE( r.esFactible() );
     }
 }
+
+TEST_CASE("Regresión: la matriz del lector se pasa indexada por posición", "[HeuristicaInsercionCercana]") {
+    // Como en VRPLIB: la matriz del lector va por id (fila 0 sin uso,
+    // depósito 1, clientes 2..5), pero las heurísticas con id2pos la
+    // esperan por posición (depósito 0, clientes[i] en i+1). Los drivers
+    // le pasaban la matriz por id y cada distancia quedaba corrida un nodo.
+    vector<double> xs = {0, 0, 10, 12, -7, -9}, ys = {0, 0, 2, -3, 5, -8};
+    vector<Cliente> clientes = { Cliente(2,1), Cliente(3,1), Cliente(4,1), Cliente(5,1) };
+    const int depot = 1;
+    vector<vector<double>> porId(6, vector<double>(6, 0.0));
+    for (int a = 1; a <= 5; ++a)
+        for (int b = 1; b <= 5; ++b)
+            porId[a][b] = sqrt((xs[a]-xs[b])*(xs[a]-xs[b]) + (ys[a]-ys[b])*(ys[a]-ys[b]));
+
+    unordered_map<int,int> id2pos = {{depot,0}};
+    for (size_t i = 0; i < clientes.size(); ++i)
+        id2pos[clientes[i].getId()] = i+1;
+    vector<vector<double>> porPosicion(clientes.size()+1, vector<double>(clientes.size()+1));
+    for (size_t i = 0; i <= clientes.size(); ++i) {
+        int idI = i == 0 ? depot : clientes[i-1].getId();
+        for (size_t j = 0; j <= clientes.size(); ++j) {
+            int idJ = j == 0 ? depot : clientes[j-1].getId();
+            porPosicion[i][j] = porId[idI][idJ];
+        }
+    }
+
+    // Costo de las rutas medido con la matriz del lector
+    auto costoReal = [&](const Solucion& sol) {
+        double total = 0;
+        for (const Ruta& r : sol.getRutas()) {
+            const vector<int>& seq = r.getClientes();
+            for (size_t k = 0; k + 1 < seq.size(); ++k)
+                total += porId[seq[k]][seq[k+1]];
+        }
+        return total;
+    };
+
+    HeuristicaInsercionCercana bien(clientes, porPosicion, id2pos, 2, depot, 2);
+    Solucion sol = bien.resolver();
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(sol.getCostoTotal() == Approx(costoReal(sol)));
+
+    // Con la matriz por id el costo informado no es el de las rutas
+    HeuristicaInsercionCercana mal(clientes, porId, id2pos, 2, depot, 2);
+    Solucion corrida = mal.resolver();
+    REQUIRE(corrida.getCostoTotal() != Approx(costoReal(corrida)));
+}
+
+TEST_CASE("Con un proveedor por ID da lo mismo que con la matriz", "[HeuristicaInsercionCercana]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+    InstanciaCompacta inst(clientes, distMatrix, id2pos, 40, 1, 8);
+
+    HeuristicaInsercionCercana conMatriz(clientes, distMatrix, id2pos, 40, 1, 8);
+    HeuristicaInsercionCercana conProveedor(clientes, inst.getIdDistancias(), 40, 1, 8);
+    Solucion a = conMatriz.resolver();
+    Solucion b = conProveedor.resolver();
+    REQUIRE(b.getRutas().size() == a.getRutas().size());
+    REQUIRE(b.getCostoTotal() == a.getCostoTotal());
+}
@@ -0,0 +1,89 @@
+#include "catch.hpp"
+#include "../src/HybridGeneticSearch.h"
+#include "../src/HeuristicaInsercionCercana.h"
+#include "../src/Cliente.h"
+#include "../src/Solucion.h"
+#include "InstanciaAleatoria.h"
+#include <algorithm>
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+
+using namespace std;
+
+TEST_CASE("HybridGeneticSearch: factible y mejor que la inserción cercana", "[HybridGeneticSearch]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    HeuristicaInsercionCercana ni(clientes, distMatrix, id2pos, 40, 1, 8);
+    Solucion inicial = ni.resolver();
+
+    HybridGeneticSearch hgs(clientes, distMatrix, id2pos, 40, 1, 8, 5);
+    hgs.setPoblacion(10, 15);
+    Solucion sol = hgs.resolver();
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(sol.esFactible());
+    REQUIRE(sol.getRutas().size() <= 8);
+    for (const Ruta& r : sol.getRutas())
+        REQUIRE(r.getDemandaActual() <= 40);
+    REQUIRE(sol.getCostoTotal() < inicial.getCostoTotal());
+    REQUIRE(sol.getCostoTotal() == Approx(hgs.getMejorCosto()));
+}
+
+TEST_CASE("HybridGeneticSearch: misma semilla, misma solución, con reinicios", "[HybridGeneticSearch]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    HybridGeneticSearch x(clientes, distMatrix, id2pos, 40, 1, 8, 31);
+    HybridGeneticSearch y(clientes, distMatrix, id2pos, 40, 1, 8, 31);
+    for (HybridGeneticSearch* h : {&x, &y}) {
+        h->setPoblacion(8, 10, 2, 3);
+        h->setReinicio(40);
+        h->setMaxIteraciones(300);
+    }
+    Solucion sx = x.resolver();
+    Solucion sy = y.resolver();
+    REQUIRE(x.getIteracionesRealizadas() == 300);
+    REQUIRE(x.getReinicios() > 0);
+    REQUIRE(x.getReinicios() == y.getReinicios());
+    REQUIRE(sx.esFactible());
+    REQUIRE(sx.getCostoTotal() == sy.getCostoTotal());
+}
+
+TEST_CASE("HybridGeneticSearch: OX hereda del padre aun con el tramo que da la vuelta", "[HybridGeneticSearch]") {
+    const vector<int> padre = {1, 2, 3, 4, 5, 6};
+    const vector<int> madre = {6, 4, 2, 5, 1, 3};
+    const int n = static_cast<int>(padre.size());
+    vector<int> hijo;
+    vector<char> marca;
+    // Todos los cortes, también los que dan la vuelta al final. Antes el
+    // corte con fin = inicio - 1 no copiaba nada del padre y el hijo era
+    // una rotación de la madre.
+    for (int inicio = 0; inicio < n; ++inicio) {
+        for (int largo = 1; largo < n; ++largo) {
+            marca.assign(n + 1, 0);
+            HybridGeneticSearch::cruceOX(padre, madre, inicio, largo, hijo, marca);
+            vector<int> ordenado = hijo;
+            sort(ordenado.begin(), ordenado.end());
+            REQUIRE(ordenado == padre);
+            // El tramo del padre queda en su lugar
+            for (int k = 0; k < largo; ++k)
+                REQUIRE(hijo[(inicio + k) % n] == padre[(inicio + k) % n]);
+            // El resto sigue el orden de la madre desde después del tramo
+            vector<int> resto, esperado;
+            for (int k = largo; k < n; ++k)
+                resto.push_back(hijo[(inicio + k) % n]);
+            const int fin = inicio + largo - 1;
+            for (int i = 1; i <= n; ++i) {
+                int c = madre[(fin + i) % n];
+                if (find(resto.begin(), resto.end(), c) != resto.end())
+                    esperado.push_back(c);
+            }
+            REQUIRE(resto == esperado);
+        }
+    }
+}
@@ -0,0 +1,42 @@
+#include "catch.hpp"
+#include "../src/InsercionCercana.h"
+#include <vector>
+
+using namespace std;
+
+TEST_CASE("InsercionCercana: distancia de selección", "[InsercionCercana]") {
+    // Nodos sobre una recta: la distancia es la diferencia de coordenadas
+    vector<double> x = {0, 4, 1, 9, 3};
+    auto distA = [&](int v) { return x[v] > x[4] ? x[v] - x[4] : x[4] - x[v]; };
+
+    // Sin orden: el mínimo entre el depósito y los ruteados
+    vector<int> ruta = {1, 3};
+    auto todos = [](int) { return true; };
+    REQUIRE(distanciaCercana(3.0, ruta.data(), 2, false, distA, todos) == 1.0);
+    REQUIRE(distanciaCercana(3.0, ruta.data(), 0, false, distA, todos) == 3.0);
+
+    // Ordenados: corta en el primer ruteado, salteando los que no lo están
+    vector<int> vecinos = {1, 2, 3};
+    auto sin1 = [](int v) { return v != 1; };
+    REQUIRE(distanciaCercana(3.0, vecinos.data(), 3, true, distA, todos) == 1.0);
+    REQUIRE(distanciaCercana(3.0, vecinos.data(), 3, true, distA, sin1) == 2.0);
+    // Ninguno más cerca que el depósito
+    REQUIRE(distanciaCercana(0.5, vecinos.data(), 3, true, distA, todos) == 0.5);
+}
+
+TEST_CASE("InsercionCercana: mejor posición de inserción", "[InsercionCercana]") {
+    vector<double> x = {0, 1, 2, 3, 10};
+    auto dist = [&](int a, int b) { return x[a] > x[b] ? x[a] - x[b] : x[b] - x[a]; };
+
+    vector<int> ruta = {1, 3};
+    double delta;
+    // 2 va entre 1 y 3 sin costo extra
+    REQUIRE(mejorPosicionInsercion(ruta.data(), 2, 2, 0, dist, delta) == 1);
+    REQUIRE(delta == 0.0);
+    // 4 cuesta lo mismo entre 1 y 3 que al final: gana el primer índice
+    REQUIRE(mejorPosicionInsercion(ruta.data(), 2, 4, 0, dist, delta) == 1);
+    REQUIRE(delta == 14.0);
+    // Ruta vacía: depósito, cliente, depósito
+    REQUIRE(mejorPosicionInsercion(ruta.data(), 0, 3, 0, dist, delta) == 0);
+    REQUIRE(delta == 6.0);
+}
@@ -0,0 +1,80 @@
+#include "catch.hpp"
+#include "../src/IteratedLocalSearch.h"
+#include "../src/HeuristicaInsercionCercana.h"
+#include "../src/Cliente.h"
+#include "../src/Solucion.h"
+#include "InstanciaAleatoria.h"
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+
+using namespace std;
+
+TEST_CASE("IteratedLocalSearch: mejora la solución inicial y es factible", "[IteratedLocalSearch]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    HeuristicaInsercionCercana ni(clientes, distMatrix, id2pos, 40, 1, 8);
+    Solucion inicial = ni.resolver();
+
+    IteratedLocalSearch ils(clientes, distMatrix, id2pos, 40, 1, 8, 5);
+    Solucion sol = ils.resolver();
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(sol.esFactible());
+    for (const Ruta& r : sol.getRutas())
+        REQUIRE(r.getDemandaActual() <= 40);
+    REQUIRE(sol.getCostoTotal() < inicial.getCostoTotal());
+    REQUIRE(sol.getCostoTotal() == Approx(ils.getMejorCosto()));
+}
+
+TEST_CASE("IteratedLocalSearch: sobre una instancia compartida da lo mismo", "[IteratedLocalSearch]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    IteratedLocalSearch propia(clientes, distMatrix, id2pos, 40, 1, 8, 5);
+    propia.setMaxIteraciones(200);
+    Solucion esperada = propia.resolver();
+
+    // Dos solvers sobre la misma instancia y las mismas listas
+    auto inst = make_shared<const InstanciaCompacta>(clientes, distMatrix, id2pos, 40, 1, 8);
+    auto vecinos = IteratedLocalSearch::crearVecinos(*inst);
+    IteratedLocalSearch a(inst, vecinos, 5);
+    IteratedLocalSearch b(inst, vecinos, 5);
+    a.setMaxIteraciones(200);
+    b.setMaxIteraciones(200);
+    REQUIRE(a.resolver().getCostoTotal() == esperada.getCostoTotal());
+    REQUIRE(b.resolver().getCostoTotal() == esperada.getCostoTotal());
+}
+
+TEST_CASE("IteratedLocalSearch: perturbaciones y aceptaciones", "[IteratedLocalSearch]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    using P = IteratedLocalSearch::Perturbacion;
+    using A = IteratedLocalSearch::Aceptacion;
+    for (P p : {P::MultiRelocate, P::DobleBridge}) {
+        for (A a : {A::Mejor, A::Umbral, A::Siempre}) {
+            IteratedLocalSearch x(clientes, distMatrix, id2pos, 40, 1, 8, 13);
+            IteratedLocalSearch y(clientes, distMatrix, id2pos, 40, 1, 8, 13);
+            x.setPerturbacion(p, 4);
+            y.setPerturbacion(p, 4);
+            x.setAceptacion(a, 0.02);
+            y.setAceptacion(a, 0.02);
+            x.setMaxIteraciones(200);
+            y.setMaxIteraciones(200);
+            Solucion sx = x.resolver();
+            Solucion sy = y.resolver();
+            REQUIRE(x.getIteracionesRealizadas() == 200);
+            REQUIRE(sx.vistoTodos());
+            REQUIRE(sx.esFactible());
+            REQUIRE(sx.getCostoTotal() == sy.getCostoTotal());
+        }
+    }
+}
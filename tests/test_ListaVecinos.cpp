@@ -0,0 +1,125 @@
+#include "catch.hpp"
+#include "../src/ListaVecinos.h"
+#include "../src/GeneradorAleatorio.h"
+#include "../src/ProveedorDistancias.h"
+#include <vector>
+
+using namespace std;
+
+TEST_CASE("ListaVecinos: listas completas ordenadas por distancia", "[ListaVecinos]") {
+    vector<vector<double>> distMatrix = {
+        {0, 5, 1, 3},
+        {5, 0, 2, 4},
+        {1, 2, 0, 6},
+        {3, 4, 6, 0}
+    };
+    ListaVecinos lv(distMatrix, 4);
+    REQUIRE(lv.getCantidadVecinos() == 3);
+    REQUIRE(lv.esCompleta());
+
+    const int* v0 = lv.getVecinos(0);
+    REQUIRE(v0[0] == 2);
+    REQUIRE(v0[1] == 3);
+    REQUIRE(v0[2] == 1);
+
+    const int* v3 = lv.getVecinos(3);
+    REQUIRE(v3[0] == 0);
+    REQUIRE(v3[1] == 1);
+    REQUIRE(v3[2] == 2);
+}
+
+TEST_CASE("ListaVecinos: empates se resuelven por posición", "[ListaVecinos]") {
+    vector<vector<double>> distMatrix = {
+        {0, 2, 2, 2},
+        {2, 0, 1, 1},
+        {2, 1, 0, 1},
+        {2, 1, 1, 0}
+    };
+    ListaVecinos lv(distMatrix, 4);
+    const int* v0 = lv.getVecinos(0);
+    REQUIRE(v0[0] == 1);
+    REQUIRE(v0[1] == 2);
+    REQUIRE(v0[2] == 3);
+}
+
+TEST_CASE("ListaVecinos: listas truncadas", "[ListaVecinos]") {
+    vector<vector<double>> distMatrix = {
+        {0, 5, 1, 3},
+        {5, 0, 2, 4},
+        {1, 2, 0, 6},
+        {3, 4, 6, 0}
+    };
+    ListaVecinos lv(distMatrix, 4, 2);
+    REQUIRE(lv.getCantidadVecinos() == 2);
+    REQUIRE_FALSE(lv.esCompleta());
+    const int* v1 = lv.getVecinos(1);
+    REQUIRE(v1[0] == 2);
+    REQUIRE(v1[1] == 3);
+}
+
+TEST_CASE("ListaVecinos: instancia de un solo nodo", "[ListaVecinos]") {
+    vector<vector<double>> distMatrix = {{0}};
+    ListaVecinos lv(distMatrix, 1);
+    REQUIRE(lv.getCantidadVecinos() == 0);
+}
+
+TEST_CASE("ListaVecinos: con coordenadas (rejilla) da las mismas listas que la matriz", "[ListaVecinos]") {
+    GeneradorAleatorio rng(23);
+    for (ProveedorDistancias::Redondeo redondeo : {ProveedorDistancias::Redondeo::Ninguno,
+                                                   ProveedorDistancias::Redondeo::HaciaArriba}) {
+        // Puntos en una grilla entera chica (muchos empates y puntos
+        // repetidos) más un cúmulo lejano
+        const int n = 400;
+        vector<double> xs, ys;
+        for (int i = 0; i < n; ++i) {
+            bool cumulo = i % 5 == 0;
+            xs.push_back(cumulo ? 1000 + rng.enteroEn(3) : rng.enteroEn(40));
+            ys.push_back(cumulo ? 1000 + rng.enteroEn(3) : rng.enteroEn(40));
+        }
+        ProveedorDistancias coordenadas(xs, ys, redondeo);
+        vector<vector<double>> matriz(n, vector<double>(n));
+        for (int i = 0; i < n; ++i)
+            coordenadas.fila(i, matriz[i].data());
+        // Los formatos compactos se recorren fila por fila
+        ProveedorDistancias triangular(coordenadas, ProveedorDistancias::Formato::Triangular);
+
+        for (int k : {1, 7, 30, -1}) {
+            ListaVecinos densa(matriz, n, k);
+            ListaVecinos rejilla(coordenadas, k);
+            ListaVecinos compacta(triangular, k);
+            REQUIRE(rejilla.getCantidadVecinos() == densa.getCantidadVecinos());
+            REQUIRE(rejilla.esCompleta() == densa.esCompleta());
+            for (int i = 0; i < n; ++i) {
+                vector<int> a(densa.getVecinos(i), densa.getVecinos(i) + densa.getCantidadVecinos());
+                vector<int> b(rejilla.getVecinos(i), rejilla.getVecinos(i) + rejilla.getCantidadVecinos());
+                vector<int> c(compacta.getVecinos(i), compacta.getVecinos(i) + compacta.getCantidadVecinos());
+                REQUIRE(a == b);
+                REQUIRE(a == c);
+            }
+        }
+    }
+}
+
+TEST_CASE("ListaVecinos: rejilla con puntos casi alineados", "[ListaVecinos]") {
+    // alto mucho menor que ancho: el lado de la celda no puede achicarse
+    // hasta dejar miles de millones de columnas
+    GeneradorAleatorio rng(5);
+    const int n = 300;
+    vector<double> xs, ys;
+    for (int i = 0; i < n; ++i) {
+        xs.push_back(rng.real01() * 1000);
+        ys.push_back(rng.real01() * 1e-12);
+    }
+    ProveedorDistancias coordenadas(xs, ys);
+    vector<vector<double>> matriz(n, vector<double>(n));
+    for (int i = 0; i < n; ++i)
+        coordenadas.fila(i, matriz[i].data());
+
+    ListaVecinos densa(matriz, n, 10);
+    ListaVecinos rejilla(coordenadas, 10);
+    for (int i = 0; i < n; ++i) {
+        vector<int> a(densa.getVecinos(i), densa.getVecinos(i) + 10);
+        vector<int> b(rejilla.getVecinos(i), rejilla.getVecinos(i) + 10);
+        REQUIRE(a == b);
+    }
+}
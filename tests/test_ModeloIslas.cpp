@@ -0,0 +1,74 @@
+#include "catch.hpp"
+#include "../src/ModeloIslas.h"
+#include "../src/HeuristicaInsercionCercana.h"
+#include "../src/Cliente.h"
+#include "../src/Solucion.h"
+#include "InstanciaAleatoria.h"
+#include <vector>
+#include <unordered_map>
+#include <chrono>
+#include <cmath>
+
+using namespace std;
+
+TEST_CASE("ModeloIslas: islas mixtas, factible y con migraciones", "[ModeloIslas]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    HeuristicaInsercionCercana ni(clientes, distMatrix, id2pos, 40, 1, 8);
+    Solucion inicial = ni.resolver();
+
+    ModeloIslas islas(clientes, distMatrix, id2pos, 40, 1, 8, 7);
+    islas.setIslas(3);
+    islas.setPeriodoMigracion(0.05);
+    CriterioParada criterio;
+    criterio.limiteTiempo = 0.5;
+    islas.setCriterioParada(criterio);
+    double ultima = -1;
+    bool decreciente = true;
+    islas.setAlMejorar([&](const Solucion& sol, double) {
+        if (ultima >= 0 && sol.getCostoTotal() >= ultima)
+            decreciente = false;
+        ultima = sol.getCostoTotal();
+    });
+    Solucion sol = islas.resolver();
+
+    REQUIRE(islas.getCantidadIslas() == 3);
+    REQUIRE(decreciente);
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(sol.esFactible());
+    for (const Ruta& r : sol.getRutas())
+        REQUIRE(r.getDemandaActual() <= 40);
+    REQUIRE(sol.getCostoTotal() < inicial.getCostoTotal());
+    REQUIRE(sol.getCostoTotal() == Approx(islas.getMejorCosto()));
+    REQUIRE(sol.getCostoTotal() == Approx(ultima));
+    // Cada isla hace varios períodos; al menos una adopta la de su vecina
+    REQUIRE(islas.getPeriodos() >= 3 * 5);
+    REQUIRE(islas.getMigraciones() > 0);
+}
+
+TEST_CASE("ModeloIslas: corta al alcanzar el costo objetivo", "[ModeloIslas]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    HeuristicaInsercionCercana ni(clientes, distMatrix, id2pos, 40, 1, 8);
+    Solucion inicial = ni.resolver();
+
+    ModeloIslas islas(clientes, distMatrix, id2pos, 40, 1, 8, 3);
+    islas.setIslas(2);
+    islas.setAlgoritmos({ModeloIslas::Algoritmo::ILS});
+    CriterioParada criterio;
+    criterio.limiteTiempo = 30;
+    criterio.costoObjetivo = inicial.getCostoTotal();
+    islas.setCriterioParada(criterio);
+    auto inicio = chrono::steady_clock::now();
+    Solucion sol = islas.resolver();
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    REQUIRE(sol.getCostoTotal() <= inicial.getCostoTotal());
+    REQUIRE(segundos < 5);
+}
@@ -5,6 +5,8 @@
 #include "../src/Solucion.h"
 #include <vector>
 #include <algorithm>
+#include <memory>
+#include <random>
 
 using namespace std;
 
@@ -60,6 +62,27 @@ TEST_CASE("OperadorSwap: Realiza swap que mejora la solución", "[OperadorSwap]"
     REQUIRE(mejorada.getCostoTotal() < sol.getCostoTotal());
 }
 
+TEST_CASE("OperadorSwap: con el control detenido no busca y devuelve la original", "[OperadorSwap]") {
+    // La misma instancia en la que el swap mejora
+    vector<Cliente> clientes = {Cliente(0, 0), Cliente(1, 3), Cliente(2, 4), Cliente(3, 2)};
+    vector<vector<double>> distMatrix = {
+        {0, 1, 10, 10},
+        {1, 0, 10, 2},
+        {10, 10, 0, 1},
+        {10, 2, 1, 0}
+    };
+    Ruta ruta1(10, 0, distMatrix, clientes, {0, 1, 2, 0});
+    Ruta ruta2(10, 0, distMatrix, clientes, {0, 3, 0});
+    vector<Ruta> rutas = {ruta1, ruta2};
+    Solucion sol(clientes, distMatrix, rutas.size(), rutas);
+    ControlParada control;
+    control.detener();
+    OperadorSwap op(sol);
+    op.setControlParada(&control);
+    REQUIRE(op.aplicar().getCostoTotal() == sol.getCostoTotal());
+    REQUIRE(op.mejorSwapEntreRutas(0, 1).getCostoTotal() == sol.getCostoTotal());
+}
+
 TEST_CASE("OperadorSwap: Respeta restricciones de capacidad", "[OperadorSwap]") {
     // El swap no debe violar la capacidad máxima de las rutas
     vector<Cliente> clientes = {Cliente(0, 0), Cliente(1, 8), Cliente(2, 8), Cliente(3, 2)};
@@ -129,3 +152,40 @@ TEST_CASE("OperadorSwap: Regresión/Aleatorio, siempre respeta factibilidad", "[
         REQUIRE(ruta.esFactible());
     }
 }
+
+TEST_CASE("OperadorSwap: da lo mismo con distancias compactas", "[OperadorSwap]") {
+    // Matriz simétrica entera: los formatos triangulares y en float la
+    // guardan exacta y el operador debe elegir el mismo movimiento
+    std::mt19937 rng(7);
+    int n = 8;
+    vector<Cliente> clientes;
+    clientes.push_back(Cliente(0, 0));
+    for (int i = 1; i <= n; ++i)
+        clientes.push_back(Cliente(i, 1 + (rng() % 4)));
+    vector<vector<double>> distMatrix(n+1, vector<double>(n+1, 0));
+    for (int i = 0; i <= n; ++i) {
+        for (int j = i + 1; j <= n; ++j)
+            distMatrix[i][j] = distMatrix[j][i] = 1 + (rng() % 30);
+    }
+    vector<vector<int>> recorridos = {{0, 1, 2, 3, 0}, {0, 4, 5, 0}, {0, 6, 7, 8, 0}};
+
+    auto resolver = [&](shared_ptr<const ProveedorDistancias> distancias) {
+        vector<Ruta> rutas;
+        for (const auto& r : recorridos)
+            rutas.push_back(Ruta(10, 0, distancias, clientes, r));
+        Solucion sol(clientes, distancias, rutas.size(), rutas);
+        OperadorSwap op(sol);
+        return op.aplicar();
+    };
+    auto densa = make_shared<const ProveedorDistancias>(distMatrix);
+    Solucion esperada = resolver(densa);
+    for (ProveedorDistancias::Formato formato : {ProveedorDistancias::Formato::Simple,
+                                                 ProveedorDistancias::Formato::Triangular,
+                                                 ProveedorDistancias::Formato::TriangularSimple}) {
+        Solucion obtenida = resolver(make_shared<const ProveedorDistancias>(*densa, formato));
+        REQUIRE(obtenida.getCostoTotal() == esperada.getCostoTotal());
+        REQUIRE(obtenida.getRutas().size() == esperada.getRutas().size());
+        for (size_t r = 0; r < esperada.getRutas().size(); ++r)
+            REQUIRE(obtenida.getRutas()[r].getClientes() == esperada.getRutas()[r].getClientes());
+    }
+}
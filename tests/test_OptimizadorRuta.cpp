@@ -0,0 +1,111 @@
+#include "catch.hpp"
+#include "../src/OptimizadorRuta.h"
+#include "../src/InstanciaCompacta.h"
+#include "../src/SolucionCompacta.h"
+#include "../src/HeuristicaInsercionCercana.h"
+#include "../src/GeneradorAleatorio.h"
+#include "../src/Cliente.h"
+#include "../src/Solucion.h"
+#include "InstanciaAleatoria.h"
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+static double costoRuta(const InstanciaCompacta& inst, const vector<int>& ruta) {
+    int prev = inst.getPosDeposito();
+    double costo = 0;
+    for (int pos : ruta) {
+        costo += inst.dist(prev, pos);
+        prev = pos;
+    }
+    return costo + inst.dist(prev, inst.getPosDeposito());
+}
+
+TEST_CASE("OptimizadorRuta: Held-Karp da el óptimo de la fuerza bruta", "[OptimizadorRuta]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+    InstanciaCompacta inst(clientes, distMatrix, id2pos, 1000, 1, 8);
+    OptimizadorRuta optimizador(inst);
+
+    GeneradorAleatorio rng(9);
+    for (int prueba = 0; prueba < 5; ++prueba) {
+        vector<int> ruta = inst.getPosClientes();
+        shuffle(ruta.begin(), ruta.end(), rng);
+        ruta.resize(8);
+
+        vector<int> permutacion = ruta;
+        sort(permutacion.begin(), permutacion.end());
+        double optimo = costoRuta(inst, permutacion);
+        while (next_permutation(permutacion.begin(), permutacion.end()))
+            optimo = min(optimo, costoRuta(inst, permutacion));
+
+        double antes = costoRuta(inst, ruta);
+        double mejora = optimizador.optimizar(ruta);
+        REQUIRE(ruta.size() == 8);
+        REQUIRE(costoRuta(inst, ruta) == Approx(optimo));
+        REQUIRE(mejora == Approx(antes - optimo).margin(1e-9));
+    }
+    REQUIRE(optimizador.getResueltasExactas() == 5);
+    REQUIRE(optimizador.getResueltasHeuristicas() == 0);
+}
+
+TEST_CASE("OptimizadorRuta: el mismo conjunto sale de la caché", "[OptimizadorRuta]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+    InstanciaCompacta inst(clientes, distMatrix, id2pos, 1000, 1, 8);
+    OptimizadorRuta optimizador(inst);
+
+    vector<int> ruta(inst.getPosClientes().begin(), inst.getPosClientes().begin() + 10);
+    vector<int> otra = ruta;
+    reverse(otra.begin(), otra.end());
+    swap(otra[2], otra[7]);
+
+    optimizador.optimizar(ruta);
+    optimizador.optimizar(otra);
+    REQUIRE(optimizador.getResueltasExactas() == 1);
+    REQUIRE(optimizador.getAciertosCache() == 1);
+    REQUIRE(costoRuta(inst, otra) == Approx(costoRuta(inst, ruta)));
+    // Ya óptima: no cambia
+    vector<int> copia = ruta;
+    REQUIRE(optimizador.optimizar(copia) == 0);
+    REQUIRE(copia == ruta);
+}
+
+TEST_CASE("OptimizadorRuta: rutas largas con 2-opt y Or-opt, y soluciones completas", "[OptimizadorRuta]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+    InstanciaCompacta inst(clientes, distMatrix, id2pos, 40, 1, 8);
+    OptimizadorRuta optimizador(inst);
+
+    vector<int> larga = inst.getPosClientes();
+    double antes = costoRuta(inst, larga);
+    double mejora = optimizador.optimizar(larga);
+    REQUIRE(optimizador.getResueltasHeuristicas() == 1);
+    REQUIRE(mejora > 0);
+    REQUIRE(costoRuta(inst, larga) == Approx(antes - mejora));
+    vector<int> ordenada = larga;
+    sort(ordenada.begin(), ordenada.end());
+    REQUIRE(ordenada == inst.getPosClientes());
+
+    HeuristicaInsercionCercana ni(clientes, distMatrix, id2pos, 40, 1, 8);
+    SolucionCompacta sol(inst, inst.rutasDesde(ni.resolver()));
+    double costoInicial = sol.getCosto();
+    double mejoraTotal = optimizador.optimizar(sol);
+    REQUIRE(sol.getCosto() == Approx(costoInicial - mejoraTotal));
+    SolucionCompacta copia = sol;
+    copia.recalcular();
+    REQUIRE(copia.getCosto() == Approx(sol.getCosto()));
+    for (int r = 0; r < sol.getCantRutas(); ++r) {
+        vector<int> ruta = sol.getRuta(r);
+        REQUIRE(optimizador.optimizar(ruta) == 0);
+    }
+}
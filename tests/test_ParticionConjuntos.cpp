@@ -0,0 +1,141 @@
+#include "catch.hpp"
+#include "../src/ParticionConjuntos.h"
+#include "../src/PoolRutas.h"
+#include "../src/InstanciaCompacta.h"
+#include "../src/Cliente.h"
+#include "InstanciaAleatoria.h"
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+
+// Todas las rutas de 1 a 3 clientes, en orden creciente de posición
+static void llenarPool(const InstanciaCompacta& inst, PoolRutas& pool) {
+    const vector<int>& pos = inst.getPosClientes();
+    const int n = static_cast<int>(pos.size());
+    for (int a = 0; a < n; ++a) {
+        pool.agregar({pos[a]});
+        for (int b = a + 1; b < n; ++b) {
+            pool.agregar({pos[a], pos[b]});
+            for (int c = b + 1; c < n; ++c)
+                pool.agregar({pos[a], pos[b], pos[c]});
+        }
+    }
+}
+
+// Fuerza bruta: mejor partición con a lo sumo `maxRutas` rutas del pool
+static double mejorParticion(const PoolRutas& pool, vector<char>& cubierto,
+                             int pendientes, int maxRutas, double acumulado) {
+    if (pendientes == 0)
+        return acumulado;
+    if (maxRutas == 0)
+        return numeric_limits<double>::max();
+    int primero = static_cast<int>(find(cubierto.begin(), cubierto.end(), 0) - cubierto.begin());
+    double mejor = numeric_limits<double>::max();
+    for (int r = 0; r < pool.getTamano(); ++r) {
+        const vector<int>& conjunto = pool.getConjunto(r);
+        if (find(conjunto.begin(), conjunto.end(), primero) == conjunto.end())
+            continue;
+        bool libre = true;
+        for (int pos : conjunto)
+            libre = libre && !cubierto[pos];
+        if (!libre)
+            continue;
+        for (int pos : conjunto)
+            cubierto[pos] = 1;
+        mejor = min(mejor, mejorParticion(pool, cubierto, pendientes - static_cast<int>(conjunto.size()),
+                                          maxRutas - 1, acumulado + pool.getCosto(r)));
+        for (int pos : conjunto)
+            cubierto[pos] = 0;
+    }
+    return mejor;
+}
+
+static double costoRutas(const InstanciaCompacta& inst, const vector<vector<int>>& rutas) {
+    double costo = 0;
+    for (const vector<int>& ruta : rutas) {
+        int prev = inst.getPosDeposito();
+        for (int pos : ruta) {
+            costo += inst.dist(prev, pos);
+            prev = pos;
+        }
+        costo += inst.dist(prev, inst.getPosDeposito());
+    }
+    return costo;
+}
+
+static bool esParticion(const InstanciaCompacta& inst, const vector<vector<int>>& rutas) {
+    vector<int> vistos;
+    for (const vector<int>& ruta : rutas)
+        vistos.insert(vistos.end(), ruta.begin(), ruta.end());
+    sort(vistos.begin(), vistos.end());
+    vector<int> esperados = inst.getPosClientes();
+    sort(esperados.begin(), esperados.end());
+    return vistos == esperados;
+}
+
+TEST_CASE("PoolRutas: un conjunto se guarda una vez con la secuencia más barata", "[ParticionConjuntos]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos, 8);
+    InstanciaCompacta inst(clientes, distMatrix, id2pos, 1000, 1, 8);
+    PoolRutas pool(inst, 100);
+
+    vector<int> a = {1, 2, 3, 4};
+    vector<int> b = {1, 3, 2, 4};
+    double costoA = costoRutas(inst, {a});
+    double costoB = costoRutas(inst, {b});
+    REQUIRE(pool.agregar(costoA >= costoB ? a : b));
+    REQUIRE(pool.agregar(costoA >= costoB ? b : a) == (costoA != costoB));
+    REQUIRE_FALSE(pool.agregar(costoA >= costoB ? a : b));
+    REQUIRE(pool.getTamano() == 1);
+    REQUIRE(pool.getCosto(0) == Approx(min(costoA, costoB)));
+    REQUIRE(pool.getConjunto(0) == vector<int>({1, 2, 3, 4}));
+}
+
+TEST_CASE("ParticionConjuntos: coincide con la fuerza bruta", "[ParticionConjuntos]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos, 9);
+
+    for (int flota : {3, 4, 9}) {
+        InstanciaCompacta inst(clientes, distMatrix, id2pos, 1000, 1, flota);
+        PoolRutas pool(inst, 1000);
+        llenarPool(inst, pool);
+        vector<char> cubierto(inst.getCantPos(), 0);
+        cubierto[inst.getPosDeposito()] = 1;
+        double optimo = mejorParticion(pool, cubierto, 9, flota, 0);
+
+        ParticionConjuntos particion(inst);
+        vector<vector<int>> rutas;
+        REQUIRE(particion.resolver(pool, numeric_limits<double>::max(), rutas));
+        REQUIRE(particion.fueCompleta());
+        REQUIRE(static_cast<int>(rutas.size()) <= flota);
+        REQUIRE(esParticion(inst, rutas));
+        REQUIRE(costoRutas(inst, rutas) == Approx(optimo));
+        REQUIRE(particion.getCotaInferior() <= optimo + 1e-6);
+
+        // Con el óptimo como cota superior no hay nada mejor que devolver
+        REQUIRE_FALSE(particion.resolver(pool, optimo, rutas));
+    }
+}
+
+TEST_CASE("ParticionConjuntos: sin cobertura completa no hay partición", "[ParticionConjuntos]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos, 6);
+    InstanciaCompacta inst(clientes, distMatrix, id2pos, 1000, 1, 6);
+    PoolRutas pool(inst, 100);
+    pool.agregar({1, 2, 3});
+    pool.agregar({4, 5});
+
+    ParticionConjuntos particion(inst);
+    vector<vector<int>> rutas;
+    REQUIRE_FALSE(particion.resolver(pool, numeric_limits<double>::max(), rutas));
+}
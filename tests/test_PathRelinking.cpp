@@ -0,0 +1,63 @@
+#include "catch.hpp"
+#include "../src/PathRelinking.h"
+#include "../src/InstanciaCompacta.h"
+#include "../src/SolucionCompacta.h"
+#include "../src/Cliente.h"
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+
+using namespace std;
+
+// Dos grupos de clientes a ambos lados del depósito
+static vector<vector<double>> matrizDosGrupos(vector<pair<double,double>>& coords) {
+    coords = {{0, 0}, {-10, 0}, {-11, 1}, {-11, -1}, {10, 0}, {11, 1}, {11, -1}};
+    int n = coords.size();
+    vector<vector<double>> d(n, vector<double>(n));
+    for (int i = 0; i < n; ++i)
+        for (int j = 0; j < n; ++j)
+            d[i][j] = hypot(coords[i].first - coords[j].first, coords[i].second - coords[j].second);
+    return d;
+}
+
+TEST_CASE("PathRelinking: encuentra un intermedio mejor que el origen", "[PathRelinking]") {
+    vector<pair<double,double>> coords;
+    vector<vector<double>> dist = matrizDosGrupos(coords);
+    vector<Cliente> clientes;
+    unordered_map<int,int> id2pos = {{1, 0}};
+    for (int i = 1; i < 7; ++i) {
+        clientes.emplace_back(i + 1, 1);
+        id2pos[i + 1] = i;
+    }
+    InstanciaCompacta inst(clientes, dist, id2pos, 4, 1, 2);
+
+    // Origen mezcla los grupos; la guía los separa. Con capacidad 4 hay
+    // lugar para mover un cliente a la vez.
+    SolucionCompacta origen(inst, {{1, 2, 4}, {3, 5, 6}});
+    SolucionCompacta guia(inst, {{4, 6, 5}, {1, 3, 2}});
+    PathRelinking pr(inst);
+    SolucionCompacta resultado = pr.aplicar(origen, guia);
+
+    REQUIRE(resultado.getCosto() < origen.getCosto());
+    REQUIRE(resultado.esFactible());
+    SolucionCompacta recalculada(inst, resultado.getRutas());
+    REQUIRE(resultado.getCosto() == Approx(recalculada.getCosto()));
+}
+
+TEST_CASE("PathRelinking: origen igual a la guía no cambia nada", "[PathRelinking]") {
+    vector<pair<double,double>> coords;
+    vector<vector<double>> dist = matrizDosGrupos(coords);
+    vector<Cliente> clientes;
+    unordered_map<int,int> id2pos = {{1, 0}};
+    for (int i = 1; i < 7; ++i) {
+        clientes.emplace_back(i + 1, 1);
+        id2pos[i + 1] = i;
+    }
+    InstanciaCompacta inst(clientes, dist, id2pos, 3, 1, 2);
+
+    SolucionCompacta origen(inst, {{1, 2, 3}, {4, 5, 6}});
+    PathRelinking pr(inst);
+    SolucionCompacta resultado = pr.aplicar(origen, origen);
+    REQUIRE(resultado.getRutas() == origen.getRutas());
+    REQUIRE(resultado.getCosto() == Approx(origen.getCosto()));
+}
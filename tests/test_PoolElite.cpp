@@ -0,0 +1,59 @@
+#include "catch.hpp"
+#include "../src/PoolElite.h"
+#include "../src/InstanciaCompacta.h"
+#include "../src/SolucionCompacta.h"
+#include "../src/Cliente.h"
+#include <vector>
+#include <unordered_map>
+
+using namespace std;
+
+static vector<vector<double>> matrizCompleta(int n, double base) {
+    vector<vector<double>> d(n, vector<double>(n, base));
+    for (int i = 0; i < n; ++i) d[i][i] = 0;
+    return d;
+}
+
+TEST_CASE("PoolElite: diferencia por aristas", "[PoolElite]") {
+    vector<Cliente> clientes = {Cliente(2, 1), Cliente(3, 1), Cliente(4, 1)};
+    vector<vector<double>> dist = matrizCompleta(4, 1);
+    unordered_map<int,int> id2pos = {{1,0},{2,1},{3,2},{4,3}};
+    InstanciaCompacta inst(clientes, dist, id2pos, 10, 1, 3);
+
+    SolucionCompacta a(inst, {{1, 2, 3}});
+    SolucionCompacta b(inst, {{3, 2, 1}});  // mismas aristas, otro sentido
+    SolucionCompacta c(inst, {{1}, {2, 3}});
+    REQUIRE(PoolElite::diferencia(a, b) == 0);
+    // a: 0-1 1-2 2-3 3-0 ; c: 0-1 1-0 0-2 2-3 3-0
+    REQUIRE(PoolElite::diferencia(a, c) == 3);
+}
+
+TEST_CASE("PoolElite: rechaza duplicados y respeta la capacidad", "[PoolElite]") {
+    vector<Cliente> clientes = {Cliente(2, 1), Cliente(3, 1), Cliente(4, 1)};
+    vector<vector<double>> dist = {
+        {0, 1, 2, 3},
+        {1, 0, 1, 2},
+        {2, 1, 0, 1},
+        {3, 2, 1, 0}
+    };
+    unordered_map<int,int> id2pos = {{1,0},{2,1},{3,2},{4,3}};
+    InstanciaCompacta inst(clientes, dist, id2pos, 10, 1, 3);
+
+    PoolElite pool(2, 2);
+    SolucionCompacta buena(inst, {{1, 2, 3}});         // costo 6
+    SolucionCompacta media(inst, {{1}, {2, 3}});        // costo 2 + 6 = 8
+    SolucionCompacta mala(inst, {{1}, {2}, {3}});       // costo 12
+    SolucionCompacta otraMala(inst, {{2}, {1, 3}});     // costo 4 + 6 = 10
+
+    REQUIRE(pool.intentarAgregar(mala));
+    REQUIRE_FALSE(pool.intentarAgregar(mala));          // duplicado
+    REQUIRE(pool.intentarAgregar(otraMala));
+    REQUIRE(pool.getTamano() == 2);
+    REQUIRE_FALSE(pool.intentarAgregar(SolucionCompacta(inst, {{3}, {1}, {2}})));  // no mejora al peor
+    REQUIRE(pool.intentarAgregar(buena));
+    REQUIRE(pool.intentarAgregar(media));
+    REQUIRE(pool.getTamano() == 2);
+    REQUIRE(pool.getMejorCosto() == Approx(6));
+    for (int i = 0; i < pool.getTamano(); ++i)
+        REQUIRE(pool.getMiembro(i).getCosto() <= 8);
+}
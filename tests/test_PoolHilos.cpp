@@ -0,0 +1,57 @@
+#include "catch.hpp"
+#include "../src/PoolHilos.h"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+TEST_CASE("PoolHilos: ejecuta cada índice exactamente una vez", "[PoolHilos]") {
+    PoolHilos pool(4);
+    REQUIRE(pool.getCantidadHilos() == 4);
+    // Catch no admite REQUIRE desde otros hilos: se verifica al final
+    vector<atomic<int>> visitas(1000);
+    vector<int> hiloDe(1000, -1);
+    for (auto& v : visitas) v.store(0);
+    pool.paraCada(1000, [&](int i, int hilo) {
+        hiloDe[i] = hilo;
+        visitas[i]++;
+    });
+    for (int i = 0; i < 1000; ++i) {
+        REQUIRE(visitas[i].load() == 1);
+        REQUIRE(hiloDe[i] >= 0);
+        REQUIRE(hiloDe[i] < 4);
+    }
+}
+
+TEST_CASE("PoolHilos: se puede reutilizar entre llamadas", "[PoolHilos]") {
+    PoolHilos pool(3);
+    atomic<long> suma(0);
+    for (int ronda = 0; ronda < 20; ++ronda) {
+        pool.paraCada(50, [&](int i, int) { suma += i; });
+    }
+    REQUIRE(suma.load() == 20L * (49 * 50 / 2));
+}
+
+TEST_CASE("PoolHilos: un solo hilo corre en el llamador", "[PoolHilos]") {
+    PoolHilos pool(1);
+    vector<int> orden;
+    vector<int> hilos;
+    pool.paraCada(5, [&](int i, int hilo) {
+        hilos.push_back(hilo);
+        orden.push_back(i);
+    });
+    REQUIRE(orden == vector<int>({0, 1, 2, 3, 4}));
+    REQUIRE(hilos == vector<int>(5, 0));
+}
+
+TEST_CASE("PoolHilos: relanza la excepción de una tarea", "[PoolHilos]") {
+    PoolHilos pool(2);
+    REQUIRE_THROWS_AS(pool.paraCada(10, [](int i, int) {
+        if (i == 3) throw runtime_error("falla");
+    }), runtime_error);
+    // El pool sigue usable después del error
+    atomic<int> cuenta(0);
+    pool.paraCada(10, [&](int, int) { cuenta++; });
+    REQUIRE(cuenta.load() == 10);
+}
@@ -0,0 +1,71 @@
+#include "catch.hpp"
+#include "../src/Portafolio.h"
+#include "../src/HeuristicaInsercionCercana.h"
+#include "../src/Cliente.h"
+#include "../src/Solucion.h"
+#include "InstanciaAleatoria.h"
+#include <vector>
+#include <unordered_map>
+#include <chrono>
+#include <cmath>
+
+using namespace std;
+
+TEST_CASE("Portafolio: todas terminan y gana la mejor", "[Portafolio]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    HeuristicaInsercionCercana ni(clientes, distMatrix, id2pos, 40, 1, 8);
+    Solucion inicial = ni.resolver();
+
+    Portafolio portafolio(clientes, distMatrix, id2pos, 40, 1, 8, 11);
+    portafolio.setNumHilos(3);
+    portafolio.setGRASP(50, 3);
+    Solucion sol = portafolio.resolver();
+
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(sol.esFactible());
+    REQUIRE(sol.getCostoTotal() < inicial.getCostoTotal());
+    REQUIRE(sol.getCostoTotal() == Approx(portafolio.getMejorCosto()));
+
+    // Con empates gana la que publicó primero
+    bool hayGanadora = false;
+    REQUIRE(portafolio.getResultados().size() == 3);
+    for (const Portafolio::Resultado& r : portafolio.getResultados()) {
+        REQUIRE_FALSE(r.cancelado);
+        REQUIRE(r.costo >= sol.getCostoTotal() - 1e-9);
+        if (r.nombre == portafolio.getGanador()) {
+            REQUIRE(r.costo == Approx(sol.getCostoTotal()));
+            hayGanadora = true;
+        }
+    }
+    REQUIRE(hayGanadora);
+}
+
+TEST_CASE("Portafolio: el objetivo cancela a las demás", "[Portafolio]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    HeuristicaInsercionCercana ni(clientes, distMatrix, id2pos, 40, 1, 8);
+    Solucion inicial = ni.resolver();
+
+    // GRASP sin límite de iteraciones: sólo termina si la cancelan
+    Portafolio portafolio(clientes, distMatrix, id2pos, 40, 1, 8, 11);
+    portafolio.setNumHilos(3);
+    CriterioParada criterio;
+    criterio.limiteTiempo = 60;
+    criterio.costoObjetivo = inicial.getCostoTotal();
+    portafolio.setCriterioParada(criterio);
+    auto inicio = chrono::steady_clock::now();
+    Solucion sol = portafolio.resolver();
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    REQUIRE(sol.getCostoTotal() <= inicial.getCostoTotal());
+    REQUIRE(segundos < 5);
+    REQUIRE(portafolio.getResultados()[2].nombre == "grasp");
+    REQUIRE(portafolio.getResultados()[2].cancelado);
+}
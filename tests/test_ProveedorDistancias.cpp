@@ -0,0 +1,224 @@
+#include "catch.hpp"
+#include "../src/ProveedorDistancias.h"
+#include "../src/InstanciaCompacta.h"
+#include "../src/GeneradorAleatorio.h"
+#include "../src/Cliente.h"
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+TEST_CASE("ProveedorDistancias: por coordenadas da la fórmula del lector", "[ProveedorDistancias]") {
+    GeneradorAleatorio rng(3);
+    const int n = 37;
+    vector<double> xs, ys;
+    for (int i = 0; i < n; ++i) {
+        xs.push_back(rng.real01() * 1000);
+        ys.push_back(rng.real01() * 1000);
+    }
+    ProveedorDistancias euc(xs, ys);
+    ProveedorDistancias techo(xs, ys, ProveedorDistancias::Redondeo::HaciaArriba);
+    REQUIRE(euc.getCantidad() == n);
+    REQUIRE_FALSE(euc.esDensa());
+    REQUIRE_THROWS_AS(euc.getMatriz(), logic_error);
+
+    vector<double> fila(n), filaTecho(n);
+    for (int i = 0; i < n; ++i) {
+        euc.fila(i, fila.data());
+        techo.fila(i, filaTecho.data());
+        for (int j = 0; j < n; ++j) {
+            double d = sqrt(pow(xs[i] - xs[j], 2) + pow(ys[i] - ys[j], 2));
+            REQUIRE(euc(i, j) == d);
+            REQUIRE(euc(i, j) == euc(j, i));
+            REQUIRE(fila[j] == d);
+            REQUIRE(techo(i, j) == ceil(d));
+            REQUIRE(filaTecho[j] == ceil(d));
+        }
+    }
+}
+
+TEST_CASE("ProveedorDistancias: denso y reindexado", "[ProveedorDistancias]") {
+    vector<vector<double>> matriz = {
+        {0, 1, 2},
+        {3, 0, 4},
+        {5, 6, 0}
+    };
+    ProveedorDistancias densa(matriz);
+    REQUIRE(densa.esDensa());
+    REQUIRE(&densa.getMatriz() == &matriz);
+    REQUIRE(densa(1, 2) == 4);
+    vector<double> fila(3);
+    densa.fila(2, fila.data());
+    REQUIRE(fila == matriz[2]);
+
+    // El índice 0 queda sin uso; 1 y 2 son los viejos 2 y 0
+    auto reindexada = densa.reindexar({-1, 2, 0});
+    REQUIRE(reindexada->getCantidad() == 3);
+    REQUIRE((*reindexada)(1, 2) == 5);
+    REQUIRE((*reindexada)(2, 1) == 2);
+    REQUIRE((*reindexada)(0, 1) == 0);
+
+    ProveedorDistancias coordenadas({0, 3, 10}, {0, 4, 10});
+    auto porId = coordenadas.reindexar({-1, 2, 1});
+    REQUIRE_FALSE(porId->esDensa());
+    REQUIRE((*porId)(2, 1) == coordenadas(1, 2));
+}
+
+TEST_CASE("ProveedorDistancias: InstanciaCompacta sin matriz", "[ProveedorDistancias]") {
+    // Depósito (id 7) en el origen y tres clientes con IDs salteados
+    vector<Cliente> clientes = {Cliente(2, 3), Cliente(9, 4), Cliente(4, 5)};
+    unordered_map<int, int> id2pos = {{7, 0}, {2, 1}, {9, 2}, {4, 3}};
+    vector<double> xs = {0, 3, 0, 6}, ys = {0, 4, 8, 8};
+    auto coordenadas = make_shared<const ProveedorDistancias>(xs, ys);
+    vector<vector<double>> matriz(4, vector<double>(4));
+    for (int i = 0; i < 4; ++i)
+        coordenadas->fila(i, matriz[i].data());
+
+    InstanciaCompacta alVuelo(clientes, coordenadas, id2pos, 10, 7, 2);
+    InstanciaCompacta densa(clientes, matriz, id2pos, 10, 7, 2);
+    REQUIRE(alVuelo.esSimetrica());
+    REQUIRE_FALSE(alVuelo.getIdDistancias()->esDensa());
+    for (int a = 0; a < 4; ++a) {
+        for (int b = 0; b < 4; ++b)
+            REQUIRE(alVuelo.dist(a, b) == densa.dist(a, b));
+    }
+    REQUIRE((*alVuelo.getIdDistancias())(7, 9) == 8);
+
+    vector<vector<int>> rutas = {{1, 3}, {2}};
+    Solucion sv = alVuelo.aSolucion(rutas);
+    Solucion sd = densa.aSolucion(rutas);
+    REQUIRE(sv.getCostoTotal() == sd.getCostoTotal());
+    REQUIRE(alVuelo.rutasDesde(sv) == rutas);
+}
+
+TEST_CASE("ProveedorDistancias: formatos compactos", "[ProveedorDistancias]") {
+    using Formato = ProveedorDistancias::Formato;
+    GeneradorAleatorio rng(11);
+    const int n = 23;
+    vector<double> xs, ys;
+    for (int i = 0; i < n; ++i) {
+        xs.push_back(rng.real01() * 1000);
+        ys.push_back(rng.real01() * 1000);
+    }
+    ProveedorDistancias coordenadas(xs, ys);
+
+    ProveedorDistancias densa(coordenadas, Formato::Densa);
+    ProveedorDistancias simple(coordenadas, Formato::Simple);
+    ProveedorDistancias triangular(coordenadas, Formato::Triangular);
+    ProveedorDistancias triangularSimple(coordenadas, Formato::TriangularSimple);
+    REQUIRE(densa.esDensa());
+    REQUIRE_FALSE(triangular.esDensa());
+    REQUIRE_FALSE(triangular.tieneCoordenadas());
+    REQUIRE(triangular.simetricaPorConstruccion());
+    REQUIRE_FALSE(simple.simetricaPorConstruccion());
+    REQUIRE_THROWS_AS(simple.getMatriz(), logic_error);
+    REQUIRE(simple.getBytes() * 2 == densa.getBytes());
+    REQUIRE(triangularSimple.getBytes() < triangular.getBytes());
+    REQUIRE(triangular.getBytes() < densa.getBytes());
+
+    vector<double> fila(n);
+    for (int i = 0; i < n; ++i) {
+        triangularSimple.fila(i, fila.data());
+        for (int j = 0; j < n; ++j) {
+            const double d = coordenadas(i, j);
+            const double f = static_cast<float>(d);
+            REQUIRE(densa(i, j) == d);
+            REQUIRE(triangular(i, j) == d);
+            REQUIRE(simple(i, j) == f);
+            REQUIRE(triangularSimple(i, j) == f);
+            REQUIRE(fila[j] == f);
+        }
+    }
+
+    // conAlmacen da el acceso concreto con los mismos valores
+    double suma = 0;
+    triangular.conAlmacen([&](const auto& dist) {
+        for (int j = 0; j < n; ++j)
+            suma += dist(3, j);
+    });
+    double esperada = 0;
+    for (int j = 0; j < n; ++j)
+        esperada += coordenadas(3, j);
+    REQUIRE(suma == esperada);
+
+    // Reindexado: el índice 0 queda sin uso
+    vector<int> origen = {-1, 5, 2, 17};
+    for (const ProveedorDistancias* p : {&simple, &triangular, &triangularSimple}) {
+        auto r = p->reindexar(origen);
+        REQUIRE(r->getFormato() == p->getFormato());
+        REQUIRE(r->getCantidad() == 4);
+        for (int i = 1; i < 4; ++i) {
+            for (int j = 1; j < 4; ++j)
+                REQUIRE((*r)(i, j) == (*p)(origen[i], origen[j]));
+        }
+    }
+}
+
+TEST_CASE("ProveedorDistancias: el triangular exige simetría", "[ProveedorDistancias]") {
+    using Formato = ProveedorDistancias::Formato;
+    vector<vector<double>> asimetrica = {
+        {0, 1, 2},
+        {3, 0, 4},
+        {2, 4, 0}
+    };
+    ProveedorDistancias densa(asimetrica);
+    REQUIRE_THROWS_AS(ProveedorDistancias(densa, Formato::Triangular), invalid_argument);
+    REQUIRE_THROWS_AS(ProveedorDistancias(densa, Formato::TriangularSimple), invalid_argument);
+    REQUIRE_THROWS_AS(ProveedorDistancias(densa, Formato::Coordenadas), invalid_argument);
+
+    // La matriz completa en float conserva la asimetría
+    ProveedorDistancias simple(densa, Formato::Simple);
+    REQUIRE(simple(0, 1) == 1);
+    REQUIRE(simple(1, 0) == 3);
+
+    asimetrica[1][0] = 1;
+    ProveedorDistancias triangular(ProveedorDistancias(asimetrica), Formato::Triangular);
+    REQUIRE(triangular(1, 0) == 1);
+    REQUIRE(triangular(2, 1) == 4);
+}
+
+TEST_CASE("ProveedorDistancias: vista sobre un bloque externo", "[ProveedorDistancias]") {
+    using Formato = ProveedorDistancias::Formato;
+    const int n = 5;
+    // Asimétrica, para notar si se cruzan filas y columnas
+    auto datos = make_shared<vector<double>>(n * n);
+    for (int a = 0; a < n; ++a)
+        for (int b = 0; b < n; ++b)
+            (*datos)[a * n + b] = 10 * a + b;
+    shared_ptr<const double> bloque(datos, datos->data());
+    ProveedorDistancias externa(bloque, n);
+    REQUIRE(externa.getFormato() == Formato::Externa);
+    REQUIRE_FALSE(externa.esDensa());
+    REQUIRE_FALSE(externa.simetricaPorConstruccion());
+    REQUIRE(externa(3, 1) == 31);
+    REQUIRE(externa.getBytes() == n * n * sizeof(double));
+    REQUIRE_THROWS_AS(ProveedorDistancias(externa, Formato::Externa), invalid_argument);
+
+    vector<double> fila(n);
+    externa.fila(2, fila.data());
+    REQUIRE(fila == vector<double>({20, 21, 22, 23, 24}));
+    ProveedorDistancias densa(externa, Formato::Densa);
+    REQUIRE(densa.getMatriz()[4][2] == 42);
+
+    // Índices consecutivos: otra vista del mismo bloque, también sobre otra
+    // vista y con índices sin uso
+    auto corrida = externa.reindexar({1, 2, 3, 4});
+    REQUIRE(corrida->getFormato() == Formato::Externa);
+    REQUIRE((*corrida)(0, 3) == 14);
+    auto deVuelta = corrida->reindexar({-1, 0, 1, 2, 3});
+    REQUIRE(deVuelta->getFormato() == Formato::Externa);
+    REQUIRE((*deVuelta)(4, 1) == 41);
+    REQUIRE(datos.use_count() == 5);
+
+    // Índices salteados: se copian
+    vector<int> origen = {-1, 4, 0, 2};
+    auto salteada = externa.reindexar(origen);
+    REQUIRE(salteada->esDensa());
+    for (int i = 1; i < 4; ++i) {
+        for (int j = 1; j < 4; ++j)
+            REQUIRE((*salteada)(i, j) == externa(origen[i], origen[j]));
+    }
+}
@@ -0,0 +1,126 @@
+#include "catch.hpp"
+#include "../src/SISR.h"
+#include "../src/HeuristicaInsercionCercana.h"
+#include "../src/GeneradorAleatorio.h"
+#include "../src/Cliente.h"
+#include "../src/Solucion.h"
+#include "../src/ProveedorDistancias.h"
+#include "InstanciaAleatoria.h"
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+
+using namespace std;
+
+TEST_CASE("SISR: factible y mejor que la inserción cercana", "[SISR]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    HeuristicaInsercionCercana ni(clientes, distMatrix, id2pos, 40, 1, 8);
+    Solucion inicial = ni.resolver();
+
+    SISR sisr(clientes, distMatrix, id2pos, 40, 1, 8, 5);
+    Solucion sol = sisr.resolver();
+    REQUIRE(sisr.getIteracionesRealizadas() == 100 * 30);
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(sol.esFactible());
+    REQUIRE(sol.getRutas().size() <= 8);
+    for (const Ruta& r : sol.getRutas())
+        REQUIRE(r.getDemandaActual() <= 40);
+    REQUIRE(sol.getCostoTotal() < inicial.getCostoTotal());
+    REQUIRE(sol.getCostoTotal() == Approx(sisr.getMejorCosto()));
+}
+
+TEST_CASE("SISR: misma semilla, misma solución, también desde una inicial", "[SISR]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    HeuristicaInsercionCercana ni(clientes, distMatrix, id2pos, 40, 1, 8);
+    Solucion inicial = ni.resolver();
+
+    for (double split : {0.0, 0.5, 1.0}) {
+        SISR x(clientes, distMatrix, id2pos, 40, 1, 8, 17);
+        SISR y(clientes, distMatrix, id2pos, 40, 1, 8, 17);
+        for (SISR* s : {&x, &y}) {
+            s->setSolucionInicial(inicial);
+            s->setRuina(6, 5, split);
+            s->setMaxIteraciones(500);
+        }
+        Solucion sx = x.resolver();
+        Solucion sy = y.resolver();
+        REQUIRE(x.getIteracionesRealizadas() == 500);
+        REQUIRE(sx.vistoTodos());
+        REQUIRE(sx.esFactible());
+        REQUIRE(sx.getCostoTotal() <= inicial.getCostoTotal() + 1e-9);
+        REQUIRE(sx.getCostoTotal() == sy.getCostoTotal());
+    }
+}
+
+TEST_CASE("SISR: flota justa sigue siendo factible", "[SISR]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+    int demandaTotal = 0;
+    for (const Cliente& c : clientes) demandaTotal += c.getDemand();
+    int flota = (demandaTotal + 39) / 40 + 1;
+
+    SISR sisr(clientes, distMatrix, id2pos, 40, 1, flota, 3);
+    sisr.setMaxIteraciones(2000);
+    Solucion sol = sisr.resolver();
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(sol.esFactible());
+    REQUIRE(static_cast<int>(sol.getRutas().size()) <= flota);
+}
+
+TEST_CASE("SISR: con distancias por coordenadas da la misma solución que con la matriz", "[SISR]") {
+    const int n = 40;
+    GeneradorAleatorio rng(17);
+    vector<double> xs = {50}, ys = {50};
+    vector<Cliente> clientes;
+    unordered_map<int,int> id2pos;
+    id2pos[1] = 0;
+    for (int i = 0; i < n; ++i) {
+        xs.push_back(rng.real01() * 100);
+        ys.push_back(rng.real01() * 100);
+        clientes.emplace_back(i + 2, 1 + rng.enteroEn(9));
+        id2pos[i + 2] = i + 1;
+    }
+    auto coordenadas = make_shared<const ProveedorDistancias>(xs, ys);
+    vector<vector<double>> distMatrix(n + 1, vector<double>(n + 1));
+    for (int i = 0; i <= n; ++i)
+        coordenadas->fila(i, distMatrix[i].data());
+
+    SISR densa(clientes, distMatrix, id2pos, 40, 1, 10, 9);
+    SISR alVuelo(clientes, coordenadas, id2pos, 40, 1, 10, 9);
+    densa.setMaxIteraciones(1000);
+    alVuelo.setMaxIteraciones(1000);
+    Solucion sd = densa.resolver();
+    Solucion sv = alVuelo.resolver();
+    REQUIRE(sv.vistoTodos());
+    REQUIRE(sv.getCostoTotal() == sd.getCostoTotal());
+    REQUIRE(sv.getRutas().size() == sd.getRutas().size());
+    for (size_t r = 0; r < sd.getRutas().size(); ++r)
+        REQUIRE(sv.getRutas()[r].getClientes() == sd.getRutas()[r].getClientes());
+}
+
+TEST_CASE("SISR: sobre una instancia compartida da lo mismo", "[SISR]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    SISR propia(clientes, distMatrix, id2pos, 40, 1, 8, 3);
+    propia.setMaxIteraciones(500);
+    Solucion esperada = propia.resolver();
+
+    auto inst = make_shared<const InstanciaCompacta>(clientes, distMatrix, id2pos, 40, 1, 8);
+    SISR compartida(inst, 3);
+    compartida.setMaxIteraciones(500);
+    REQUIRE(compartida.resolver().getCostoTotal() == esperada.getCostoTotal());
+}
@@ -0,0 +1,69 @@
+#include "catch.hpp"
+#include "../src/SimulatedAnnealing.h"
+#include "../src/HeuristicaInsercionCercana.h"
+#include "../src/Cliente.h"
+#include "../src/Solucion.h"
+#include "InstanciaAleatoria.h"
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+
+using namespace std;
+
+TEST_CASE("SimulatedAnnealing: mejora la solución inicial y es factible", "[SimulatedAnnealing]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    HeuristicaInsercionCercana ni(clientes, distMatrix, id2pos, 40, 1, 8);
+    Solucion inicial = ni.resolver();
+
+    SimulatedAnnealing sa(clientes, distMatrix, id2pos, 40, 1, 8, 7);
+    sa.setMovimientosPorBloque(200);
+    Solucion sol = sa.resolver();
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(sol.esFactible());
+    for (const Ruta& r : sol.getRutas())
+        REQUIRE(r.getDemandaActual() <= 40);
+    REQUIRE(sol.getCostoTotal() < inicial.getCostoTotal());
+    REQUIRE(sol.getCostoTotal() == Approx(sa.getMejorCosto()));
+    REQUIRE(sa.getMovimientosAceptados() <= sa.getMovimientosRealizados());
+}
+
+TEST_CASE("SimulatedAnnealing: misma semilla, misma solución", "[SimulatedAnnealing]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    SimulatedAnnealing a(clientes, distMatrix, id2pos, 40, 1, 8, 11);
+    SimulatedAnnealing b(clientes, distMatrix, id2pos, 40, 1, 8, 11);
+    a.setEnfriamiento(SimulatedAnnealing::Enfriamiento::Adaptativo, 0.99);
+    b.setEnfriamiento(SimulatedAnnealing::Enfriamiento::Adaptativo, 0.99);
+    a.setMaxMovimientos(50000);
+    b.setMaxMovimientos(50000);
+    Solucion sa = a.resolver();
+    Solucion sb = b.resolver();
+    REQUIRE(a.getMovimientosRealizados() == 50000);
+    REQUIRE(sa.getCostoTotal() == sb.getCostoTotal());
+    REQUIRE(a.getMovimientosAceptados() == b.getMovimientosAceptados());
+    REQUIRE(sa.esFactible());
+    REQUIRE(sa.vistoTodos());
+}
+
+TEST_CASE("SimulatedAnnealing: respeta el costo objetivo", "[SimulatedAnnealing]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    SimulatedAnnealing sa(clientes, distMatrix, id2pos, 40, 1, 8, 3);
+    CriterioParada criterio;
+    criterio.costoObjetivo = 1e9;  // cualquier solución alcanza
+    criterio.limiteTiempo = 30;
+    sa.setCriterioParada(criterio);
+    Solucion sol = sa.resolver();
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(sa.getMovimientosRealizados() < 1000000);
+}
@@ -0,0 +1,220 @@
+#include "catch.hpp"
+#include "../src/InstanciaCompacta.h"
+#include "../src/SolucionCompacta.h"
+#include "../src/Cliente.h"
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+
+using namespace std;
+
+// Depósito (ID 1, pos 0) y clientes 2..5 en las posiciones 1..4, sobre una recta
+static vector<vector<double>> matrizRecta() {
+    vector<double> x = {0, 1, 2, 3, 4};
+    vector<vector<double>> d(5, vector<double>(5));
+    for (int i = 0; i < 5; ++i)
+        for (int j = 0; j < 5; ++j)
+            d[i][j] = x[i] > x[j] ? x[i] - x[j] : x[j] - x[i];
+    return d;
+}
+
+TEST_CASE("SolucionCompacta: costos y cargas", "[SolucionCompacta]") {
+    vector<Cliente> clientes = {Cliente(2, 3), Cliente(3, 4), Cliente(4, 2), Cliente(5, 5)};
+    vector<vector<double>> dist = matrizRecta();
+    unordered_map<int,int> id2pos = {{1,0},{2,1},{3,2},{4,3},{5,4}};
+    InstanciaCompacta inst(clientes, dist, id2pos, 10, 1, 2);
+    REQUIRE(inst.getCantClientes() == 4);
+    REQUIRE(inst.getPosDeposito() == 0);
+
+    SolucionCompacta sol(inst, {{1, 2}, {3, 4}});
+    REQUIRE(sol.getCostoRuta(0) == Approx(4));
+    REQUIRE(sol.getCostoRuta(1) == Approx(8));
+    REQUIRE(sol.getCosto() == Approx(12));
+    REQUIRE(sol.getCarga(0) == 7);
+    REQUIRE(sol.getCarga(1) == 7);
+    REQUIRE(sol.getRutaDe(3) == 1);
+    REQUIRE(sol.getIndiceEn(4) == 1);
+    REQUIRE(sol.esFactible());
+}
+
+TEST_CASE("SolucionCompacta: deltas coinciden con el recálculo", "[SolucionCompacta]") {
+    vector<Cliente> clientes = {Cliente(2, 3), Cliente(3, 4), Cliente(4, 2), Cliente(5, 5)};
+    vector<vector<double>> dist = matrizRecta();
+    unordered_map<int,int> id2pos = {{1,0},{2,1},{3,2},{4,3},{5,4}};
+    InstanciaCompacta inst(clientes, dist, id2pos, 20, 1, 2);
+
+    SolucionCompacta sol(inst, {{4, 1}, {2, 3}});
+    double antes = sol.getCosto();
+    double delta = sol.deltaRemover(0, 0) + sol.deltaInsertar(1, 2, 4);
+    sol.remover(0, 0);
+    sol.insertar(1, 2, 4);
+    REQUIRE(sol.getCosto() == Approx(antes + delta));
+
+    SolucionCompacta copia(inst, sol.getRutas());
+    REQUIRE(sol.getCosto() == Approx(copia.getCosto()));
+    REQUIRE(sol.getRuta(1) == vector<int>({2, 3, 4}));
+    REQUIRE(sol.getIndiceEn(4) == 2);
+    REQUIRE(sol.getCarga(1) == 11);
+
+    double deltaMejor;
+    int i = sol.mejorInsercion(0, 2, deltaMejor);
+    REQUIRE(deltaMejor == Approx(sol.deltaInsertar(0, i, 2)));
+}
+
+TEST_CASE("SolucionCompacta: rutas vacías y factibilidad", "[SolucionCompacta]") {
+    vector<Cliente> clientes = {Cliente(2, 3), Cliente(3, 4)};
+    vector<vector<double>> dist = matrizRecta();
+    unordered_map<int,int> id2pos = {{1,0},{2,1},{3,2}};
+    InstanciaCompacta inst(clientes, dist, id2pos, 5, 1, 2);
+
+    SolucionCompacta sol(inst, {{1}, {2}});
+    sol.remover(0, 0);
+    REQUIRE(sol.getCostoRuta(0) == 0);
+    REQUIRE_FALSE(sol.esFactible());  // el cliente 2 quedó sin ruta
+    sol.insertar(1, 0, 1);
+    REQUIRE_FALSE(sol.esFactible());  // 7 > capacidad 5
+    sol.eliminarRutasVacias();
+    REQUIRE(sol.getCantRutas() == 1);
+    REQUIRE(sol.getRutaDe(1) == 0);
+    REQUIRE(sol.getRutaDe(2) == 0);
+}
+
+TEST_CASE("SolucionCompacta: conversión a Solucion y vuelta", "[SolucionCompacta]") {
+    vector<Cliente> clientes = {Cliente(2, 3), Cliente(3, 4), Cliente(4, 2), Cliente(5, 5)};
+    vector<vector<double>> dist = matrizRecta();
+    unordered_map<int,int> id2pos = {{1,0},{2,1},{3,2},{4,3},{5,4}};
+    InstanciaCompacta inst(clientes, dist, id2pos, 10, 1, 2);
+
+    SolucionCompacta sol(inst, {{1, 2}, {3, 4}});
+    Solucion legado = sol.aSolucion();
+    REQUIRE(legado.getCostoTotal() == Approx(sol.getCosto()));
+    REQUIRE(legado.vistoTodos());
+    REQUIRE(legado.getRutas()[0].getClientes() == vector<int>({1, 2, 3, 1}));
+    REQUIRE(inst.rutasDesde(legado) == sol.getRutas());
+}
+
+TEST_CASE("SolucionCompacta: instancia con las distancias por ID ya armadas", "[SolucionCompacta]") {
+    vector<Cliente> clientes = {Cliente(2, 3), Cliente(3, 4), Cliente(4, 2), Cliente(5, 5)};
+    vector<vector<double>> dist = matrizRecta();
+    unordered_map<int,int> id2pos = {{1,0},{2,1},{3,2},{4,3},{5,4}};
+    // La misma recta indexada por ID (el índice 0 no se usa)
+    vector<vector<double>> porId(6, vector<double>(6, 0.0));
+    for (const auto& a : id2pos)
+        for (const auto& b : id2pos)
+            porId[a.first][b.first] = dist[a.second][b.second];
+    auto idDist = make_shared<const ProveedorDistancias>(porId);
+    InstanciaCompacta inst(clientes, make_shared<const ProveedorDistancias>(dist), idDist,
+                           id2pos, 10, 1, 2);
+    REQUIRE(inst.getIdDistancias() == idDist);
+
+    SolucionCompacta sol(inst, {{1, 2}, {3, 4}});
+    Solucion legado = sol.aSolucion();
+    REQUIRE(legado.getCostoTotal() == Approx(sol.getCosto()));
+    REQUIRE(inst.rutasDesde(legado) == sol.getRutas());
+}
+
+TEST_CASE("SolucionCompacta: mover, intercambiar e invertir", "[SolucionCompacta]") {
+    // Puntos en el plano con distancias euclídeas
+    vector<pair<double,double>> coords = {{0,0}, {3,1}, {5,4}, {1,6}, {-2,3}, {-4,-1}, {2,-3}};
+    int n = coords.size();
+    vector<vector<double>> dist(n, vector<double>(n));
+    for (int i = 0; i < n; ++i)
+        for (int j = 0; j < n; ++j)
+            dist[i][j] = hypot(coords[i].first - coords[j].first, coords[i].second - coords[j].second);
+    vector<Cliente> clientes;
+    unordered_map<int,int> id2pos = {{1, 0}};
+    for (int i = 1; i < n; ++i) {
+        clientes.emplace_back(i + 1, i);
+        id2pos[i + 1] = i;
+    }
+    InstanciaCompacta inst(clientes, dist, id2pos, 100, 1, 3);
+    SolucionCompacta base(inst, {{1, 2, 3, 4}, {5, 6}, {}});
+
+    auto verificar = [&](const SolucionCompacta& s, double esperado) {
+        SolucionCompacta recalculada(inst, s.getRutas());
+        REQUIRE(s.getCosto() == Approx(recalculada.getCosto()));
+        REQUIRE(s.getCosto() == Approx(esperado));
+        for (int r = 0; r < s.getCantRutas(); ++r) {
+            REQUIRE(s.getCarga(r) == recalculada.getCarga(r));
+            REQUIRE(s.getCostoRuta(r) == Approx(recalculada.getCostoRuta(r)));
+            for (size_t i = 0; i < s.getRuta(r).size(); ++i) {
+                REQUIRE(s.getRutaDe(s.getRuta(r)[i]) == r);
+                REQUIRE(s.getIndiceEn(s.getRuta(r)[i]) == static_cast<int>(i));
+            }
+        }
+    };
+
+    // Todos los movimientos posibles, dentro y entre rutas
+    for (int r1 = 0; r1 < 2; ++r1) {
+        for (int i1 = 0; i1 < static_cast<int>(base.getRuta(r1).size()); ++i1) {
+            for (int r2 = 0; r2 < 3; ++r2) {
+                int largo = static_cast<int>(base.getRuta(r2).size()) - (r1 == r2 ? 1 : 0);
+                for (int j = 0; j <= largo; ++j) {
+                    SolucionCompacta s = base;
+                    double esperado = s.getCosto() + s.deltaMover(r1, i1, r2, j);
+                    s.mover(r1, i1, r2, j);
+                    verificar(s, esperado);
+                }
+                for (int i2 = 0; i2 < static_cast<int>(base.getRuta(r2).size()); ++i2) {
+                    SolucionCompacta s = base;
+                    double esperado = s.getCosto() + s.deltaIntercambiar(r1, i1, r2, i2);
+                    s.intercambiar(r1, i1, r2, i2);
+                    verificar(s, esperado);
+                }
+            }
+            for (int j = i1; j < static_cast<int>(base.getRuta(r1).size()); ++j) {
+                SolucionCompacta s = base;
+                double esperado = s.getCosto() + s.deltaInvertir(r1, i1, j);
+                s.invertir(r1, i1, j);
+                verificar(s, esperado);
+            }
+        }
+    }
+}
+
+TEST_CASE("SolucionCompacta: reemplazar dos rutas que intercambian clientes", "[SolucionCompacta]") {
+    vector<Cliente> clientes = {Cliente(2, 3), Cliente(3, 4), Cliente(4, 2), Cliente(5, 5)};
+    vector<vector<double>> dist = matrizRecta();
+    unordered_map<int,int> id2pos = {{1,0},{2,1},{3,2},{4,3},{5,4}};
+    InstanciaCompacta inst(clientes, dist, id2pos, 10, 1, 2);
+
+    SolucionCompacta sol(inst, {{1, 2}, {3, 4}});
+    sol.reemplazarRuta(0, {1, 4});
+    sol.reemplazarRuta(1, {3, 2});
+    REQUIRE(sol.getRutaDe(4) == 0);
+    REQUIRE(sol.getRutaDe(2) == 1);
+    REQUIRE(sol.getIndiceEn(2) == 1);
+    REQUIRE(sol.esFactible());
+    SolucionCompacta recalculada(inst, sol.getRutas());
+    REQUIRE(sol.getCosto() == Approx(recalculada.getCosto()));
+}
+
+TEST_CASE("SolucionCompacta: invertir con distancias asimétricas", "[SolucionCompacta]") {
+    // Ir hacia un índice mayor cuesta el doble que volver
+    const int n = 6;
+    vector<vector<double>> dist(n, vector<double>(n, 0.0));
+    for (int i = 0; i < n; ++i)
+        for (int j = 0; j < n; ++j)
+            dist[i][j] = (i < j ? 2.0 : 1.0) * abs(i - j) + (i * j) % 3;
+    vector<Cliente> clientes;
+    unordered_map<int,int> id2pos = {{1, 0}};
+    for (int i = 1; i < n; ++i) {
+        clientes.emplace_back(i + 1, 1);
+        id2pos[i + 1] = i;
+    }
+    InstanciaCompacta inst(clientes, dist, id2pos, 100, 1, 2);
+    REQUIRE_FALSE(inst.esSimetrica());
+
+    SolucionCompacta base(inst, {{1, 2, 3, 4, 5}});
+    for (int i = 0; i < 5; ++i) {
+        for (int j = i; j < 5; ++j) {
+            SolucionCompacta s = base;
+            double esperado = s.getCosto() + s.deltaInvertir(0, i, j);
+            s.invertir(0, i, j);
+            SolucionCompacta recalculada(inst, s.getRutas());
+            REQUIRE(s.getCosto() == Approx(recalculada.getCosto()));
+            REQUIRE(s.getCosto() == Approx(esperado));
+        }
+    }
+}
@@ -0,0 +1,73 @@
+#include "catch.hpp"
+#include "../src/Split.h"
+#include "../src/InstanciaCompacta.h"
+#include "../src/Cliente.h"
+#include <vector>
+#include <unordered_map>
+
+using namespace std;
+
+// Depósito (ID 1, pos 0) en 0 y clientes 2..7 en las posiciones 1..6, sobre
+// una recta: el cliente en la posición p está en x = p
+static vector<vector<double>> matrizRecta() {
+    vector<vector<double>> d(7, vector<double>(7));
+    for (int i = 0; i < 7; ++i)
+        for (int j = 0; j < 7; ++j)
+            d[i][j] = i > j ? i - j : j - i;
+    return d;
+}
+
+TEST_CASE("Split: partición óptima respetando la capacidad", "[Split]") {
+    vector<Cliente> clientes;
+    unordered_map<int,int> id2pos = {{1, 0}};
+    for (int i = 0; i < 6; ++i) {
+        clientes.emplace_back(i + 2, 3);
+        id2pos[i + 2] = i + 1;
+    }
+    vector<vector<double>> dist = matrizRecta();
+    InstanciaCompacta inst(clientes, dist, id2pos, 9, 1, 3);
+    Split split(inst);
+
+    // En la recta cada ruta cuesta 2 * (x más lejano): conviene agrupar los
+    // lejanos juntos (4, 5, 6) y los cercanos (1, 2, 3)
+    vector<vector<int>> rutas;
+    double costo = split.dividir({1, 2, 3, 4, 5, 6}, 0, rutas);
+    REQUIRE(rutas == vector<vector<int>>({{1, 2, 3}, {4, 5, 6}}));
+    REQUIRE(costo == Approx(6 + 12));
+
+    // Con un orden malo del tour sólo se puede cortar en tramos consecutivos
+    costo = split.dividir({6, 1, 5, 2, 4, 3}, 0, rutas);
+    double suma = 0;
+    for (const vector<int>& ruta : rutas) {
+        int carga = 0;
+        for (int c : ruta) carga += inst.getDemanda(c);
+        REQUIRE(carga <= 9);
+        int prev = 0;
+        for (int c : ruta) { suma += dist[prev][c]; prev = c; }
+        suma += dist[prev][0];
+    }
+    REQUIRE(costo == Approx(suma));
+}
+
+TEST_CASE("Split: con límite de flota", "[Split]") {
+    vector<Cliente> clientes;
+    unordered_map<int,int> id2pos = {{1, 0}};
+    for (int i = 0; i < 6; ++i) {
+        clientes.emplace_back(i + 2, 3);
+        id2pos[i + 2] = i + 1;
+    }
+    vector<vector<double>> dist = matrizRecta();
+    InstanciaCompacta inst(clientes, dist, id2pos, 9, 1, 2);
+    Split split(inst);
+
+    // Sin límite conviene una ruta por cliente lejano; con 2 rutas no
+    vector<vector<int>> rutas;
+    double sinLimite = split.dividir({6, 5, 4, 1, 2, 3}, 0, rutas);
+    double conLimite = split.dividir({6, 5, 4, 1, 2, 3}, 2, rutas);
+    REQUIRE(rutas.size() == 2);
+    REQUIRE(conLimite >= sinLimite);
+
+    // Si la flota no alcanza se devuelve la partición sin límite
+    split.dividir({1, 2, 3, 4, 5, 6}, 1, rutas);
+    REQUIRE(rutas.size() == 2);
+}
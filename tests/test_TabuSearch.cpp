@@ -0,0 +1,82 @@
+#include "catch.hpp"
+#include "../src/TabuSearch.h"
+#include "../src/HeuristicaInsercionCercana.h"
+#include "../src/Cliente.h"
+#include "../src/Solucion.h"
+#include "InstanciaAleatoria.h"
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+
+using namespace std;
+
+TEST_CASE("TabuSearch: mejora la solución inicial y es factible", "[TabuSearch]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    HeuristicaInsercionCercana ni(clientes, distMatrix, id2pos, 40, 1, 8);
+    Solucion inicial = ni.resolver();
+
+    TabuSearch ts(clientes, distMatrix, id2pos, 40, 1, 8, 5, 10);
+    Solucion sol = ts.resolver();
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(sol.esFactible());
+    for (const Ruta& r : sol.getRutas())
+        REQUIRE(r.getDemandaActual() <= 40);
+    REQUIRE(sol.getCostoTotal() < inicial.getCostoTotal());
+    REQUIRE(sol.getCostoTotal() == Approx(ts.getMejorCosto()));
+    REQUIRE(ts.getIteracionesRealizadas() > 0);
+}
+
+TEST_CASE("TabuSearch: límite de iteraciones y determinismo", "[TabuSearch]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    TabuSearch a(clientes, distMatrix, id2pos, 40, 1, 8, 9);
+    TabuSearch b(clientes, distMatrix, id2pos, 40, 1, 8, 9);
+    a.setMaxIteraciones(300);
+    b.setMaxIteraciones(300);
+    a.setTenencia(3, 8);
+    b.setTenencia(3, 8);
+    Solucion sa = a.resolver();
+    Solucion sb = b.resolver();
+    REQUIRE(a.getIteracionesRealizadas() == 300);
+    REQUIRE(sa.getCostoTotal() == sb.getCostoTotal());
+    REQUIRE(a.getIteracionesPorSegundo() > 0);
+}
+
+TEST_CASE("TabuSearch: sobre una instancia compartida da lo mismo", "[TabuSearch]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    TabuSearch propia(clientes, distMatrix, id2pos, 40, 1, 8, 9);
+    propia.setMaxIteraciones(300);
+    Solucion esperada = propia.resolver();
+
+    auto inst = make_shared<const InstanciaCompacta>(clientes, distMatrix, id2pos, 40, 1, 8);
+    TabuSearch compartida(inst, 9);
+    compartida.setMaxIteraciones(300);
+    REQUIRE(compartida.resolver().getCostoTotal() == esperada.getCostoTotal());
+}
+
+TEST_CASE("TabuSearch: corte por iteraciones sin mejora", "[TabuSearch]") {
+    vector<Cliente> clientes;
+    vector<vector<double>> distMatrix;
+    unordered_map<int,int> id2pos;
+    instanciaAleatoria(clientes, distMatrix, id2pos);
+
+    TabuSearch ts(clientes, distMatrix, id2pos, 40, 1, 8, 1);
+    CriterioParada criterio;
+    criterio.iteracionesSinMejora = 25;
+    ts.setCriterioParada(criterio);
+    Solucion sol = ts.resolver();
+    REQUIRE(sol.vistoTodos());
+    REQUIRE(ts.getIteracionesRealizadas() >= 25);
+}
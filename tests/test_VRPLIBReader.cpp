@@ -0,0 +1,247 @@
+#include "catch.hpp"
+#include "../src/VRPLIBReader.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace std;
+
+// Escribe `contenido` en un archivo temporal y devuelve su ruta
+static string archivoTemporal(const string& contenido) {
+    char ruta[] = "/tmp/vrplibXXXXXX";
+    int fd = mkstemp(ruta);
+    REQUIRE(fd >= 0);
+    close(fd);
+    ofstream(ruta, ios::binary) << contenido;
+    return ruta;
+}
+
+TEST_CASE("VRPLIBReader: lee encabezados, coordenadas, demandas y depósito", "[VRPLIBReader]") {
+    string ruta = archivoTemporal(
+        "NAME : chica\r\n"
+        "COMMENT : prueba\r\n"
+        "TYPE : CVRP\r\n"
+        "DIMENSION : 4\r\n"
+        "EDGE_WEIGHT_TYPE : EUC_2D\r\n"
+        "CAPACITY: 50\r\n"
+        "VEHICLES : 2\r\n"
+        "NODE_COORD_SECTION\r\n"
+        "1 0 0\r\n"
+        "2 3 4\r\n"
+        "3 -1.5 2.25\r\n"
+        "  4\t6 8\r\n"
+        "DEMAND_SECTION\r\n"
+        "1 0\r\n"
+        "2 10\r\n"
+        "3 20\r\n"
+        "4 30\r\n"
+        "DEPOT_SECTION\r\n"
+        " 1\r\n"
+        " -1\r\n"
+        "EOF\r\n");
+    VRPLIBReader reader(ruta);
+    remove(ruta.c_str());
+
+    REQUIRE(reader.getName() == "chica");
+    REQUIRE(reader.getDimension() == 4);
+    REQUIRE(reader.getCapacity() == 50);
+    REQUIRE(reader.getNumVehicles() == 2);
+    REQUIRE(reader.getDepotId() == 1);
+    REQUIRE(reader.getNodes().size() == 4);
+    REQUIRE(reader.getNodes()[2].x == Approx(-1.5));
+    REQUIRE(reader.getNodes()[2].y == Approx(2.25));
+    REQUIRE(reader.getNodes()[3].id == 4);
+    REQUIRE(reader.getDemands()[3] == 20);
+    REQUIRE(reader.getDemands()[4] == 30);
+    REQUIRE(reader.getDistanceMatrix()[1][2] == Approx(5.0));
+    REQUIRE(reader.getDistanceMatrix()[4][2] == Approx(5.0));
+}
+
+TEST_CASE("VRPLIBReader: sin VEHICLES usa una cota y sin archivo falla", "[VRPLIBReader]") {
+    string ruta = archivoTemporal(
+        "NAME : sin_flota\n"
+        "DIMENSION : 3\n"
+        "CAPACITY : 10\n"
+        "NODE_COORD_SECTION\n"
+        "1 0 0\n"
+        "2 1 0\n"
+        "3 0 1\n"
+        "DEMAND_SECTION\n"
+        "1 0\n"
+        "2 4\n"
+        "3 5\n"
+        "DEPOT_SECTION\n"
+        "1\n"
+        "-1\n"
+        "EOF");
+    VRPLIBReader reader(ruta);
+    remove(ruta.c_str());
+    REQUIRE(reader.getNumVehicles() == 2);
+    REQUIRE(reader.getDemands()[3] == 5);
+
+    REQUIRE_THROWS_AS(VRPLIBReader("/tmp/no_existe_vrplib.vrp"), runtime_error);
+}
+
+// Instancia EXPLICIT de 4 nodos con la sección de pesos dada
+static string instanciaExplicita(const string& formato, const string& pesos) {
+    return "NAME : explicita\n"
+           "TYPE : CVRP\n"
+           "DIMENSION : 4\n"
+           "EDGE_WEIGHT_TYPE : EXPLICIT\n"
+           "EDGE_WEIGHT_FORMAT : " + formato + "\n"
+           "CAPACITY : 10\n"
+           "EDGE_WEIGHT_SECTION\n" + pesos +
+           "DEMAND_SECTION\n"
+           "1 0\n2 1\n3 2\n4 3\n"
+           "DEPOT_SECTION\n"
+           "1\n-1\n"
+           "EOF\n";
+}
+
+TEST_CASE("VRPLIBReader: matrices EXPLICIT en todos los formatos", "[VRPLIBReader]") {
+    // Matriz simétrica d(i,j) = 10 * min(i,j) + max(i,j)
+    auto esperado = [](int i, int j) { return i == j ? 0.0 : 10.0 * min(i, j) + max(i, j); };
+    vector<pair<string, string>> formatos = {
+        {"UPPER_ROW", "12 13 14\n23 24 34\n"},
+        {"LOWER_ROW", "12\n13 23\n14 24 34\n"},
+        {"UPPER_DIAG_ROW", "0 12 13 14 0 23\n24 0 34 0\n"},
+        {"LOWER_DIAG_ROW", "0\n12 0\n13 23 0\n14 24 34 0\n"},
+        {"FULL_MATRIX", "0 12 13 14\n12 0 23 24\n13 23 0 34\n14 24 34 0\n"},
+    };
+    for (const auto& formato : formatos) {
+        string ruta = archivoTemporal(instanciaExplicita(formato.first, formato.second));
+        VRPLIBReader reader(ruta);
+        remove(ruta.c_str());
+        INFO(formato.first);
+        REQUIRE(reader.getEdgeWeightType() == EdgeWeightType::Explicit);
+        REQUIRE(reader.getNodes().size() == 4);
+        REQUIRE(reader.getDepotId() == 1);
+        for (int i = 1; i <= 4; ++i)
+            for (int j = 1; j <= 4; ++j)
+                REQUIRE(reader.getDistanceMatrix()[i][j] == esperado(i, j));
+    }
+
+    // FULL_MATRIX puede ser asimétrica
+    string ruta = archivoTemporal(instanciaExplicita("FULL_MATRIX",
+        "0 1 2 3\n4 0 5 6\n7 8 0 9\n10 11 12 0\n"));
+    VRPLIBReader asimetrica(ruta);
+    remove(ruta.c_str());
+    REQUIRE(asimetrica.getDistanceMatrix()[1][2] == 1);
+    REQUIRE(asimetrica.getDistanceMatrix()[2][1] == 4);
+    REQUIRE(asimetrica.getDistanceMatrix()[4][3] == 12);
+
+    string incompleta = archivoTemporal(instanciaExplicita("UPPER_ROW", "12 13 14\n23\n"));
+    REQUIRE_THROWS_AS(VRPLIBReader(incompleta), runtime_error);
+    remove(incompleta.c_str());
+}
+
+TEST_CASE("VRPLIBReader: distancias CEIL_2D, ATT y GEO", "[VRPLIBReader]") {
+    auto leer = [](const string& tipo, const string& coordenadas) {
+        string ruta = archivoTemporal(
+            "NAME : coords\nDIMENSION : 2\nEDGE_WEIGHT_TYPE : " + tipo + "\n"
+            "CAPACITY : 10\nNODE_COORD_SECTION\n" + coordenadas +
+            "DEMAND_SECTION\n1 0\n2 1\nDEPOT_SECTION\n1\n-1\nEOF\n");
+        VRPLIBReader reader(ruta);
+        remove(ruta.c_str());
+        return reader.getDistanceMatrix()[1][2];
+    };
+    REQUIRE(leer("EUC_2D", "1 0 0\n2 1 1\n") == Approx(sqrt(2.0)));
+    REQUIRE(leer("CEIL_2D", "1 0 0\n2 1 1\n") == 2);
+    // Primeros nodos de att48 y de burma14 (TSPLIB)
+    REQUIRE(leer("ATT", "1 6734 1453\n2 2233 10\n") == 1495);
+    REQUIRE(leer("GEO", "1 16.47 96.10\n2 16.47 94.44\n") == 153);
+    // Un tipo desconocido se lee como EUC_2D
+    REQUIRE(leer("MAN_2D", "1 0 0\n2 1 1\n") == Approx(sqrt(2.0)));
+}
+
+TEST_CASE("VRPLIBReader: sin matriz para distancias al vuelo", "[VRPLIBReader]") {
+    auto leer = [](const string& tipo) {
+        string ruta = archivoTemporal(
+            "NAME : coords\nDIMENSION : 2\nEDGE_WEIGHT_TYPE : " + tipo + "\n"
+            "CAPACITY : 10\nNODE_COORD_SECTION\n1 6734 1453\n2 2233 10\n"
+            "DEMAND_SECTION\n1 0\n2 1\nDEPOT_SECTION\n1\n-1\nEOF\n");
+        VRPLIBReader reader(ruta, DistanceStorage::OnDemand);
+        remove(ruta.c_str());
+        return reader;
+    };
+    VRPLIBReader euc = leer("EUC_2D");
+    REQUIRE_FALSE(euc.hasDistanceMatrix());
+    REQUIRE(euc.getDistanceMatrix().empty());
+    REQUIRE(euc.getNodes().size() == 2);
+    REQUIRE(euc.getNodes()[1].x == 2233);
+    REQUIRE_FALSE(leer("CEIL_2D").hasDistanceMatrix());
+    // ATT no se calcula al vuelo: la matriz se arma igual
+    VRPLIBReader att = leer("ATT");
+    REQUIRE(att.hasDistanceMatrix());
+    REQUIRE(att.getDistanceMatrix()[1][2] == 1495);
+}
+
+TEST_CASE("VRPLIBReader: caché binaria .cvrpbin", "[VRPLIBReader]") {
+    string contenido =
+        "NAME : cache\n"
+        "DIMENSION : 5\n"
+        "EDGE_WEIGHT_TYPE : CEIL_2D\n"
+        "CAPACITY : 10\n"
+        "VEHICLES : 3\n"
+        "NODE_COORD_SECTION\n"
+        "1 0 0\n2 3 4\n3 -1.5 2\n4 6 8\n5 1 1\n"
+        "DEMAND_SECTION\n"
+        "1 0\n2 4\n3 5\n4 6\n5 7\n"
+        "DEPOT_SECTION\n1\n-1\nEOF\n";
+    string ruta = archivoTemporal(contenido);
+    char plantilla[] = "/tmp/cvrpbinXXXXXX";
+    REQUIRE(mkdtemp(plantilla) != nullptr);
+    string directorio = string(plantilla) + "/cache";
+
+    VRPLIBReader texto(ruta);
+    VRPLIBReader primera(ruta, directorio);
+    VRPLIBReader segunda(ruta, directorio);
+    REQUIRE_FALSE(primera.isFromCache());
+    REQUIRE(segunda.isFromCache());
+
+    REQUIRE(segunda.getName() == texto.getName());
+    REQUIRE(segunda.getDimension() == texto.getDimension());
+    REQUIRE(segunda.getCapacity() == texto.getCapacity());
+    REQUIRE(segunda.getNumVehicles() == texto.getNumVehicles());
+    REQUIRE(segunda.getDepotId() == texto.getDepotId());
+    REQUIRE(segunda.getEdgeWeightType() == EdgeWeightType::Ceil2D);
+    REQUIRE(segunda.getDemands() == texto.getDemands());
+    // La matriz se sirve desde el archivo mapeado, sin copiarla
+    REQUIRE_FALSE(primera.getMappedDistances());
+    shared_ptr<const double> mapeada = segunda.getMappedDistances();
+    REQUIRE(mapeada);
+    const vector<vector<double>>& matriz = texto.getDistanceMatrix();
+    for (size_t i = 0; i < matriz.size(); ++i) {
+        for (size_t j = 0; j < matriz.size(); ++j)
+            REQUIRE(mapeada.get()[i * matriz.size() + j] == matriz[i][j]);
+    }
+    REQUIRE(segunda.hasDistanceMatrix());
+    REQUIRE(segunda.getDistanceMatrix() == texto.getDistanceMatrix());
+    REQUIRE(segunda.getNodes().size() == texto.getNodes().size());
+    for (size_t i = 0; i < texto.getNodes().size(); ++i) {
+        REQUIRE(segunda.getNodes()[i].id == texto.getNodes()[i].id);
+        REQUIRE(segunda.getNodes()[i].x == texto.getNodes()[i].x);
+        REQUIRE(segunda.getNodes()[i].y == texto.getNodes()[i].y);
+    }
+
+    // Vecinos por ID, del más cercano al más lejano
+    REQUIRE(segunda.getNeighborCount() == 4);
+    REQUIRE(segunda.getNearestNeighbors() == primera.getNearestNeighbors());
+    const int* vecinosDeposito = segunda.getNearestNeighbors().data() + 1 * 4;
+    REQUIRE(vecinosDeposito[0] == 5);
+    REQUIRE(vecinosDeposito[3] == 4);
+
+    // Un archivo modificado no reutiliza la entrada anterior
+    ofstream(ruta, ios::binary) << contenido << "\n";
+    VRPLIBReader modificado(ruta, directorio);
+    REQUIRE_FALSE(modificado.isFromCache());
+    remove(ruta.c_str());
+    system(("rm -rf " + string(plantilla)).c_str());
+}